@@ -27,6 +27,7 @@ class DDAPass : public ModulePass {
     using SVFGSCC = SCCDetection<SVFG *>;
     using SVFGEdgeSet = OrderedSet<const SVFGEdge *>;
     using PTAVector = std::vector<PointerAnalysis *>;
+    using ValuePair = std::pair<const Value *, const Value *>;
 
     DDAPass() : ModulePass(ID), _pta(nullptr), _client(nullptr) {}
     ~DDAPass();
@@ -53,6 +54,18 @@ class DDAPass : public ModulePass {
     /// Interface expose to users of our pointer analysis, given PAGNodes
     virtual AliasResult alias(NodeID V1, NodeID V2);
 
+    /// Batch interfaces. Every distinct pointer of a batch is computed once
+    /// and every distinct pair is compared once; results follow the order of
+    /// the queries.
+    //@{
+    virtual void alias(const std::vector<ValuePair> &queries,
+                       std::vector<AliasResult> &results);
+    virtual void alias(const std::vector<NodePair> &queries,
+                       std::vector<AliasResult> &results);
+    /// Compute the points-to sets of the pointers in ptrs
+    virtual void computeDDAPts(const std::vector<NodeID> &ptrs);
+    //@}
+
     /// We start from here
     virtual void runOnModule(SVFProject *proj);
 
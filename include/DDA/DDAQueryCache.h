@@ -0,0 +1,101 @@
+/*
+ * DDAQueryCache.h
+ *
+ * Bookkeeping for the dpms whose points-to sets demand-driven analyses keep
+ * from one query to the next. The points-to sets themselves stay in the
+ * solver's caches; this class remembers which dpms are finished, in which
+ * order they were last used and under which version of the on-the-fly call
+ * graph they were computed.
+ */
+
+#ifndef DDAQUERYCACHE_H_
+#define DDAQUERYCACHE_H_
+
+#include "Util/BasicTypes.h"
+
+#include <list>
+
+namespace SVF {
+
+/*!
+ * LRU set of finished dpms, tagged with a call graph version
+ */
+template <class DPIm> class DDAQueryCache {
+
+  public:
+    using DPImList = std::list<DPIm>;
+
+    /// Lookup results
+    enum Status { Miss, Hit, Stale };
+
+    /// Constructor; a capacity of 0 keeps every finished dpm
+    explicit DDAQueryCache(u32_t capacity = 0) : capacity(capacity) {}
+
+    /// Record dpm as finished under the current call graph version
+    void add(const DPIm &dpm) {
+        auto it = entries.find(dpm);
+        if (it != entries.end()) {
+            lru.splice(lru.begin(), lru, it->second.pos);
+            it->second.version = version;
+            return;
+        }
+
+        lru.push_front(dpm);
+        entries.insert(std::make_pair(dpm, Entry{lru.begin(), version}));
+    }
+
+    /// Look dpm up, making it the most recently used entry on a hit. Stale
+    /// entries were computed before the call graph last changed.
+    Status lookup(const DPIm &dpm) {
+        auto it = entries.find(dpm);
+        if (it == entries.end()) {
+            return Miss;
+        }
+        if (it->second.version != version) {
+            return Stale;
+        }
+
+        lru.splice(lru.begin(), lru, it->second.pos);
+        return Hit;
+    }
+
+    /// Forget dpm
+    void erase(const DPIm &dpm) {
+        auto it = entries.find(dpm);
+        if (it != entries.end()) {
+            lru.erase(it->second.pos);
+            entries.erase(it);
+        }
+    }
+
+    /// Make all entries stale, the call graph has changed
+    inline void invalidate() { ++version; }
+
+    /// Remove the least recently used entries beyond the capacity, adding
+    /// them to evicted
+    void shrink(DPImList &evicted) {
+        while (capacity != 0 && entries.size() > capacity) {
+            const DPIm &dpm = lru.back();
+            entries.erase(dpm);
+            evicted.splice(evicted.end(), lru, std::prev(lru.end()));
+        }
+    }
+
+    inline u32_t size() const { return entries.size(); }
+    inline u32_t getCapacity() const { return capacity; }
+
+  private:
+    struct Entry {
+        typename DPImList::iterator pos;
+        u32_t version;
+    };
+
+    u32_t capacity;
+    u32_t version = 0;
+    DPImList lru; ///< entries, most recently used first
+    OrderedMap<DPIm, Entry> entries;
+};
+
+} // End namespace SVF
+
+#endif /* DDAQUERYCACHE_H_ */
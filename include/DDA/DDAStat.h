@@ -38,6 +38,10 @@ class DDAStat : public PTAStat {
     double _TotalTimeOfQueries;
     double _TotalTimeOfBKCondition;
 
+    u32_t _NumOfCacheHits;
+    u32_t _NumOfCacheEvictions;
+    u32_t _NumOfCacheInvalidations;
+
     NodeBS _StrongUpdateStores;
 
     void performStatPerQuery(NodeID ptr) override;
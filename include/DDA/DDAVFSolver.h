@@ -8,8 +8,10 @@
 #ifndef VALUEFLOWDDA_H_
 #define VALUEFLOWDDA_H_
 
+#include "DDA/DDAQueryCache.h"
 #include "DDA/DDAStat.h"
 #include "MSSA/SVFGBuilder.h"
+#include "Util/Options.h"
 #include "Util/SCC.h"
 #include "WPA/Andersen.h"
 #include <algorithm>
@@ -36,12 +38,14 @@ class DDAVFSolver {
     using ConstSVFGEdgeSet = OrderedSet<const SVFGEdge *>;
     using SVFGEdgeSet = SVFGEdge::SVFGEdgeSetTy;
     using StoreToPMSetMap = OrderedMap<const SVFGNode *, DPTItemSet>;
+    using QueryCache = DDAQueryCache<DPIm>;
 
     /// Constructor
     DDAVFSolver(SVFProject *proj)
         : outOfBudgetQuery(false), _pag(proj->getPAG()), _svfg(nullptr),
           _ander(nullptr), proj(proj), _callGraph(nullptr),
-          _callGraphSCC(nullptr), _svfgSCC(nullptr), ddaStat(nullptr) {}
+          _callGraphSCC(nullptr), _svfgSCC(nullptr), ddaStat(nullptr),
+          queryCache(Options::DDACacheSize) {}
     /// Destructor
     virtual ~DDAVFSolver() {
         delete _ander;
@@ -85,7 +89,7 @@ class DDAVFSolver {
     /// Compute points-to
     virtual const CPtSet &findPT(const DPIm &dpm) {
 
-        if (isbkVisited(dpm)) {
+        if (isbkVisited(dpm) && !isStaleFinishedDpm(dpm)) {
             const CPtSet &cpts = getCachedPointsTo(dpm);
             DBOUT(DDDA, SVFUtil::outs() << "\t already backward visited dpm: ");
             DBOUT(DDDA, dpm.dump());
@@ -197,10 +201,14 @@ class DDAVFSolver {
         /// callgraph scc detection for local variable in recursion
         if (!newIndirectEdges.empty()) {
             _callGraphSCC->find();
+            /// dpms finished by earlier queries may miss the new callees
+            queryCache.invalidate();
+            DOSTAT(ddaStat->_NumOfCacheInvalidations++);
         }
         reComputeForEdges(dpm, newIndirectEdges, true);
 
         /// re-compute for transitive closures
+        getSVFG()->buildIndirectVFOn(dpm.getLoc());
         SVFGEdgeSet edgeSet(dpm.getLoc()->getOutEdges());
         reComputeForEdges(dpm, edgeSet, false);
     }
@@ -253,13 +261,19 @@ class DDAVFSolver {
     /// Build SVFG
     virtual inline void buildSVFG() {
         _ander = AndersenWaveDiff::createAndersenWaveDiff(proj);
-        _svfg = svfgBuilder.buildPTROnlySVFGWithoutOPT(_ander);
+        if (Options::LazySVFG) {
+            _svfg = svfgBuilder.buildLazyPTROnlySVFG(_ander);
+        } else {
+            _svfg = svfgBuilder.buildPTROnlySVFGWithoutOPT(_ander);
+        }
         // _pag = _svfg->getPAG();
     }
     /// Reset visited map for next points-to query
     virtual inline void resetQuery() {
         if (outOfBudgetQuery) {
             OOBResetVisited();
+        } else {
+            cacheFinishedDpms();
         }
 
         locToDpmSetMap.clear();
@@ -267,6 +281,8 @@ class DDAVFSolver {
         loadToPTCVarMap.clear();
         outOfBudgetQuery = false;
         ddaStat->_NumOfStep = 0;
+        /// nothing of the SVFG is being traversed between queries
+        getSVFG()->finishQuery();
     }
     /// Reset visited map if the current query is out-of-budget
     inline void OOBResetVisited() {
@@ -284,6 +300,40 @@ class DDAVFSolver {
             }
         }
     }
+    /// Keep the dpms of the last (finished) query for later queries, evicting
+    /// the least recently used dpms beyond the cache capacity
+    void cacheFinishedDpms() {
+        for (const auto &it : locToDpmSetMap) {
+            for (const DPIm &dpm : it.second) {
+                if (isOutOfBudgetDpm(dpm) == false) {
+                    queryCache.add(dpm);
+                }
+            }
+        }
+
+        typename QueryCache::DPImList evicted;
+        queryCache.shrink(evicted);
+        for (const DPIm &dpm : evicted) {
+            clearbkVisited(dpm);
+            clearCachedPointsTo(dpm);
+            DOSTAT(ddaStat->_NumOfCacheEvictions++);
+        }
+    }
+    /// Whether dpm was finished by an earlier query before the call graph
+    /// last changed. Such a dpm is no longer visited and gets recomputed.
+    inline bool isStaleFinishedDpm(const DPIm &dpm) {
+        switch (queryCache.lookup(dpm)) {
+        case QueryCache::Hit:
+            DOSTAT(ddaStat->_NumOfCacheHits++);
+            return false;
+        case QueryCache::Stale:
+            queryCache.erase(dpm);
+            clearbkVisited(dpm);
+            return true;
+        default:
+            return false;
+        }
+    }
     /// GetDefinition SVFG
     inline const SVFGNode *getDefSVFGNode(const PAGNode *pagNode) const {
         return getSVFG()->getDefSVFGNode(pagNode);
@@ -295,6 +345,7 @@ class DDAVFSolver {
         if (_pag->isConstantObj(obj) || _pag->isNonPointerObj(obj)) {
             return;
         }
+        getSVFG()->buildIndirectVFOn(node);
         const SVFGEdgeSet &edgeSet(node->getInEdges());
         for (auto *it : edgeSet) {
             if (const IndirectSVFGEdge *indirEdge =
@@ -526,6 +577,14 @@ class DDAVFSolver {
     virtual inline const CPtSet &getCachedADPointsTo(const DPIm &dpm) {
         return dpmToADCPtSetMap[dpm];
     }
+    /// Drop the cached points-to of a dpm evicted from the query cache
+    virtual inline void clearCachedPointsTo(const DPIm &dpm) {
+        if (isTopLevelPtrStmt(dpm.getLoc())) {
+            dpmToTLCPtSetMap.erase(dpm);
+        } else {
+            dpmToADCPtSetMap.erase(dpm);
+        }
+    }
     //@}
 
     /// Whether this is a top-level pointer statement
@@ -555,6 +614,7 @@ class DDAVFSolver {
     }
     /// SVFG SCC detection
     inline void SVFGSCCDetection() {
+        getSVFG()->buildAllIndirectVF();
         if (_svfgSCC == nullptr) {
             _svfgSCC = make_shared<SVFGSCC>(getSVFG());
         }
@@ -723,6 +783,7 @@ class DDAVFSolver {
                                   ///< stong updated there
     DDAStat *ddaStat{};           ///< DDA stat
     SVFGBuilder svfgBuilder;      ///< SVFG Builder
+    QueryCache queryCache;        ///< dpms kept from finished queries
 };
 
 } // End namespace SVF
@@ -115,6 +115,12 @@ class FlowDDA : public BVDataPTAImpl,
     inline const PointsTo &getCachedTLPointsTo(const LocDPItem &dpm) override {
         return getPts(dpm.getCurNodeID());
     }
+    /// Top-level points-to are the analysis results and stay
+    inline void clearCachedPointsTo(const LocDPItem &dpm) override {
+        if (!isTopLevelPtrStmt(dpm.getLoc())) {
+            dpmToADCPtSetMap.erase(dpm);
+        }
+    }
     //@}
 
     /// Union pts
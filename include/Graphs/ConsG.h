@@ -33,6 +33,8 @@
 #include "Graphs/ConsGEdge.h"
 #include "Graphs/ConsGNode.h"
 
+#include <numeric>
+
 namespace SVF {
 
 using GenericConstraintGraphTy = GenericGraph<ConstraintNode, ConstraintEdge>;
@@ -54,14 +56,18 @@ class ConstraintGraph : public GenericConstraintGraph {
 
   protected:
     PAG *pag = nullptr;
-    NodeToRepMap nodeToRepMap;
+    /// Union-find forest of SCC reps indexed by node ID. A node is its own
+    /// rep unless it has been merged; nodes past the end are not merged.
+    std::vector<NodeID> nodeToRep;
     NodeToSubsMap nodeToSubsMap;
     WorkList nodesToBeCollapsed;
+    /// Sources of the direct edges added since clearNewDirectEdgeSrcs()
+    NodeBS newDirectEdgeSrcs;
 
-    ConstraintEdge::ConstraintEdgeSetTy AddrCGEdgeSet;
-    ConstraintEdge::ConstraintEdgeSetTy directEdgeSet;
-    ConstraintEdge::ConstraintEdgeSetTy LoadCGEdgeSet;
-    ConstraintEdge::ConstraintEdgeSetTy StoreCGEdgeSet;
+    ConstraintEdge::ConstraintEdgeOrderedSetTy AddrCGEdgeSet;
+    ConstraintEdge::ConstraintEdgeOrderedSetTy directEdgeSet;
+    ConstraintEdge::ConstraintEdgeOrderedSetTy LoadCGEdgeSet;
+    ConstraintEdge::ConstraintEdgeOrderedSetTy StoreCGEdgeSet;
 
     void buildCG();
 
@@ -124,19 +130,19 @@ class ConstraintGraph : public GenericConstraintGraph {
     /// Get PAG edge
     //@{
     /// Get Address edges
-    inline ConstraintEdge::ConstraintEdgeSetTy &getAddrCGEdges() {
+    inline ConstraintEdge::ConstraintEdgeOrderedSetTy &getAddrCGEdges() {
         return AddrCGEdgeSet;
     }
     /// Get Copy/call/ret/gep edges
-    inline ConstraintEdge::ConstraintEdgeSetTy &getDirectCGEdges() {
+    inline ConstraintEdge::ConstraintEdgeOrderedSetTy &getDirectCGEdges() {
         return directEdgeSet;
     }
     /// Get Load edges
-    inline ConstraintEdge::ConstraintEdgeSetTy &getLoadCGEdges() {
+    inline ConstraintEdge::ConstraintEdgeOrderedSetTy &getLoadCGEdges() {
         return LoadCGEdgeSet;
     }
     /// Get Store edges
-    inline ConstraintEdge::ConstraintEdgeSetTy &getStoreCGEdges() {
+    inline ConstraintEdge::ConstraintEdgeOrderedSetTy &getStoreCGEdges() {
         return StoreCGEdgeSet;
     }
     //@}
@@ -162,18 +168,26 @@ class ConstraintGraph : public GenericConstraintGraph {
     /// SCC rep/sub nodes methods
     //@{
     inline NodeID sccRepNode(NodeID id) const {
-        auto it = nodeToRepMap.find(id);
-        if (it == nodeToRepMap.end()) {
-            return id;
+        while (id < nodeToRep.size() && nodeToRep[id] != id) {
+            id = nodeToRep[id];
         }
-
-        return it->second;
+        return id;
     }
     inline NodeBS &sccSubNodes(NodeID id) {
         nodeToSubsMap[id].set(id);
         return nodeToSubsMap[id];
     }
-    inline void setRep(NodeID node, NodeID rep) { nodeToRepMap[node] = rep; }
+    /// Link node to the root of rep. Mergers relink all sub nodes of a rep
+    /// as well, which keeps the trees flat.
+    inline void setRep(NodeID node, NodeID rep) {
+        rep = sccRepNode(rep);
+        if (node >= nodeToRep.size()) {
+            NodeID size = nodeToRep.size();
+            nodeToRep.resize(node + 1);
+            std::iota(nodeToRep.begin() + size, nodeToRep.end(), size);
+        }
+        nodeToRep[node] = rep;
+    }
     inline void setSubs(NodeID node, NodeBS &subs) {
         nodeToSubsMap[node] |= subs;
     }
@@ -267,6 +281,14 @@ class ConstraintGraph : public GenericConstraintGraph {
     inline NodeID getNextCollapseNode() { return nodesToBeCollapsed.pop(); }
     //@}
 
+    /// Sources of new direct edges, for incremental SCC detection
+    //@{
+    inline const NodeBS &getNewDirectEdgeSrcs() const {
+        return newDirectEdgeSrcs;
+    }
+    inline void clearNewDirectEdgeSrcs() { newDirectEdgeSrcs.clear(); }
+    //@}
+
     /// Dump graph into dot file
     void dump(std::string name);
     /// Print CG into terminal
@@ -31,6 +31,7 @@
 #define CONSGEDGE_H_
 
 #include "Graphs/PAG.h"
+#include "Util/FlatSet.h"
 #include "Util/WorkList.h"
 
 #include <map>
@@ -43,6 +44,15 @@ class ConstraintNode;
 using GenericConsEdgeTy = GenericEdge<ConstraintNode>;
 using GenericConsEdge = GenericConsEdgeTy;
 
+class ConstraintEdge;
+
+/// A constraint graph has many nodes with few edges each, so its nodes keep
+/// their edges in sorted arrays rather than in trees
+template <>
+struct GEdgeSetSelector<ConstraintEdge> {
+    using type = FlatSet<ConstraintEdge *, GenericConsEdge::equalGEdge>;
+};
+
 /*!
  * Self-defined edge for constraint resolution
  * including add/remove/re-target, but all the operations do not affect original
@@ -93,6 +103,8 @@ class ConstraintEdge : public GenericConsEdge {
     /// Constraint edge type
     using ConstraintEdgeSetTy =
         GenericNode<ConstraintNode, ConstraintEdge>::GEdgeSetTy;
+    /// Tree set with the same order, for the edges of the whole graph
+    using ConstraintEdgeOrderedSetTy = OrderedSet<ConstraintEdge *, equalGEdge>;
 };
 
 /*!
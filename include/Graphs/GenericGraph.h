@@ -33,6 +33,8 @@
 #include "Util/BasicTypes.h"
 #include "Util/Serialization.h"
 
+#include <llvm/ADT/iterator_range.h>
+
 namespace SVF {
 
 #define MAX_NODEID (numeric_limits<NodeID>::max())
@@ -150,6 +152,16 @@ class GenericEdge {
     }
 };
 
+/*!
+ * Container of the incoming/outgoing edges of a generic node. A graph may
+ * specialise it for its edge type to store its edges differently; the
+ * container needs the insert/erase/find interface of a set.
+ */
+template <class EdgeTy>
+struct GEdgeSetSelector {
+    using type = OrderedSet<EdgeTy *, typename EdgeTy::equalGEdge>;
+};
+
 /*!
  * Generic node on the graph as base class
  */
@@ -161,7 +173,7 @@ class GenericNode {
     using EdgeType = EdgeTy;
     /// Edge kind
     using GNodeK = s32_t;
-    using GEdgeSetTy = OrderedSet<EdgeType *, typename EdgeType::equalGEdge>;
+    using GEdgeSetTy = typename GEdgeSetSelector<EdgeType>::type;
     /// Edge iterator
     ///@{
     using iterator = typename GEdgeSetTy::iterator;
@@ -274,6 +286,10 @@ class GenericNode {
         assert(it != OutEdges.end() && "can not find out edge in SVFG node");
         return OutEdges.erase(edge);
     }
+    inline void clearEdges() {
+        InEdges.clear();
+        OutEdges.clear();
+    }
     ///@}
 
     /// Find incoming and outgoing edges
@@ -300,6 +316,12 @@ class GenericNode {
 /*
  * Generic graph for program representation
  * It is base class and needs to be instantiated
+ *
+ * Once a graph is built, freeze() compacts it for traversal: nodes are
+ * indexed by a dense vector (used by getGNode/hasGNode) and the edges of
+ * all nodes are copied into CSR arrays (getFrozenOutEdges/getFrozenInEdges).
+ * Changing the edges of a frozen graph unfreezes it, while the node index
+ * is kept up to date until the graph is destroyed.
  */
 template <class NodeTy, class EdgeTy>
 class GenericGraph {
@@ -317,6 +339,8 @@ class GenericGraph {
     using iterator = typename IDToNodeMapTy::iterator;
     using const_iterator = typename IDToNodeMapTy::const_iterator;
     //@}
+    /// Edges of a node in a frozen graph
+    using FrozenEdgeRange = llvm::iterator_range<EdgeType *const *>;
 
     /// Constructor
     GenericGraph() : currentNodeId(0), currentEdgeId(0) {}
@@ -358,6 +382,15 @@ class GenericGraph {
         IDToNodeMap[id] = node;
         NodeToIDMap[node] = id;
 
+        if (!nodeIndex.empty()) {
+            if (id >= nodeIndex.size()) {
+                nodeIndex.resize(id + 1, nullptr);
+            }
+            nodeIndex[id] = node;
+        }
+        // A frozen graph has no CSR entries for id.
+        unfreeze();
+
         return true;
     }
 
@@ -374,6 +407,10 @@ class GenericGraph {
 
     /// Get a node
     inline NodeType *getGNode(NodeID id) const {
+        if (id < nodeIndex.size()) {
+            assert(nodeIndex[id] != nullptr && "Node not found!");
+            return nodeIndex[id];
+        }
         const_iterator it = IDToNodeMap.find(id);
         assert(it != IDToNodeMap.end() && "Node not found!");
         return it->second;
@@ -381,6 +418,9 @@ class GenericGraph {
 
     /// node query by id
     inline bool hasGNode(NodeID id) const {
+        if (!nodeIndex.empty()) {
+            return id < nodeIndex.size() && nodeIndex[id] != nullptr;
+        }
         return IDToNodeMap.find(id) != IDToNodeMap.end();
     }
 
@@ -412,6 +452,10 @@ class GenericGraph {
         auto it2 = NodeToIDMap.find(node);
         assert(it2 != NodeToIDMap.end() && "can not find the node");
         NodeToIDMap.erase(it2);
+
+        if (node->getId() < nodeIndex.size()) {
+            nodeIndex[node->getId()] = nullptr;
+        }
     }
 
     inline void removeGNodeAndDelete(NodeType *node) {
@@ -444,6 +488,7 @@ class GenericGraph {
         bool added1 = dstNode->addIncomingEdge(edge);
         bool added2 = srcNode->addOutgoingEdge(edge);
         assert(added1 && added2 && "edge not added on both nodes");
+        unfreeze();
 
         return true;
     }
@@ -525,6 +570,7 @@ class GenericGraph {
 
         srcNode->removeOutgoingEdge(edge);
         dstNode->removeIncomingEdge(edge);
+        unfreeze();
 
         auto id = edge->getId();
         auto it = EdgeToIDMap.find(edge);
@@ -540,8 +586,87 @@ class GenericGraph {
         removeGEdge(edge);
         delete edge;
     }
+
+    /// Remove and delete all the edges of a node. Only the other end of each
+    /// edge is updated one by one, the node's own edge sets are cleared at
+    /// once.
+    inline void removeAllGEdgesAndDelete(NodeType *node) {
+        assert(hasGNode(node) && "node not exists");
+        for (EdgeType *edge : node->getOutEdges()) {
+            /// a self cycle is deleted with the incoming edges
+            if (edge->getDstNode() != node) {
+                edge->getDstNode()->removeIncomingEdge(edge);
+                eraseGEdgeAndDelete(edge);
+            }
+        }
+        for (EdgeType *edge : node->getInEdges()) {
+            if (edge->getSrcNode() != node) {
+                edge->getSrcNode()->removeOutgoingEdge(edge);
+            }
+            eraseGEdgeAndDelete(edge);
+        }
+        node->clearEdges();
+        unfreeze();
+    }
     ///}@
 
+    /// Compacted representation for traversal, see the class comment
+    ///@{
+    /// Build the node index and the CSR edge arrays
+    void freeze() {
+        if (frozen || !buildNodeIndex()) {
+            return;
+        }
+
+        buildCSR(outOffsets, outEdges, true);
+        buildCSR(inOffsets, inEdges, false);
+        frozen = true;
+    }
+
+    /// Build only the node index, which is then kept up to date. Returns
+    /// false if the node IDs are too sparse for a dense index.
+    bool buildNodeIndex() {
+        NodeID numOfIds =
+            IDToNodeMap.empty() ? 0 : IDToNodeMap.rbegin()->first + 1;
+        // Leave graphs with very sparse node IDs to the ID map.
+        if (numOfIds > 2 * IDToNodeMap.size() + 1024) {
+            return false;
+        }
+
+        nodeIndex.assign(numOfIds, nullptr);
+        for (const auto &it : IDToNodeMap) {
+            nodeIndex[it.first] = it.second;
+        }
+        return true;
+    }
+
+    /// Drop the CSR edge arrays, the node index is kept
+    inline void unfreeze() {
+        if (!frozen) {
+            return;
+        }
+
+        frozen = false;
+        std::vector<u32_t>().swap(outOffsets);
+        std::vector<u32_t>().swap(inOffsets);
+        std::vector<EdgeType *>().swap(outEdges);
+        std::vector<EdgeType *>().swap(inEdges);
+    }
+
+    inline bool isFrozen() const { return frozen; }
+
+    /// Edges of node id in the same order as its edge sets.
+    /// Only valid while the graph is frozen.
+    //@{
+    inline FrozenEdgeRange getFrozenOutEdges(NodeID id) const {
+        return getFrozenEdges(outOffsets, outEdges, id);
+    }
+    inline FrozenEdgeRange getFrozenInEdges(NodeID id) const {
+        return getFrozenEdges(inOffsets, inEdges, id);
+    }
+    //@}
+    ///@}
+
     /// Get total number of node/edge
     inline NodeID getTotalNodeNum() const { return IDToNodeMap.size(); }
     inline EdgeID getTotalEdgeNum() const { return IDToEdgeMap.size(); }
@@ -586,6 +711,59 @@ class GenericGraph {
     NodeID currentNodeId = 0;
     EdgeID currentEdgeId = 0;
 
+    /// Node ID -> node, empty until the graph is first frozen
+    std::vector<NodeType *> nodeIndex;
+
+    /// CSR edge arrays: the edges of node id are
+    /// edges[offsets[id]] .. edges[offsets[id + 1] - 1]
+    //@{
+    bool frozen = false;
+    std::vector<u32_t> outOffsets;
+    std::vector<u32_t> inOffsets;
+    std::vector<EdgeType *> outEdges;
+    std::vector<EdgeType *> inEdges;
+    //@}
+
+    /// Drop an edge detached from its nodes from the ID maps and delete it
+    inline void eraseGEdgeAndDelete(EdgeType *edge) {
+        auto it = EdgeToIDMap.find(edge);
+        assert(it != EdgeToIDMap.end() && "edge not exists");
+        EdgeToIDMap.erase(it);
+
+        auto it2 = IDToEdgeMap.find(edge->getId());
+        assert(it2 != IDToEdgeMap.end() && "edge id not exits");
+        IDToEdgeMap.erase(it2);
+
+        delete edge;
+    }
+
+    void buildCSR(std::vector<u32_t> &offsets, std::vector<EdgeType *> &edges,
+                  bool outgoing) {
+        assert(IDToEdgeMap.size() < numeric_limits<u32_t>::max() &&
+               "too many edges to freeze");
+        offsets.assign(nodeIndex.size() + 1, 0);
+        edges.clear();
+        edges.reserve(IDToEdgeMap.size());
+        for (NodeID id = 0; id < nodeIndex.size(); ++id) {
+            offsets[id] = edges.size();
+            if (const NodeType *node = nodeIndex[id]) {
+                const auto &nodeEdges =
+                    outgoing ? node->getOutEdges() : node->getInEdges();
+                edges.insert(edges.end(), nodeEdges.begin(), nodeEdges.end());
+            }
+        }
+        offsets[nodeIndex.size()] = edges.size();
+    }
+
+    inline FrozenEdgeRange
+    getFrozenEdges(const std::vector<u32_t> &offsets,
+                   const std::vector<EdgeType *> &edges, NodeID id) const {
+        assert(frozen && "graph is not frozen");
+        assert(id + 1 < offsets.size() && "Node not found!");
+        const auto *data = edges.data();
+        return FrozenEdgeRange(data + offsets[id], data + offsets[id + 1]);
+    }
+
   private:
     // Allow serialization to access non-public data members.
     friend class boost::serialization::access;
@@ -122,12 +122,8 @@ class ICFG : public GenericICFG {
     void updateCallGraph(PTACallGraph *callgraph);
 
   public:
-    /// Remove a SVFG edge
-    inline void removeICFGEdge(ICFGEdge *edge) {
-        edge->getDstNode()->removeIncomingEdge(edge);
-        edge->getSrcNode()->removeOutgoingEdge(edge);
-        delete edge;
-    }
+    /// Remove and delete an ICFG edge, which unfreezes the graph
+    inline void removeICFGEdge(ICFGEdge *edge) { removeGEdgeAndDelete(edge); }
     /// Remove a ICFGNode
     inline void removeICFGNode(ICFGNode *node) { removeGNode(node); }
 
@@ -0,0 +1,135 @@
+//===- LazySVFG.h -- SVFG built on demand ------------------------------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013-2017>  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * LazySVFG.h
+ *
+ * SVFG whose memory SSA nodes and indirect edges are built per function, the
+ * first time a demand-driven client traverses into the function.
+ */
+
+#ifndef LAZYSVFG_H_
+#define LAZYSVFG_H_
+
+#include "Graphs/SVFG.h"
+
+#include <list>
+
+namespace SVF {
+
+/*!
+ * Sparse value flow graph built on demand.
+ *
+ * The top-level part is built upfront as for SVFG. The address-taken part of
+ * a function, i.e. its memory SSA nodes and indirect edges, is built by
+ * buildIndirectVFOn when a client first reaches a node of the function.
+ * Connecting a function adds its intra-procedural indirect edges and the
+ * inter-procedural ones to its direct callers and callees, whose nodes (but
+ * not edges) are built as needed.
+ *
+ * Connected functions are kept in LRU order. At a query boundary, the
+ * intra-procedural indirect edges of the least recently used functions are
+ * dropped until at most the cache capacity are connected. Nodes and
+ * inter-procedural edges are kept so node IDs and call site connections
+ * stay valid, and a dropped function is reconnected when reached again.
+ */
+class LazySVFG : public SVFG {
+  public:
+    using FunctionList = std::list<const SVFFunction *>;
+    using FunToNodesMap = Map<const SVFFunction *, std::vector<NodeID>>;
+    using FunToBBsMap =
+        Map<const SVFFunction *, std::vector<const BasicBlock *>>;
+    using FunToCallSitesMap =
+        Map<const SVFFunction *, std::vector<const CallBlockNode *>>;
+
+    /// Constructor, capacity 0 keeps all connected functions
+    LazySVFG(MemSSA *mssa, PAG *pag, VFGK k, u32_t capacity = 0)
+        : SVFG(mssa, pag, k), capacity(capacity) {}
+
+    /// Destructor
+    virtual ~LazySVFG() {}
+
+    /// Build the indirect value-flow around a node
+    void buildIndirectVFOn(const SVFGNode *node) override {
+        connectFun(getFunOf(node));
+    }
+
+    /// Build the indirect value-flow of all functions, which are then never
+    /// dropped
+    void buildAllIndirectVF() override;
+
+    /// Drop the least recently used functions beyond the capacity
+    void finishQuery() override;
+
+    /// Connect SVFG nodes between caller and callee for indirect call site
+    void connectCallerAndCallee(const CallBlockNode *cs,
+                                const SVFFunction *callee,
+                                SVFGEdgeSetTy &edges) override;
+
+    /// Number of functions whose nodes/edges are built
+    //@{
+    inline u32_t getNumOfBuiltFuns() const { return builtFuns.size(); }
+    inline u32_t getNumOfConnectedFuns() const { return lru.size(); }
+    //@}
+
+  protected:
+    /// Only collect the memory SSA of each function
+    void buildSVFG() override;
+
+  private:
+    /// Function owning the address-taken part of a node. Global nodes are
+    /// connected to the program entry.
+    inline const SVFFunction *getFunOf(const SVFGNode *node) const {
+        const SVFFunction *fun = node->getFun();
+        return fun != nullptr ? fun : mainFun;
+    }
+
+    /// Create the memory SSA nodes of a function
+    void addFunNodes(const SVFFunction *fun);
+    /// Build the indirect edges of a function and mark it most recently used
+    void connectFun(const SVFFunction *fun);
+    /// Connect the indirect edges of a function whose nodes are built
+    void connectFunEdges(const SVFFunction *fun);
+    /// Drop the intra-procedural indirect edges of a function
+    void disconnectFun(const SVFFunction *fun);
+
+    /// Direct callees of a call site
+    void getDirCallees(const CallBlockNode *cs,
+                       std::vector<const SVFFunction *> &callees) const;
+
+    u32_t capacity;                       ///< connected functions kept
+    bool pinned = false;                  ///< whether nothing is dropped
+    const SVFFunction *mainFun = nullptr; ///< program entry
+
+    FunToNodesMap funToStmtNodes;       ///< loads and stores
+    FunToNodesMap funToMRNodes;         ///< memory SSA nodes with uses
+    FunToBBsMap funToPhiBBs;            ///< blocks with memory SSA phis
+    FunToCallSitesMap funToCallSites;   ///< call sites with mus or chis
+    Set<const SVFFunction *> builtFuns; ///< functions with nodes
+
+    FunctionList lru; ///< connected functions, most recently used first
+    Map<const SVFFunction *, FunctionList::iterator> lruPos;
+};
+
+} // End namespace SVF
+
+#endif /* LAZYSVFG_H_ */
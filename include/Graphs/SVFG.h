@@ -67,6 +67,7 @@ class SVFG : public VFG {
     friend class DDASVFGBuilder;
     friend class MTASVFGBuilder;
     friend class RcSvfgBuilder;
+    friend class SVFGCache;
 
   public:
     using PAGNodeToDefMapTy = Map<PAGNodeID, NodeID>;
@@ -111,6 +112,10 @@ class SVFG : public VFG {
     /// Start building SVFG
     virtual void buildSVFG();
 
+    /// Attach an SVFG loaded from an archive to the analysis it was built
+    /// on. Its memory SSA is not restored.
+    void attachLoadedSVFG(PointerAnalysis *pta);
+
   public:
     /// Constructor
     SVFG(MemSSA *mssa, PAG *pag, VFGK k);
@@ -177,6 +182,17 @@ class SVFG : public VFG {
                                 const SVFFunction *callee,
                                 SVFGEdgeSetTy &edges) override;
 
+    /// Hooks for an SVFG whose indirect value-flow is built on demand (see
+    /// LazySVFG), the whole graph is built upfront here
+    //@{
+    /// Build the indirect edges of a node before they are traversed
+    virtual inline void buildIndirectVFOn(const SVFGNode *) {}
+    /// Build the indirect edges of the whole graph
+    virtual inline void buildAllIndirectVF() {}
+    /// A demand-driven client finished its current query
+    virtual inline void finishQuery() {}
+    //@}
+
     /// Given a pagNode, return its definition site
     inline const SVFGNode *getDefSVFGNode(const PAGNode *pagNode) const {
         return getGNode(VFG::getDef(pagNode));
@@ -54,10 +54,20 @@ namespace SVF {
  * user option.
  */
 class SVFGOPT : public SVFG {
-    using SVFGNodeSet = Set<SVFGNode *>;
+    using SVFGNodeVector = std::vector<SVFGNode *>;
     using NodeIDToNodeIDMap = Map<NodeID, NodeID>;
     using WorkList = FIFOWorkList<const MSSAPHISVFGNode *>;
 
+    /// Indirect edge which bypasses a removed node
+    struct BypassEdge {
+        NodeID src;
+        NodeID dst;
+        SVFGEdge::VFGEdgeK kind; ///< CallIndVF, RetIndVF or IntraIndirectVF
+        CallSiteID csId;
+        PointsTo pts;
+    };
+    using BypassEdges = std::vector<BypassEdge>;
+
   public:
     /// Constructor
     SVFGOPT(MemSSA *_mssa, PAG *pag, VFGK kind) : SVFG(_mssa, pag, kind) {
@@ -174,6 +184,8 @@ class SVFGOPT : public SVFG {
     /// ActualINSVFGNode/FormalINSVFGNode/ActualOUTSVFGNode/FormalOUTSVFGNode if
     /// they
     ///    will not be used when updating call graph.
+    /// The edges bypassing the nodes of 3-5 are collected in parallel (see
+    /// -svfg-opt-threads) and then added in node ID order.
     void handleInterValueFlow();
 
     /// Replace FormalParam/ActualRet node with PHI node.
@@ -185,12 +197,25 @@ class SVFGOPT : public SVFG {
     //@{
     /// Record def sites of actual-in/formal-out and connect from those
     /// def-sites to formal-in/actual-out directly if they exist.
-    void retargetEdgesOfAInFOut(SVFGNode *node);
-    /// Connect actual-out/formal-in's predecessors to their successors
-    /// directly.
-    void retargetEdgesOfAOutFIn(SVFGNode *node);
+    void retargetEdgesOfAInFOut(const SVFGNodeVector &nodes);
+    /// Remove the given parameter nodes which can be removed. The
+    /// predecessors of a removed actual-out/formal-in are connected to its
+    /// successors directly.
+    void removeInterNodes(const SVFGNodeVector &nodes);
+    //@}
+
+    /// Collect the edges bypassing a node. These only read the graph, so
+    /// they can run on several nodes at once.
+    //@{
+    /// Return the def-site of an actual-in/formal-out
+    NodeID collectEdgesOfAInFOut(const SVFGNode *node,
+                                 BypassEdges &edges) const;
+    void collectEdgesOfAOutFIn(const SVFGNode *node, BypassEdges &edges) const;
     //@}
 
+    /// Add collected edges
+    void addBypassEdges(const BypassEdges &edges);
+
     /// Remove MSSAPHI SVFG nodes.
     void handleIntraValueFlow();
 
@@ -309,6 +334,10 @@ class SVFGOPT : public SVFG {
     /// call/ret edges.
     bool isConnectingTwoCallSites(const SVFGNode *node) const;
 
+    /// Return TRUE if the node has an edge from or to one of nodes other than
+    /// itself
+    bool isAdjacentTo(const SVFGNode *node, const NodeBS &nodes) const;
+
     /// Return TRUE if this SVFGNode can be removed.
     /// Nodes can be removed if it is:
     /// 1. ActualParam/FormalParam/ActualRet/FormalRet
@@ -325,8 +354,7 @@ class SVFGOPT : public SVFG {
     /// Remove edges of a SVFG node
     //@{
     inline void removeAllEdges(const SVFGNode *node) {
-        removeInEdges(node);
-        removeOutEdges(node);
+        removeAllGEdgesAndDelete(getGNode(node->getId()));
     }
     inline void removeInEdges(const SVFGNode *node) {
         /// remove incoming edges
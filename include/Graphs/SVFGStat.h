@@ -107,25 +107,48 @@ class SVFGStat : public PTAStat {
 
     virtual void performSCCStat(SVFGEdgeSet insensitiveCalRetEdges);
 
-    void dirVFEdgeStart() { connectDirSVFGEdgeTimeStart = CLOCK_IN_MS(); }
-
-    void dirVFEdgeEnd() { connectDirSVFGEdgeTimeEnd = CLOCK_IN_MS(); }
+    /// Build steps are timed on the wall clock, and recorded as phases of
+    /// the current one
+    //@{
+    void dirVFEdgeStart() { connectDirSVFGEdgeTimeStart = getWallClk(); }
+
+    void dirVFEdgeEnd() {
+        connectDirSVFGEdgeTimeEnd = getWallClk();
+        PhaseTimer::addTime("ConnDirEdge", connectDirSVFGEdgeTimeEnd -
+                                               connectDirSVFGEdgeTimeStart);
+    }
 
-    void indVFEdgeStart() { connectIndSVFGEdgeTimeStart = CLOCK_IN_MS(); }
+    void indVFEdgeStart() { connectIndSVFGEdgeTimeStart = getWallClk(); }
 
-    void indVFEdgeEnd() { connectIndSVFGEdgeTimeEnd = CLOCK_IN_MS(); }
+    void indVFEdgeEnd() {
+        connectIndSVFGEdgeTimeEnd = getWallClk();
+        PhaseTimer::addTime("ConnIndEdge", connectIndSVFGEdgeTimeEnd -
+                                               connectIndSVFGEdgeTimeStart);
+    }
 
-    void TLVFNodeStart() { addTopLevelNodeTimeStart = CLOCK_IN_MS(); }
+    void TLVFNodeStart() { addTopLevelNodeTimeStart = getWallClk(); }
 
-    void TLVFNodeEnd() { addTopLevelNodeTimeEnd = CLOCK_IN_MS(); }
+    void TLVFNodeEnd() {
+        addTopLevelNodeTimeEnd = getWallClk();
+        PhaseTimer::addTime("TLNode",
+                            addTopLevelNodeTimeEnd - addTopLevelNodeTimeStart);
+    }
 
-    void ATVFNodeStart() { addAddrTakenNodeTimeStart = CLOCK_IN_MS(); }
+    void ATVFNodeStart() { addAddrTakenNodeTimeStart = getWallClk(); }
 
-    void ATVFNodeEnd() { addAddrTakenNodeTimeEnd = CLOCK_IN_MS(); }
+    void ATVFNodeEnd() {
+        addAddrTakenNodeTimeEnd = getWallClk();
+        PhaseTimer::addTime("ATNode", addAddrTakenNodeTimeEnd -
+                                          addAddrTakenNodeTimeStart);
+    }
 
-    void sfvgOptStart() { svfgOptTimeStart = CLOCK_IN_MS(); }
+    void sfvgOptStart() { svfgOptTimeStart = getWallClk(); }
 
-    void sfvgOptEnd() { svfgOptTimeEnd = CLOCK_IN_MS(); }
+    void sfvgOptEnd() {
+        svfgOptTimeEnd = getWallClk();
+        PhaseTimer::addTime("Opt", svfgOptTimeEnd - svfgOptTimeStart);
+    }
+    //@}
 
   private:
     void clear();
@@ -143,6 +143,7 @@ class VFG : public GenericVFG {
         ar &PAGNodeToUnaryOPVFGNodeMap;
         ar &PAGNodeToCmpVFGNodeMap;
         ar &PAGEdgeToStmtVFGNodeMap;
+        ar &PAGNodeToDefMap;
         ar &globalVFGNodes;
         ar &kind;
 
@@ -166,6 +167,7 @@ class VFG : public GenericVFG {
         ar &PAGNodeToUnaryOPVFGNodeMap;
         ar &PAGNodeToCmpVFGNodeMap;
         ar &PAGEdgeToStmtVFGNodeMap;
+        ar &PAGNodeToDefMap;
         ar &globalVFGNodes;
         ar &kind;
 
@@ -66,6 +66,11 @@ class MRVer {
     MRVer(const MemRegion *m, MRVERSION v, MSSADef *d)
         : mr(m), version(v), vid(totalVERNum++), def(d) {}
 
+    /// Constructor for versions created apart from the others (e.g., on
+    /// another thread), which get their ID later with renumber
+    MRVer(const MemRegion *m, MRVERSION v, MSSADef *d, MRVERID id)
+        : mr(m), version(v), vid(id), def(d) {}
+
     MRVer() = default;
 
     /// Return the memory region
@@ -74,9 +79,15 @@ class MRVer {
     /// Return SSA version
     inline MRVERSION getSSAVersion() const { return version; }
 
+    /// Return the version ID
+    inline MRVERID getID() const { return vid; }
+
     /// Get MSSADef
     inline MSSADef *getDef() const { return def; }
 
+    /// Give the version the next ID
+    inline void renumber() { vid = totalVERNum++; }
+
   private:
     /// support for serialization
     /// @{
@@ -65,15 +65,68 @@ class DistinctMRG : public MRGenerator {
     void createDistinctMR(const SVFFunction *func, const PointsTo &cpts);
 };
 
+/*!
+ * Partition refinement of a set of objects: the objects are split into the
+ * coarsest classes which none of the refining points-to sets cuts, i.e., two
+ * objects are in the same class iff they are in the same sets. An index from
+ * objects to their classes makes refining with a set linear in its size
+ * (up to the ordering of the classes it touches).
+ */
+class PointsToPartition {
+  public:
+    using ClassID = u32_t;
+    using ClassList = std::vector<ClassID>;
+
+    /// Split the classes cut by pts, and put its objects which are in no
+    /// class yet into a class of their own
+    void refine(const PointsTo &pts);
+
+    /// Classes which have objects in pts (getClassesOf), or only objects in
+    /// pts (getClassesWithin), in ascending order
+    //@{
+    void getClassesOf(const PointsTo &pts, ClassList &classList) const;
+    void getClassesWithin(const PointsTo &pts, ClassList &classList) const;
+    //@}
+
+    /// Return the objects of a class
+    PointsTo getClass(ClassID c) const;
+
+    inline u32_t getNumOfClasses() const { return classes.size(); }
+
+    inline bool hasClass(NodeID obj) const {
+        return objToClassMap.find(obj) != objToClassMap.end();
+    }
+
+  private:
+    /// Objects of each class
+    std::vector<std::vector<NodeID>> classes;
+    /// Class of each object and its position in the class
+    Map<NodeID, std::pair<ClassID, u32_t>> objToClassMap;
+
+    void moveToClass(NodeID obj, ClassID c);
+
+    /// Number of objects of pts in each class it has objects in
+    void countClassesOf(const PointsTo &pts,
+                        OrderedMap<ClassID, u32_t> &counts) const;
+};
+
 /*!
  * Create memory regions which don't have intersections with
  * each other in the same function scope.
  */
 class IntraDisjointMRG : public MRGenerator {
   public:
-    using PtsToSubPtsMap = OrderedMap<PointsTo, PointsToList>;
-    using FunToPtsMap = Map<const SVFFunction *, PtsToSubPtsMap>;
-    using FunToInterMap = Map<const SVFFunction *, PointsToList>;
+    using ClassID = PointsToPartition::ClassID;
+
+    /// Disjoint memory regions: the classes of a partition of objects
+    struct DisjointMRs {
+        PointsToPartition partition;
+        /// Region of each class
+        std::vector<const MemRegion *> classToMR;
+        /// Rank of each class when ordered by points-to set
+        std::vector<u32_t> classToRank;
+    };
+    using FunToDisjointMRsMap = Map<const SVFFunction *, DisjointMRs>;
 
     IntraDisjointMRG(BVDataPTAImpl *p, bool ptrOnly)
         : MRGenerator(p, ptrOnly) {}
@@ -92,43 +145,41 @@ class IntraDisjointMRG : public MRGenerator {
      */
     inline void getMRsForLoad(MRSet &aliasMRs, const PointsTo &cpts,
                               const SVFFunction *fun) override {
-        const PointsToList &inters = getIntersList(fun);
-        getMRsForLoadFromInterList(aliasMRs, cpts, inters);
+        getMRsWithin(aliasMRs, cpts, getDisjointMRs(fun));
     }
 
-    void getMRsForLoadFromInterList(MRSet &mrs, const PointsTo &cpts,
-                                    const PointsToList &inters);
-
     /// Get memory regions to be inserted at a load statement.
     void getMRsForCallSiteRef(MRSet &aliasMRs, const PointsTo &cpts,
                               const SVFFunction *fun) override;
 
-    /// Create disjoint memory region
-    void createDisjointMR(const SVFFunction *func, const PointsTo &cpts);
+    /// Get the regions of fun aliased with cpts, through the classes of its
+    /// objects rather than by checking every region of fun
+    inline void getAliasMemRegions(MRSet &aliasMRs, const PointsTo &cpts,
+                                   const SVFFunction *fun) override {
+        getAliasMRs(aliasMRs, cpts, fun, getDisjointMRs(fun));
+    }
 
-    /// Compute intersections between cpts and computed cpts intersections
-    /// before.
-    void computeIntersections(const PointsTo &cpts, PointsToList &inters);
+    /// Regions of mrs within cpts, or aliased with it in fun
+    //@{
+    void getMRsWithin(MRSet &aliasMRs, const PointsTo &cpts,
+                      const DisjointMRs &mrs);
+    void getAliasMRs(MRSet &aliasMRs, const PointsTo &cpts,
+                     const SVFFunction *fun, const DisjointMRs &mrs);
+    //@}
 
-  private:
-    inline PtsToSubPtsMap &getPtsSubSetMap(const SVFFunction *func) {
-        return funcToPtsMap[func];
-    }
+    /// Order the classes of a refined partition by points-to set, and return
+    /// their points-to sets in that order
+    void rankClasses(DisjointMRs &mrs, std::vector<PointsTo> &rankToPts);
 
-    inline PointsToList &getIntersList(const SVFFunction *func) {
-        return funcToInterMap[func];
-    }
+    /// Create disjoint memory region
+    void createDisjointMR(const SVFFunction *func, const PointsTo &cpts);
 
-    inline const PtsToSubPtsMap &
-    getPtsSubSetMap(const SVFFunction *func) const {
-        auto it = funcToPtsMap.find(func);
-        assert(it != funcToPtsMap.end() &&
-               "can not find pts map for specified function");
-        return it->second;
+  private:
+    inline DisjointMRs &getDisjointMRs(const SVFFunction *func) {
+        return funcToDisjointMRsMap[func];
     }
 
-    FunToPtsMap funcToPtsMap;
-    FunToInterMap funcToInterMap;
+    FunToDisjointMRsMap funcToDisjointMRsMap;
 };
 
 /*!
@@ -154,11 +205,16 @@ class InterDisjointMRG : public IntraDisjointMRG {
      */
     inline void getMRsForLoad(MRSet &aliasMRs, const PointsTo &cpts,
                               const SVFFunction *) override {
-        getMRsForLoadFromInterList(aliasMRs, cpts, inters);
+        getMRsWithin(aliasMRs, cpts, interMRs);
+    }
+
+    inline void getAliasMemRegions(MRSet &aliasMRs, const PointsTo &cpts,
+                                   const SVFFunction *fun) override {
+        getAliasMRs(aliasMRs, cpts, fun, interMRs);
     }
 
   private:
-    PointsToList inters;
+    DisjointMRs interMRs;
 };
 
 } // End namespace SVF
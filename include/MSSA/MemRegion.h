@@ -431,6 +431,12 @@ class MRGenerator {
     inline MRSet &getStoreMRSet(const StorePE *store) {
         return storesToMRsMap[store];
     }
+    inline bool hasLoadMRSet(const LoadPE *load) const {
+        return loadsToMRsMap.find(load) != loadsToMRsMap.end();
+    }
+    inline bool hasStoreMRSet(const StorePE *store) const {
+        return storesToMRsMap.find(store) != storesToMRsMap.end();
+    }
     inline bool hasRefMRSet(const CallBlockNode *cs) {
         return callsiteToRefMRsMap.find(cs) != callsiteToRefMRsMap.end();
     }
@@ -33,6 +33,7 @@
 #include "MSSA/MSSAMuChi.h"
 #include "MSSA/MemRegion.h"
 
+#include <memory>
 #include <vector>
 
 namespace SVF {
@@ -131,6 +132,13 @@ class MemSSA {
     MemRegToVerStackMap mr2VerStackMap;
     MemRegToCounterMap mr2CounterMap;
 
+    /// The Memory SSA this function Memory SSA is merged into (see
+    /// createFunMSSA), and the versions it created, which are numbered then
+    //@{
+    MemSSA *wholeMSSA = nullptr;
+    std::vector<MRVerSPtr> funVersions;
+    //@}
+
     /// The following three set are used for prune SSA phi insertion
     // (see algorithm in book Engineering A Compiler section 9.3)
     ///@{
@@ -142,6 +150,9 @@ class MemSSA {
     MRSet varKills;
     //@}
 
+    /// Constructor of a function Memory SSA
+    explicit MemSSA(MemSSA *whole);
+
     /// Release the memory
     void destroy();
 
@@ -278,6 +289,17 @@ class MemSSA {
     virtual void buildMemSSA(const SVFFunction &fun, DominanceFrontier *,
                              DominatorTree *);
 
+    /// Memory SSA of functions built apart from each other, e.g., on
+    /// several threads. Functions are independent once the memory regions
+    /// are generated: each one gets a Memory SSA of its own, sharing this
+    /// one's regions, whose mus, chis and phis are moved into this one by
+    /// mergeFunMSSA. Merging in a fixed order numbers versions the same way
+    /// whatever the threads.
+    //@{
+    std::unique_ptr<MemSSA> createFunMSSA();
+    void mergeFunMSSA(MemSSA &funMSSA);
+    //@}
+
     /// Perform statistics
     void performStat();
 
@@ -70,10 +70,17 @@ class SVFGBuilder {
     SVFG *buildPTROnlySVFGWithoutOPT(BVDataPTAImpl *pta);
     SVFG *buildFullSVFG(BVDataPTAImpl *pta);
     SVFG *buildFullSVFGWithoutOPT(BVDataPTAImpl *pta);
+    /// Unoptimized pointer-only SVFG whose indirect value-flow is built on
+    /// demand (see LazySVFG)
+    SVFG *buildLazyPTROnlySVFG(BVDataPTAImpl *pta);
 
     /// Get SVFG instance
     inline SVFG *getSVFG() const { return svfg; }
 
+    /// Whether a built SVFG may be taken from or stored to the SVFG cache
+    /// (-svfg-cache-dir). A cached SVFG has no memory SSA.
+    inline void setCacheable(bool c) { cacheable = c; }
+
     /// Mark feasible VF edge by removing it from set vfEdgesAtIndCallSite
     inline void markValidVFEdge(SVFGEdgeSet &edges) {
         for (auto *edge : edges)
@@ -90,10 +97,12 @@ class SVFGBuilder {
 
   protected:
     /// Create a DDA SVFG. By default actualOut and FormalIN are removed, unless
-    /// withAOFI is set true.
-    SVFG *build(BVDataPTAImpl *pta, VFG::VFGK kind);
+    /// withAOFI is set true. A lazy SVFG is only available without OPT.
+    SVFG *build(BVDataPTAImpl *pta, VFG::VFGK kind, bool lazy = false);
     /// Can be rewritten by subclasses
     virtual void buildSVFG();
+    /// Restore the builder's own state about an SVFG loaded from the cache
+    virtual void restoreFromCache(BVDataPTAImpl *) {}
     /// Release global SVFG
     virtual void releaseMemory();
 
@@ -102,6 +111,7 @@ class SVFGBuilder {
     SVFG *svfg = nullptr;
     /// SVFG with precomputed indirect call edges
     bool SVFGWithIndCall;
+    bool cacheable = true;
 };
 
 } // End namespace SVF
@@ -0,0 +1,101 @@
+//===- SVFGCache.h -- On-disk cache of SVFGs ---------------------------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013-2017>  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * SVFGCache.h
+ *
+ * Cache of the pre-analysis points-to sets and SVFGs of a project, in the
+ * directory given by -svfg-cache-dir.
+ */
+
+#ifndef SVFGCACHE_H_
+#define SVFGCACHE_H_
+
+#include "Graphs/SVFG.h"
+
+#include <functional>
+
+namespace SVF {
+
+class BVDataPTAImpl;
+
+/*!
+ * Content-addressed cache of pointer analysis results and SVFGs.
+ *
+ * Entries are named after an MD5 hash of the bitcode of the project's
+ * modules and of the options the result depends on, so a changed program or
+ * option makes a new entry rather than invalidating an old one. Each SVFG
+ * file starts with a header repeating its key, the PAG/ICFG sizes and the
+ * call sites it was built with, which are checked before loading. An entry
+ * which cannot be loaded is rebuilt and overwritten.
+ *
+ * Files are written to a temporary file which is then renamed, so that
+ * concurrent runs sharing the directory never see a partial entry.
+ */
+class SVFGCache {
+  public:
+    /// Format version, bumped whenever the SVFG archive layout changes
+    static const u32_t version = 2;
+
+    /// Cache of the results of a pointer analysis of proj
+    SVFGCache(SVFProject *proj, PointerAnalysis::PTATY ptaTy);
+
+    /// Whether -svfg-cache-dir is set
+    inline bool isEnabled() const { return !dir.empty(); }
+
+    /// Binary points-to file (PointsToFile) of the pointer analysis
+    std::string getPtsFile() const;
+
+    /// Load the SVFG of kind built by builder on pta, or return nullptr
+    SVFG *loadSVFG(BVDataPTAImpl *pta, VFG::VFGK kind,
+                   const std::string &builder) const;
+
+    /// Store svfg, built by builder. Return whether it is stored.
+    bool saveSVFG(const SVFG *svfg, VFG::VFGK kind,
+                  const std::string &builder) const;
+
+    /// Create filename by calling write on a temporary file in the same
+    /// directory, which is renamed to filename if write succeeds
+    static bool
+    writeAtomically(const std::string &filename,
+                    const std::function<bool(const std::string &)> &write);
+
+  private:
+    /// File of the SVFG of kind built by builder
+    std::string getSVFGFile(VFG::VFGK kind, const std::string &builder) const;
+
+    /// Header line of an SVFG file. Besides the PAG and ICFG sizes, it
+    /// records the call site IDs of the call graph, which depend on the order
+    /// the pointer analysis resolved indirect calls in.
+    std::string getSVFGHeader(PAG *pag, const PTACallGraph *callgraph) const;
+
+    /// MD5 hash of the bitcode of the modules of proj
+    static const std::string &getModuleHash(SVFProject *proj);
+
+    SVFProject *proj;
+    std::string dir; ///< cache directory, empty if disabled
+    std::string key; ///< hash of the modules, analysis type and options
+};
+
+} // End namespace SVF
+
+#endif /* SVFGCACHE_H_ */
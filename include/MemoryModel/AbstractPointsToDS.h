@@ -10,13 +10,18 @@
 ///       |                 ^                      |                     |
 ///       |                 |                      |                     |
 /// MutablePTData      [DiffPTData]            [DFPTData] [VersionedPTData]
-///                         ^                      ^                     ^
+/// PersistentPTData        ^                      ^                     ^
 ///                         |                      |                     |
 ///                 MutableDiffPTData        MutableDFPTData
-///                 MutableVersionedPTData
-///                                                ^
-///                                                |
+///                 PersistentDiffPTData     PersistentDFPTData
+///                 MutableVersionedPTData         ^
+///                 PersistentVersionedPTData      |
 ///                                        IncMutableDFPTData
+///                                        PersistentIncDFPTData
+///
+/// Mutable* structures give every key its own points-to set. Persistent*
+/// structures intern points-to sets in a PersistentPointsToCache and store
+/// only PointsToIDs, so equal sets are shared.
 
 #ifndef ABSTRACT_POINTSTO_H_
 #define ABSTRACT_POINTSTO_H_
@@ -51,6 +56,11 @@ class PTData {
         IncMutDataFlow,
         Versioned,
         MutVersioned,
+        PersBase,
+        PersDiff,
+        PersDataFlow,
+        PersIncDataFlow,
+        PersVersioned,
     };
 
     PTData(bool reversePT = true, PTDataTy ty = PTDataTy::Base)
@@ -127,7 +137,8 @@ class DiffPTData : public PTData<Key, KeySet, Data, DataSet> {
     ///@{
     static inline bool classof(const PTData<Key, KeySet, Data, DataSet> *ptd) {
         return ptd->getPTDTY() == PTDataTy::Diff ||
-               ptd->getPTDTY() == PTDataTy::MutDiff;
+               ptd->getPTDTY() == PTDataTy::MutDiff ||
+               ptd->getPTDTY() == PTDataTy::PersDiff;
     }
     ///@}
 };
@@ -208,7 +219,9 @@ class DFPTData : public PTData<Key, KeySet, Data, DataSet> {
     static inline bool classof(const PTData<Key, KeySet, Data, DataSet> *ptd) {
         return ptd->getPTDTY() == BasePTData::DataFlow ||
                ptd->getPTDTY() == BasePTData::MutDataFlow ||
-               ptd->getPTDTY() == BasePTData::IncMutDataFlow;
+               ptd->getPTDTY() == BasePTData::IncMutDataFlow ||
+               ptd->getPTDTY() == BasePTData::PersDataFlow ||
+               ptd->getPTDTY() == BasePTData::PersIncDataFlow;
     }
     ///@}
 };
@@ -248,7 +261,8 @@ class VersionedPTData : public PTData<Key, KeySet, Data, DataSet> {
     ///@{
     static inline bool classof(const PTData<Key, KeySet, Data, DataSet> *ptd) {
         return ptd->getPTDTY() == PTDataTy::Versioned ||
-               ptd->getPTDTY() == PTDataTy::MutVersioned;
+               ptd->getPTDTY() == PTDataTy::MutVersioned ||
+               ptd->getPTDTY() == PTDataTy::PersVersioned;
     }
     ///@}
 };
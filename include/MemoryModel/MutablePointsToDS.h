@@ -314,6 +314,14 @@ class MutableDFPTData : public DFPTData<Key, KeySet, Data, DataSet> {
         return outSet[var];
     }
 
+    /// Create the IN/OUT sets of loc if it has none, so that later updates
+    /// of the sets of loc do not insert into the data-flow maps. The sets of
+    /// different locations may then be updated concurrently.
+    ///@{
+    virtual inline void initDFInSet(LocID loc) { dfInPtsMap[loc]; }
+    virtual inline void initDFOutSet(LocID loc) { dfOutPtsMap[loc]; }
+    ///@}
+
     /// Get internal flow-sensitive data structures.
     ///@{
     inline const PtsMap &getDFInPtsMap(LocID loc) { return dfInPtsMap[loc]; }
@@ -324,14 +332,16 @@ class MutableDFPTData : public DFPTData<Key, KeySet, Data, DataSet> {
 
     inline bool updateDFInFromIn(LocID srcLoc, const Key &srcVar, LocID dstLoc,
                                  const Key &dstVar) override {
-        return this->unionPts(getDFInPtsSet(dstLoc, dstVar),
-                              getDFInPtsSet(srcLoc, srcVar));
+        const DataSet *srcPts = findDFPtsSet(dfInPtsMap, srcLoc, srcVar);
+        return srcPts != nullptr &&
+               this->unionPts(getDFInPtsSet(dstLoc, dstVar), *srcPts);
     }
 
     inline bool updateDFInFromOut(LocID srcLoc, const Key &srcVar, LocID dstLoc,
                                   const Key &dstVar) override {
-        return this->unionPts(getDFInPtsSet(dstLoc, dstVar),
-                              getDFOutPtsSet(srcLoc, srcVar));
+        const DataSet *srcPts = findDFPtsSet(dfOutPtsMap, srcLoc, srcVar);
+        return srcPts != nullptr &&
+               this->unionPts(getDFInPtsSet(dstLoc, dstVar), *srcPts);
     }
 
     inline bool updateDFOutFromIn(LocID srcLoc, const Key &srcVar, LocID dstLoc,
@@ -424,6 +434,20 @@ class MutableDFPTData : public DFPTData<Key, KeySet, Data, DataSet> {
     inline bool addPts(DataSet &d, const Data &e) { return d.test_and_set(e); }
     ///@}
 
+    /// The set of var at loc in dfPtsMap, or nullptr if there is none.
+    /// Unlike getDFInPtsSet/getDFOutPtsSet, never creates an empty set, so
+    /// a source set can be read while other locations are being updated.
+    inline const DataSet *findDFPtsSet(const DFPtsMap &dfPtsMap, LocID loc,
+                                       const Key &var) const {
+        DFPtsMapconstIter it = dfPtsMap.find(loc);
+        if (it == dfPtsMap.end())
+            return nullptr;
+        PtsMapConstIter vit = it->second.find(var);
+        if (vit == it->second.end())
+            return nullptr;
+        return &vit->second;
+    }
+
   public:
     /// Dump the DF IN/OUT set information for debugging purpose
     ///@{
@@ -527,8 +551,8 @@ class IncMutableDFPTData : public MutableDFPTData<Key, KeySet, Data, DataSet> {
     inline bool updateDFInFromIn(LocID srcLoc, const Key &srcVar, LocID dstLoc,
                                  const Key &dstVar) override {
         if (varHasNewDFInPts(srcLoc, srcVar) &&
-            this->unionPts(this->getDFInPtsSet(dstLoc, dstVar),
-                           this->getDFInPtsSet(srcLoc, srcVar))) {
+            BaseMutDFPTData::updateDFInFromIn(srcLoc, srcVar, dstLoc,
+                                              dstVar)) {
             setVarDFInSetUpdated(dstLoc, dstVar);
             return true;
         }
@@ -538,8 +562,8 @@ class IncMutableDFPTData : public MutableDFPTData<Key, KeySet, Data, DataSet> {
     inline bool updateDFInFromOut(LocID srcLoc, const Key &srcVar, LocID dstLoc,
                                   const Key &dstVar) override {
         if (varHasNewDFOutPts(srcLoc, srcVar) &&
-            this->unionPts(this->getDFInPtsSet(dstLoc, dstVar),
-                           this->getDFOutPtsSet(srcLoc, srcVar))) {
+            BaseMutDFPTData::updateDFInFromOut(srcLoc, srcVar, dstLoc,
+                                               dstVar)) {
             setVarDFInSetUpdated(dstLoc, dstVar);
             return true;
         }
@@ -618,6 +642,15 @@ class IncMutableDFPTData : public MutableDFPTData<Key, KeySet, Data, DataSet> {
         return false;
     }
 
+    inline void initDFInSet(LocID loc) override {
+        BaseMutDFPTData::initDFInSet(loc);
+        inUpdatedVarMap[loc];
+    }
+    inline void initDFOutSet(LocID loc) override {
+        BaseMutDFPTData::initDFOutSet(loc);
+        outUpdatedVarMap[loc];
+    }
+
     inline void clearAllDFOutUpdatedVar(LocID loc) override {
         if (this->hasDFOutSet(loc)) {
             DataSet pts = getDFOutUpdatedVar(loc);
@@ -32,6 +32,7 @@
 
 #include "Util/BasicTypes.h"
 #include "Util/Options.h"
+#include <chrono>
 #include <iostream>
 #include <map>
 #include <string>
@@ -42,6 +43,46 @@ namespace SVF {
 
 class PointerAnalysis;
 
+/// Wall-clock and CPU time (ms) spent in a phase, how many times it ran, and
+/// the largest resident set size (KB) seen when it finished
+struct PhaseTime {
+    double wallTime = 0;
+    double cpuTime = 0;
+    u32_t count = 0;
+    u32_t maxRSS = 0;
+};
+
+/*!
+ * Times its scope as a phase nested in the phases open on the same thread,
+ * e.g. "FlowSensitive/Andersen/SCCDetect". Phases are kept for the whole
+ * process, so those run before an analysis creates its statistics (like
+ * building the PAG) are exported with them. Use it for coarse phases only:
+ * each one reads the CPU clock and the resident set size.
+ */
+class PhaseTimer {
+  public:
+    explicit PhaseTimer(const std::string &name);
+    ~PhaseTimer();
+
+    PhaseTimer(const PhaseTimer &) = delete;
+    PhaseTimer &operator=(const PhaseTimer &) = delete;
+
+    /// Add wall-clock time (ms) measured elsewhere to a phase nested in the
+    /// current one, for fine-grained work timed with PTAStat::getClk
+    static void addTime(const std::string &name, double wallTime,
+                        u32_t count = 1);
+
+    using PhaseTimeMap = OrderedMap<std::string, PhaseTime>;
+
+    /// All phases by path
+    static PhaseTimeMap getPhaseTimes();
+
+  private:
+    std::string parent;
+    double wallStart;
+    double cpuStart;
+};
+
 /*!
  * Pointer Analysis Statistics
  */
@@ -146,8 +187,8 @@ class PTAStat {
     explicit PTAStat(PointerAnalysis *p);
     virtual ~PTAStat() {}
 
-    virtual inline void startClk() { startTime = CLOCK_IN_MS(); }
-    virtual inline void endClk() { endTime = CLOCK_IN_MS(); }
+    virtual inline void startClk() { startTime = getWallClk(); }
+    virtual inline void endClk() { endTime = getWallClk(); }
     /// When mark is true, real clock is always returned. When mark is false, it
     /// is only returned when Options::MarkedClocksOnly is not set. Default call
     /// for getClk is unmarked, while MarkedClocksOnly is false by default.
@@ -156,9 +197,21 @@ class PTAStat {
             return 0.0;
         }
 
-        return CLOCK_IN_MS();
+        return getWallClk();
     }
 
+    /// Monotonic wall-clock time in ms. Unlike CLOCK_IN_MS, it does not add
+    /// up the time of every thread and has sub-millisecond resolution.
+    static inline double getWallClk() {
+        using namespace std::chrono;
+        return duration<double, std::milli>(
+                   steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    /// CPU time in ms of all threads of the process
+    static double getCPUClk();
+
     NUMStatMap generalNumMap;
     NUMStatMap PTNumStatMap;
     TIMEStatMap timeStatMap;
@@ -182,6 +235,11 @@ class PTAStat {
     void bitcastInstStat();
     void branchStat();
 
+    /// Add the current maps as a section of the file given by
+    /// -stat-export and rewrite it (CSV if its name ends in .csv, JSON
+    /// otherwise) with every section exported so far
+    void exportStat(const std::string &statname);
+
     PointerAnalysis *pta;
     std::string moduleName;
 };
@@ -0,0 +1,299 @@
+//===- PersistentPointsToCache.h -- Persistent points-to sets ----------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/// Unique table of points-to sets. Every distinct points-to set is stored
+/// exactly once and handed out as a PointsToID. Set operations work on IDs
+/// and their results are memoised, so the same union/intersection/complement
+/// is only ever computed once.
+
+#ifndef PERSISTENT_POINTSTO_CACHE_H_
+#define PERSISTENT_POINTSTO_CACHE_H_
+
+#include "Util/SVFBasicTypes.h"
+#include "Util/SVFUtil.h"
+
+#include <iomanip>
+#include <iostream>
+
+namespace SVF {
+
+/// Persistent points-to set store. Can be used as a backing for points-to
+/// data structures like PersistentPTData, PersistentDFPTData, etc. Hides
+/// points-to sets from users and hands out PointsToIDs instead.
+/// Data is the points-to set type (e.g. PointsTo).
+template <typename Data>
+class PersistentPointsToCache {
+  public:
+    using PtsToIDMap = Map<Data, PointsToID>;
+    /// Operations are cached on ID pairs. Commutative operations are keyed on
+    /// the ordered pair so (a, b) and (b, a) share an entry.
+    using OpCache = Map<std::pair<PointsToID, PointsToID>, PointsToID>;
+
+    /// The empty points-to set is always ID 0.
+    static inline PointsToID emptyPointsToId() { return 0; }
+
+    PersistentPointsToCache() { reset(); }
+
+    /// Resets the cache removing everything except the empty points-to set.
+    void reset() {
+        idToPts.clear();
+        ptsToId.clear();
+        unionCache.clear();
+        complementCache.clear();
+        intersectionCache.clear();
+
+        totalUnions = uniqueUnions = propertyUnions = lookupUnions = 0;
+        totalComplements = uniqueComplements = propertyComplements =
+            lookupComplements = 0;
+        totalIntersections = uniqueIntersections = propertyIntersections =
+            lookupIntersections = 0;
+
+        // ID 0 is reserved for the empty points-to set.
+        PointsToID emptyId = emplacePts(Data());
+        (void)emptyId;
+        assert(emptyId == emptyPointsToId() &&
+               "PersistentPointsToCache::reset: empty set is not ID 0!");
+    }
+
+    /// If pts is not in the cache, inserts it and assigns a new ID.
+    /// Returns the ID of pts.
+    PointsToID emplacePts(const Data &pts) {
+        auto it = ptsToId.find(pts);
+        if (it != ptsToId.end()) {
+            return it->second;
+        }
+
+        PointsToID id = idToPts.size();
+        auto inserted = ptsToId.emplace(pts, id);
+        // Keys of an unordered_map are never moved, so we can point at them
+        // rather than storing every set twice.
+        idToPts.push_back(&inserted.first->first);
+        return id;
+    }
+
+    /// Returns the points-to set which id represents. id must have been
+    /// handed out by this cache.
+    inline const Data &getActualPts(PointsToID id) const {
+        assert(id < idToPts.size() &&
+               "PersistentPointsToCache::getActualPts: unknown ID!");
+        return *idToPts[id];
+    }
+
+    /// Returns the ID of the union of lhs and rhs.
+    PointsToID unionPts(PointsToID lhs, PointsToID rhs) {
+        ++totalUnions;
+
+        // Cheap properties which need no lookup at all.
+        if (lhs == rhs || rhs == emptyPointsToId()) {
+            ++propertyUnions;
+            return lhs;
+        }
+        if (lhs == emptyPointsToId()) {
+            ++propertyUnions;
+            return rhs;
+        }
+
+        std::pair<PointsToID, PointsToID> operands = orderedPair(lhs, rhs);
+        auto foundResult = unionCache.find(operands);
+        if (foundResult != unionCache.end()) {
+            ++lookupUnions;
+            return foundResult->second;
+        }
+
+        ++uniqueUnions;
+        Data result = getActualPts(lhs);
+        result |= getActualPts(rhs);
+        PointsToID resultId = emplacePts(result);
+        unionCache[operands] = resultId;
+
+        // result is a superset of both operands, so any further union of
+        // result with either operand is result itself.
+        if (resultId != lhs) {
+            unionCache[orderedPair(resultId, lhs)] = resultId;
+            intersectionCache[orderedPair(resultId, lhs)] = lhs;
+        }
+        if (resultId != rhs) {
+            unionCache[orderedPair(resultId, rhs)] = resultId;
+            intersectionCache[orderedPair(resultId, rhs)] = rhs;
+        }
+
+        return resultId;
+    }
+
+    /// Returns the ID of lhs - rhs (relative complement of rhs in lhs).
+    PointsToID complementPts(PointsToID lhs, PointsToID rhs) {
+        ++totalComplements;
+
+        if (lhs == rhs || lhs == emptyPointsToId()) {
+            ++propertyComplements;
+            return emptyPointsToId();
+        }
+        if (rhs == emptyPointsToId()) {
+            ++propertyComplements;
+            return lhs;
+        }
+
+        std::pair<PointsToID, PointsToID> operands = std::make_pair(lhs, rhs);
+        auto foundResult = complementCache.find(operands);
+        if (foundResult != complementCache.end()) {
+            ++lookupComplements;
+            return foundResult->second;
+        }
+
+        ++uniqueComplements;
+        Data result;
+        result.intersectWithComplement(getActualPts(lhs), getActualPts(rhs));
+        PointsToID resultId = emplacePts(result);
+        complementCache[operands] = resultId;
+
+        // Nothing of rhs is left in the result.
+        if (resultId != emptyPointsToId()) {
+            intersectionCache[orderedPair(resultId, rhs)] = emptyPointsToId();
+        }
+
+        return resultId;
+    }
+
+    /// Returns the ID of the intersection of lhs and rhs.
+    PointsToID intersectPts(PointsToID lhs, PointsToID rhs) {
+        ++totalIntersections;
+
+        if (lhs == rhs) {
+            ++propertyIntersections;
+            return lhs;
+        }
+        if (lhs == emptyPointsToId() || rhs == emptyPointsToId()) {
+            ++propertyIntersections;
+            return emptyPointsToId();
+        }
+
+        std::pair<PointsToID, PointsToID> operands = orderedPair(lhs, rhs);
+        auto foundResult = intersectionCache.find(operands);
+        if (foundResult != intersectionCache.end()) {
+            ++lookupIntersections;
+            return foundResult->second;
+        }
+
+        ++uniqueIntersections;
+        Data result = getActualPts(lhs);
+        result &= getActualPts(rhs);
+        PointsToID resultId = emplacePts(result);
+        intersectionCache[operands] = resultId;
+
+        // result is a subset of both operands.
+        if (resultId != lhs) {
+            unionCache[orderedPair(resultId, lhs)] = lhs;
+            intersectionCache[orderedPair(resultId, lhs)] = resultId;
+        }
+        if (resultId != rhs) {
+            unionCache[orderedPair(resultId, rhs)] = rhs;
+            intersectionCache[orderedPair(resultId, rhs)] = resultId;
+        }
+
+        return resultId;
+    }
+
+    /// Number of distinct points-to sets (including the empty set).
+    inline size_t getNumberOfPointsToSets() const { return idToPts.size(); }
+
+    /// Print statistics on operations and points-to set numbers.
+    void printStats(const std::string &subtitle) const {
+        static const unsigned fieldWidth = 25;
+        std::cout.flags(std::ios::left);
+
+        std::cout << "****Persistent Points-To Cache Statistics: " << subtitle
+                  << "****\n";
+        std::cout << std::setw(fieldWidth) << "UniquePointsToSets"
+                  << idToPts.size() << "\n";
+
+        std::cout << std::setw(fieldWidth) << "TotalUnions" << totalUnions
+                  << "\n";
+        std::cout << std::setw(fieldWidth) << "PropertyUnions"
+                  << propertyUnions << "\n";
+        std::cout << std::setw(fieldWidth) << "UniqueUnions" << uniqueUnions
+                  << "\n";
+        std::cout << std::setw(fieldWidth) << "LookupUnions" << lookupUnions
+                  << "\n";
+
+        std::cout << std::setw(fieldWidth) << "TotalComplements"
+                  << totalComplements << "\n";
+        std::cout << std::setw(fieldWidth) << "PropertyComplements"
+                  << propertyComplements << "\n";
+        std::cout << std::setw(fieldWidth) << "UniqueComplements"
+                  << uniqueComplements << "\n";
+        std::cout << std::setw(fieldWidth) << "LookupComplements"
+                  << lookupComplements << "\n";
+
+        std::cout << std::setw(fieldWidth) << "TotalIntersections"
+                  << totalIntersections << "\n";
+        std::cout << std::setw(fieldWidth) << "PropertyIntersections"
+                  << propertyIntersections << "\n";
+        std::cout << std::setw(fieldWidth) << "UniqueIntersections"
+                  << uniqueIntersections << "\n";
+        std::cout << std::setw(fieldWidth) << "LookupIntersections"
+                  << lookupIntersections << "\n";
+
+        std::cout.flush();
+    }
+
+  private:
+    static inline std::pair<PointsToID, PointsToID>
+    orderedPair(PointsToID a, PointsToID b) {
+        return a < b ? std::make_pair(a, b) : std::make_pair(b, a);
+    }
+
+  private:
+    /// Maps points-to IDs (indices) to their corresponding points-to set.
+    /// The pointers are owned by ptsToId (they point at its keys).
+    std::vector<const Data *> idToPts;
+    /// Maps points-to sets to their corresponding ID.
+    PtsToIDMap ptsToId;
+
+    /// Maps two IDs to their union result.
+    OpCache unionCache;
+    /// Maps two IDs to their relative complement result.
+    OpCache complementCache;
+    /// Maps two IDs to their intersection result.
+    OpCache intersectionCache;
+
+    /// Statistics
+    ///@{
+    u64_t totalUnions;
+    u64_t uniqueUnions;
+    u64_t propertyUnions;
+    u64_t lookupUnions;
+
+    u64_t totalComplements;
+    u64_t uniqueComplements;
+    u64_t propertyComplements;
+    u64_t lookupComplements;
+
+    u64_t totalIntersections;
+    u64_t uniqueIntersections;
+    u64_t propertyIntersections;
+    u64_t lookupIntersections;
+    ///@}
+};
+
+} // End namespace SVF
+
+#endif // PERSISTENT_POINTSTO_CACHE_H_
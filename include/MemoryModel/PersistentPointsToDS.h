@@ -0,0 +1,762 @@
+/// PTData (AbstractPointsToDS.h) implementations with a persistent backend.
+/// Each Key is given a cheap points-to ID which refers to some real points-to
+/// set interned in a PersistentPointsToCache. Identical points-to sets are
+/// stored once, no matter how many keys (or PTData objects) refer to them.
+
+#ifndef PERSISTENT_POINTSTO_H_
+#define PERSISTENT_POINTSTO_H_
+
+#include "MemoryModel/AbstractPointsToDS.h"
+#include "MemoryModel/MutablePointsToDS.h"
+#include "MemoryModel/PersistentPointsToCache.h"
+#include "Util/SVFBasicTypes.h"
+#include "Util/SVFUtil.h"
+
+namespace SVF {
+
+template <typename Key, typename KeySet, typename Data, typename DataSet>
+class PersistentDFPTData;
+template <typename Key, typename KeySet, typename Data, typename DataSet>
+class PersistentIncDFPTData;
+template <typename Key, typename KeySet, typename Data, typename DataSet,
+          typename VersionedKey, typename VersionedKeySet>
+class PersistentVersionedPTData;
+
+/// PTData backed by a PersistentPointsToCache.
+template <typename Key, typename KeySet, typename Data, typename DataSet>
+class PersistentPTData : public PTData<Key, KeySet, Data, DataSet> {
+    template <typename K, typename KS, typename D, typename DS>
+    friend class PersistentDFPTData;
+    template <typename K, typename KS, typename D, typename DS>
+    friend class PersistentIncDFPTData;
+    template <typename K, typename KS, typename D, typename DS, typename VK,
+              typename VKS>
+    friend class PersistentVersionedPTData;
+
+  public:
+    using BasePTData = PTData<Key, KeySet, Data, DataSet>;
+    using PTDataTy = typename BasePTData::PTDataTy;
+
+    using KeyToIDMap = Map<Key, PointsToID>;
+    using RevPtsMap = Map<Data, KeySet>;
+
+    /// Constructor. The cache is not owned and must outlive this object.
+    PersistentPTData(PersistentPointsToCache<DataSet> &cache,
+                     bool reversePT = true, PTDataTy ty = PTDataTy::PersBase)
+        : BasePTData(reversePT, ty), ptCache(cache) {}
+
+    virtual ~PersistentPTData() {}
+
+    inline void clear() override {
+        ptsMap.clear();
+        revPtsMap.clear();
+    }
+
+    inline const DataSet &getPts(const Key &var) override {
+        return ptCache.getActualPts(getPtsId(var));
+    }
+
+    inline const KeySet &getRevPts(const Data &datum) override {
+        assert(this->rev && "PersistentPTData::getRevPts: constructed without "
+                            "reverse PT support!");
+        return revPtsMap[datum];
+    }
+
+    inline bool addPts(const Key &dstKey, const Data &element) override {
+        DataSet srcPts;
+        srcPts.set(element);
+        PointsToID srcId = ptCache.emplacePts(srcPts);
+        return unionPtsFromId(dstKey, srcId);
+    }
+
+    inline bool unionPts(const Key &dstKey, const Key &srcKey) override {
+        return unionPtsFromId(dstKey, getPtsId(srcKey));
+    }
+
+    inline bool unionPts(const Key &dstKey,
+                         const DataSet &srcDataSet) override {
+        return unionPtsFromId(dstKey, ptCache.emplacePts(srcDataSet));
+    }
+
+    inline void dumpPTData() override { dumpPts(SVFUtil::outs()); }
+
+    void clearPts(const Key &var, const Data &element) override {
+        DataSet toRemove;
+        toRemove.set(element);
+        PointsToID toRemoveId = ptCache.emplacePts(toRemove);
+        PointsToID &varId = ptsMap[var];
+        varId = ptCache.complementPts(varId, toRemoveId);
+    }
+
+    void clearFullPts(const Key &var) override {
+        ptsMap[var] = PersistentPointsToCache<DataSet>::emptyPointsToId();
+    }
+
+    /// Methods to support type inquiry through isa, cast, and dyn_cast:
+    ///@{
+    static inline bool classof(const PTData<Key, KeySet, Data, DataSet> *ptd) {
+        return ptd->getPTDTY() == PTDataTy::PersBase;
+    }
+    ///@}
+
+  protected:
+    /// Return the points-to ID of var, the empty set if it has none.
+    inline PointsToID getPtsId(const Key &var) const {
+        auto it = ptsMap.find(var);
+        if (it == ptsMap.end()) {
+            return PersistentPointsToCache<DataSet>::emptyPointsToId();
+        }
+        return it->second;
+    }
+
+    /// pts(dstKey) = pts(dstKey) U pts(srcId). Maintains reverse points-to.
+    inline bool unionPtsFromId(const Key &dstKey, PointsToID srcId) {
+        PointsToID &dstId = ptsMap[dstKey];
+        PointsToID newDstId = ptCache.unionPts(dstId, srcId);
+
+        bool changed = newDstId != dstId;
+        if (changed) {
+            dstId = newDstId;
+            // Reverse points-to only needs to change if pts(dstKey) changed.
+            if (this->rev) {
+                for (const Data &d : ptCache.getActualPts(srcId)) {
+                    insertKey<Key, KeySet>(dstKey, revPtsMap[d]);
+                }
+            }
+        }
+
+        return changed;
+    }
+
+    virtual inline void dumpPts(raw_ostream &O) const {
+        for (auto it = ptsMap.begin(); it != ptsMap.end(); ++it) {
+            const Key &var = it->first;
+            const DataSet &pts = ptCache.getActualPts(it->second);
+            if (pts.empty())
+                continue;
+            O << var << " ==> { ";
+            for (typename DataSet::iterator cit = pts.begin(), ecit = pts.end();
+                 cit != ecit; ++cit) {
+                O << *cit << " ";
+            }
+            O << "}\n";
+        }
+    }
+
+  protected:
+    PersistentPointsToCache<DataSet> &ptCache;
+    KeyToIDMap ptsMap;
+    RevPtsMap revPtsMap;
+};
+
+/// DiffPTData implemented with a persistent backend. Diff and propagated
+/// points-to sets are IDs too, so computing them costs a cached complement.
+template <typename Key, typename KeySet, typename Data, typename DataSet>
+class PersistentDiffPTData : public DiffPTData<Key, KeySet, Data, DataSet> {
+  public:
+    using BasePTData = PTData<Key, KeySet, Data, DataSet>;
+    using BaseDiffPTData = DiffPTData<Key, KeySet, Data, DataSet>;
+    using PTDataTy = typename BasePTData::PTDataTy;
+    using KeyToIDMap =
+        typename PersistentPTData<Key, KeySet, Data, DataSet>::KeyToIDMap;
+
+    /// Constructor
+    PersistentDiffPTData(PersistentPointsToCache<DataSet> &cache,
+                         bool reversePT = true,
+                         PTDataTy ty = PTDataTy::PersDiff)
+        : BaseDiffPTData(reversePT, ty), ptCache(cache),
+          persPTData(cache, reversePT) {}
+
+    virtual ~PersistentDiffPTData() {}
+
+    inline void clear() override {
+        persPTData.clear();
+        diffPtsMap.clear();
+        propaPtsMap.clear();
+    }
+
+    inline const DataSet &getPts(const Key &var) override {
+        return persPTData.getPts(var);
+    }
+
+    inline const KeySet &getRevPts(const Data &datum) override {
+        assert(this->rev && "PersistentDiffPTData::getRevPts: constructed "
+                            "without reverse PT support!");
+        return persPTData.getRevPts(datum);
+    }
+
+    inline bool addPts(const Key &dstKey, const Data &element) override {
+        return persPTData.addPts(dstKey, element);
+    }
+
+    inline bool unionPts(const Key &dstKey, const Key &srcKey) override {
+        return persPTData.unionPts(dstKey, srcKey);
+    }
+
+    inline bool unionPts(const Key &dstKey,
+                         const DataSet &srcDataSet) override {
+        return persPTData.unionPts(dstKey, srcDataSet);
+    }
+
+    void clearPts(const Key &var, const Data &element) override {
+        persPTData.clearPts(var, element);
+    }
+
+    void clearFullPts(const Key &var) override { persPTData.clearFullPts(var); }
+
+    inline void dumpPTData() override { persPTData.dumpPTData(); }
+
+    inline const DataSet &getDiffPts(Key &var) override {
+        return ptCache.getActualPts(diffPtsMap[var]);
+    }
+
+    inline bool computeDiffPts(Key &var, const DataSet &all) override {
+        PointsToID allId = ptCache.emplacePts(all);
+        PointsToID &propaId = propaPtsMap[var];
+        /// diff = all - propa, then propa = all.
+        PointsToID diffId = ptCache.complementPts(allId, propaId);
+        diffPtsMap[var] = diffId;
+        propaId = allId;
+        return diffId != PersistentPointsToCache<DataSet>::emptyPointsToId();
+    }
+
+    inline void updatePropaPtsMap(Key &src, Key &dst) override {
+        PointsToID &dstPropa = propaPtsMap[dst];
+        dstPropa = ptCache.intersectPts(dstPropa, propaPtsMap[src]);
+    }
+
+    inline void clearPropaPts(Key &var) override {
+        propaPtsMap[var] = PersistentPointsToCache<DataSet>::emptyPointsToId();
+    }
+
+    /// Methods to support type inquiry through isa, cast, and dyn_cast:
+    ///@{
+    static inline bool classof(const PTData<Key, KeySet, Data, DataSet> *ptd) {
+        return ptd->getPTDTY() == PTDataTy::PersDiff;
+    }
+    ///@}
+
+  private:
+    PersistentPointsToCache<DataSet> &ptCache;
+    /// Backing to implement the basic PTData methods. This allows us to avoid
+    /// multiple-inheritance.
+    PersistentPTData<Key, KeySet, Data, DataSet> persPTData;
+    /// Diff points-to to be propagated.
+    KeyToIDMap diffPtsMap;
+    /// Points-to already propagated.
+    KeyToIDMap propaPtsMap;
+};
+
+/// DFPTData backed by a PersistentPointsToCache. IN/OUT sets of different
+/// locations are frequently identical and are shared through the cache.
+template <typename Key, typename KeySet, typename Data, typename DataSet>
+class PersistentDFPTData : public DFPTData<Key, KeySet, Data, DataSet> {
+  public:
+    using BasePTData = PTData<Key, KeySet, Data, DataSet>;
+    using BasePersPTData = PersistentPTData<Key, KeySet, Data, DataSet>;
+    using BaseDFPTData = DFPTData<Key, KeySet, Data, DataSet>;
+    using PTDataTy = typename BasePTData::PTDataTy;
+
+    using LocID = typename BaseDFPTData::LocID;
+    using KeyToIDMap = typename BasePersPTData::KeyToIDMap;
+    using DFKeyToIDMap = Map<LocID, KeyToIDMap>;
+
+    /// Constructor
+    PersistentDFPTData(PersistentPointsToCache<DataSet> &cache,
+                       bool reversePT = true,
+                       PTDataTy ty = BaseDFPTData::PersDataFlow)
+        : BaseDFPTData(reversePT, ty), ptCache(cache),
+          persPTData(cache, reversePT) {}
+
+    virtual ~PersistentDFPTData() {}
+
+    inline void clear() override {
+        persPTData.clear();
+        dfInPtsMap.clear();
+        dfOutPtsMap.clear();
+    }
+
+    inline const DataSet &getPts(const Key &var) override {
+        return persPTData.getPts(var);
+    }
+
+    inline const KeySet &getRevPts(const Data &datum) override {
+        assert(this->rev && "PersistentDFPTData::getRevPts: constructed "
+                            "without reverse PT support!");
+        return persPTData.getRevPts(datum);
+    }
+
+    inline bool hasDFInSet(LocID loc) const override {
+        return dfInPtsMap.find(loc) != dfInPtsMap.end();
+    }
+
+    inline bool hasDFOutSet(LocID loc) const override {
+        return dfOutPtsMap.find(loc) != dfOutPtsMap.end();
+    }
+
+    inline bool hasDFInSet(LocID loc, const Key &var) const override {
+        auto it = dfInPtsMap.find(loc);
+        if (it == dfInPtsMap.end())
+            return false;
+        return it->second.find(var) != it->second.end();
+    }
+
+    inline bool hasDFOutSet(LocID loc, const Key &var) const override {
+        auto it = dfOutPtsMap.find(loc);
+        if (it == dfOutPtsMap.end())
+            return false;
+        return it->second.find(var) != it->second.end();
+    }
+
+    inline const DataSet &getDFInPtsSet(LocID loc, const Key &var) override {
+        return ptCache.getActualPts(dfInPtsMap[loc][var]);
+    }
+
+    inline const DataSet &getDFOutPtsSet(LocID loc, const Key &var) override {
+        return ptCache.getActualPts(dfOutPtsMap[loc][var]);
+    }
+
+    inline bool updateDFInFromIn(LocID srcLoc, const Key &srcVar, LocID dstLoc,
+                                 const Key &dstVar) override {
+        return unionPtsThroughIds(dfInPtsMap[dstLoc][dstVar],
+                                  dfInPtsMap[srcLoc][srcVar]);
+    }
+
+    inline bool updateDFInFromOut(LocID srcLoc, const Key &srcVar, LocID dstLoc,
+                                  const Key &dstVar) override {
+        return unionPtsThroughIds(dfInPtsMap[dstLoc][dstVar],
+                                  dfOutPtsMap[srcLoc][srcVar]);
+    }
+
+    inline bool updateDFOutFromIn(LocID srcLoc, const Key &srcVar, LocID dstLoc,
+                                  const Key &dstVar) override {
+        return unionPtsThroughIds(dfOutPtsMap[dstLoc][dstVar],
+                                  dfInPtsMap[srcLoc][srcVar]);
+    }
+
+    inline bool updateAllDFInFromOut(LocID srcLoc, const Key &srcVar,
+                                     LocID dstLoc, const Key &dstVar) override {
+        return this->updateDFInFromOut(srcLoc, srcVar, dstLoc, dstVar);
+    }
+
+    inline bool updateAllDFInFromIn(LocID srcLoc, const Key &srcVar,
+                                    LocID dstLoc, const Key &dstVar) override {
+        return this->updateDFInFromIn(srcLoc, srcVar, dstLoc, dstVar);
+    }
+
+    inline bool updateAllDFOutFromIn(LocID loc, const Key &singleton,
+                                     bool strongUpdates) override {
+        bool changed = false;
+        if (this->hasDFInSet(loc)) {
+            /// Only variables has new pts from IN set need to be updated.
+            const KeyToIDMap &ptsMap = dfInPtsMap[loc];
+            for (auto ptsIt = ptsMap.begin(), ptsEit = ptsMap.end();
+                 ptsIt != ptsEit; ++ptsIt) {
+                const Key var = ptsIt->first;
+                /// Enable strong updates if it is required to do so
+                if (strongUpdates && var == singleton) {
+                    continue;
+                }
+
+                if (updateDFOutFromIn(loc, var, loc, var)) {
+                    changed = true;
+                }
+            }
+        }
+        return changed;
+    }
+
+    inline bool updateTLVPts(LocID srcLoc, const Key &srcVar,
+                             const Key &dstVar) override {
+        return persPTData.unionPtsFromId(dstVar, dfInPtsMap[srcLoc][srcVar]);
+    }
+
+    inline bool updateATVPts(const Key &srcVar, LocID dstLoc,
+                             const Key &dstVar) override {
+        return unionPtsThroughIds(dfOutPtsMap[dstLoc][dstVar],
+                                  persPTData.getPtsId(srcVar));
+    }
+
+    inline void clearAllDFOutUpdatedVar(LocID) override {}
+
+    /// Override the methods defined in PTData.
+    /// Union/add points-to without adding reverse points-to, used internally
+    ///@{
+    inline bool addPts(const Key &dstKey, const Data &element) override {
+        DataSet srcPts;
+        srcPts.set(element);
+        return unionPtsThroughIds(persPTData.ptsMap[dstKey],
+                                  ptCache.emplacePts(srcPts));
+    }
+
+    inline bool unionPts(const Key &dstKey, const Key &srcKey) override {
+        return unionPtsThroughIds(persPTData.ptsMap[dstKey],
+                                  persPTData.getPtsId(srcKey));
+    }
+
+    inline bool unionPts(const Key &dstKey,
+                         const DataSet &srcDataSet) override {
+        return unionPtsThroughIds(persPTData.ptsMap[dstKey],
+                                  ptCache.emplacePts(srcDataSet));
+    }
+
+    void clearPts(const Key &var, const Data &element) override {
+        persPTData.clearPts(var, element);
+    }
+
+    void clearFullPts(const Key &var) override { persPTData.clearFullPts(var); }
+    ///@}
+
+    /// Methods to support type inquiry through isa, cast, and dyn_cast:
+    ///@{
+    static inline bool classof(const PTData<Key, KeySet, Data, DataSet> *ptd) {
+        return ptd->getPTDTY() == BaseDFPTData::PersDataFlow ||
+               ptd->getPTDTY() == BaseDFPTData::PersIncDataFlow;
+    }
+    ///@}
+
+    inline void dumpPTData() override {
+        /// dump points-to of top-level pointers
+        persPTData.dumpPTData();
+        /// dump points-to of address-taken variables
+        NodeBS locs;
+        for (auto it = dfInPtsMap.begin(); it != dfInPtsMap.end(); ++it)
+            locs.set(it->first);
+        for (auto it = dfOutPtsMap.begin(); it != dfOutPtsMap.end(); ++it)
+            locs.set(it->first);
+
+        for (auto loc : locs) {
+            if (this->hasDFInSet(loc)) {
+                SVFUtil::outs() << "Loc:" << loc << " IN:{";
+                dumpPts(dfInPtsMap[loc], SVFUtil::outs());
+                SVFUtil::outs() << "}\n";
+            }
+
+            if (this->hasDFOutSet(loc)) {
+                SVFUtil::outs() << "Loc:" << loc << " OUT:{";
+                dumpPts(dfOutPtsMap[loc], SVFUtil::outs());
+                SVFUtil::outs() << "}\n";
+            }
+        }
+    }
+
+  protected:
+    /// dst = dst U src, where both are points-to IDs.
+    inline bool unionPtsThroughIds(PointsToID &dst, PointsToID src) {
+        PointsToID oldDst = dst;
+        dst = ptCache.unionPts(dst, src);
+        return oldDst != dst;
+    }
+
+    virtual inline void dumpPts(const KeyToIDMap &ptsSet,
+                                raw_ostream &O) const {
+        for (auto it = ptsSet.begin(); it != ptsSet.end(); ++it) {
+            const DataSet &pts = ptCache.getActualPts(it->second);
+            if (pts.empty())
+                continue;
+            O << "<" << it->first << ",{";
+            SVFUtil::dumpSet(pts, O);
+            O << "}> ";
+        }
+    }
+
+  protected:
+    PersistentPointsToCache<DataSet> &ptCache;
+    /// Data-flow IN set.
+    DFKeyToIDMap dfInPtsMap;
+    /// Data-flow OUT set.
+    DFKeyToIDMap dfOutPtsMap;
+    /// Backing to implement the basic PTData methods which are not overridden.
+    /// This allows us to avoid multiple-inheritance.
+    PersistentPTData<Key, KeySet, Data, DataSet> persPTData;
+};
+
+/// Incremental version of the persistent data-flow points-to data structure.
+template <typename Key, typename KeySet, typename Data, typename DataSet>
+class PersistentIncDFPTData
+    : public PersistentDFPTData<Key, KeySet, Data, DataSet> {
+  public:
+    using BasePTData = PTData<Key, KeySet, Data, DataSet>;
+    using BaseDFPTData = DFPTData<Key, KeySet, Data, DataSet>;
+    using BasePersDFPTData = PersistentDFPTData<Key, KeySet, Data, DataSet>;
+    using PTDataTy = typename BasePTData::PTDataTy;
+
+    using LocID = typename BaseDFPTData::LocID;
+    using UpdatedVarMap = Map<LocID, DataSet>; ///< for propagating only newly
+                                               ///< added variable in IN/OUT set
+    using UpdatedVarMapIter = typename UpdatedVarMap::iterator;
+
+  private:
+    UpdatedVarMap outUpdatedVarMap;
+    UpdatedVarMap inUpdatedVarMap;
+
+  public:
+    /// Constructor
+    PersistentIncDFPTData(PersistentPointsToCache<DataSet> &cache,
+                          bool reversePT = true,
+                          PTDataTy ty = BasePTData::PersIncDataFlow)
+        : BasePersDFPTData(cache, reversePT, ty) {}
+
+    virtual ~PersistentIncDFPTData() {}
+
+    inline bool updateDFInFromIn(LocID srcLoc, const Key &srcVar, LocID dstLoc,
+                                 const Key &dstVar) override {
+        if (varHasNewDFInPts(srcLoc, srcVar) &&
+            this->unionPtsThroughIds(this->dfInPtsMap[dstLoc][dstVar],
+                                     this->dfInPtsMap[srcLoc][srcVar])) {
+            setVarDFInSetUpdated(dstLoc, dstVar);
+            return true;
+        }
+        return false;
+    }
+
+    inline bool updateDFInFromOut(LocID srcLoc, const Key &srcVar, LocID dstLoc,
+                                  const Key &dstVar) override {
+        if (varHasNewDFOutPts(srcLoc, srcVar) &&
+            this->unionPtsThroughIds(this->dfInPtsMap[dstLoc][dstVar],
+                                     this->dfOutPtsMap[srcLoc][srcVar])) {
+            setVarDFInSetUpdated(dstLoc, dstVar);
+            return true;
+        }
+        return false;
+    }
+
+    inline bool updateDFOutFromIn(LocID srcLoc, const Key &srcVar, LocID dstLoc,
+                                  const Key &dstVar) override {
+        if (varHasNewDFInPts(srcLoc, srcVar)) {
+            removeVarFromDFInUpdatedSet(srcLoc, srcVar);
+            if (this->unionPtsThroughIds(this->dfOutPtsMap[dstLoc][dstVar],
+                                         this->dfInPtsMap[srcLoc][srcVar])) {
+                setVarDFOutSetUpdated(dstLoc, dstVar);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    inline bool updateAllDFInFromOut(LocID srcLoc, const Key &srcVar,
+                                     LocID dstLoc, const Key &dstVar) override {
+        if (this->unionPtsThroughIds(this->dfInPtsMap[dstLoc][dstVar],
+                                     this->dfOutPtsMap[srcLoc][srcVar])) {
+            setVarDFInSetUpdated(dstLoc, dstVar);
+            return true;
+        }
+        return false;
+    }
+
+    inline bool updateAllDFInFromIn(LocID srcLoc, const Key &srcVar,
+                                    LocID dstLoc, const Key &dstVar) override {
+        if (this->unionPtsThroughIds(this->dfInPtsMap[dstLoc][dstVar],
+                                     this->dfInPtsMap[srcLoc][srcVar])) {
+            setVarDFInSetUpdated(dstLoc, dstVar);
+            return true;
+        }
+        return false;
+    }
+
+    inline bool updateAllDFOutFromIn(LocID loc, const Key &singleton,
+                                     bool strongUpdates) override {
+        bool changed = false;
+        if (this->hasDFInSet(loc)) {
+            /// Only variables has new pts from IN set need to be updated.
+            DataSet pts = inUpdatedVarMap[loc];
+            for (const Key var : pts) {
+                /// Enable strong updates if it is required to do so
+                if (strongUpdates && var == singleton)
+                    continue;
+                if (updateDFOutFromIn(loc, var, loc, var))
+                    changed = true;
+            }
+        }
+        return changed;
+    }
+
+    inline bool updateTLVPts(LocID srcLoc, const Key &srcVar,
+                             const Key &dstVar) override {
+        if (varHasNewDFInPts(srcLoc, srcVar)) {
+            removeVarFromDFInUpdatedSet(srcLoc, srcVar);
+            return this->persPTData.unionPtsFromId(
+                dstVar, this->dfInPtsMap[srcLoc][srcVar]);
+        }
+        return false;
+    }
+
+    inline bool updateATVPts(const Key &srcVar, LocID dstLoc,
+                             const Key &dstVar) override {
+        if (this->unionPtsThroughIds(this->dfOutPtsMap[dstLoc][dstVar],
+                                     this->persPTData.getPtsId(srcVar))) {
+            setVarDFOutSetUpdated(dstLoc, dstVar);
+            return true;
+        }
+        return false;
+    }
+
+    inline void clearAllDFOutUpdatedVar(LocID loc) override {
+        if (this->hasDFOutSet(loc)) {
+            UpdatedVarMapIter it = outUpdatedVarMap.find(loc);
+            if (it != outUpdatedVarMap.end())
+                it->second.clear();
+        }
+    }
+
+    /// Methods to support type inquiry through isa, cast, and dyn_cast:
+    ///@{
+    static inline bool classof(const PTData<Key, KeySet, Data, DataSet> *ptd) {
+        return ptd->getPTDTY() == BasePTData::PersIncDataFlow;
+    }
+    ///@}
+
+  private:
+    /// Handle address-taken variables whose IN pts changed
+    //@{
+    inline void setVarDFInSetUpdated(LocID loc, const Key &var) {
+        inUpdatedVarMap[loc].set(var);
+    }
+    inline void removeVarFromDFInUpdatedSet(LocID loc, const Key &var) {
+        UpdatedVarMapIter it = inUpdatedVarMap.find(loc);
+        if (it != inUpdatedVarMap.end())
+            it->second.reset(var);
+    }
+    inline bool varHasNewDFInPts(LocID loc, const Key &var) {
+        UpdatedVarMapIter it = inUpdatedVarMap.find(loc);
+        if (it != inUpdatedVarMap.end())
+            return it->second.test(var);
+        return false;
+    }
+    //@}
+
+    /// Handle address-taken variables whose OUT pts changed
+    //@{
+    inline void setVarDFOutSetUpdated(LocID loc, const Key &var) {
+        outUpdatedVarMap[loc].set(var);
+    }
+    inline bool varHasNewDFOutPts(LocID loc, const Key &var) {
+        UpdatedVarMapIter it = outUpdatedVarMap.find(loc);
+        if (it != outUpdatedVarMap.end())
+            return it->second.test(var);
+        return false;
+    }
+    //@}
+};
+
+/// VersionedPTData implemented with a persistent backend.
+/// Implemented as a wrapper around two PersistentPTDatas sharing one cache:
+/// one for Keys, one for VersionedKeys.
+template <typename Key, typename KeySet, typename Data, typename DataSet,
+          typename VersionedKey, typename VersionedKeySet>
+class PersistentVersionedPTData
+    : public VersionedPTData<Key, KeySet, Data, DataSet, VersionedKey,
+                             VersionedKeySet> {
+  public:
+    using BasePTData = PTData<Key, KeySet, Data, DataSet>;
+    using BaseVersionedPTData = VersionedPTData<Key, KeySet, Data, DataSet,
+                                                VersionedKey, VersionedKeySet>;
+    using PTDataTy = typename BasePTData::PTDataTy;
+
+    PersistentVersionedPTData(PersistentPointsToCache<DataSet> &cache,
+                              bool reversePT = true,
+                              PTDataTy ty = PTDataTy::PersVersioned)
+        : BaseVersionedPTData(reversePT, ty), tlPTData(cache, reversePT),
+          atPTData(cache, reversePT) {}
+
+    virtual ~PersistentVersionedPTData() {}
+
+    inline void clear() override {
+        tlPTData.clear();
+        atPTData.clear();
+    }
+
+    const DataSet &getPts(const Key &vk) override {
+        return tlPTData.getPts(vk);
+    }
+
+    const DataSet &getPts(const VersionedKey &vk) override {
+        return atPTData.getPts(vk);
+    }
+
+    const KeySet &getRevPts(const Data &datum) override {
+        assert(this->rev && "PersistentVersionedPTData::getRevPts: constructed "
+                            "without reverse PT support!");
+        return tlPTData.getRevPts(datum);
+    }
+
+    const VersionedKeySet &getVersionedKeyRevPts(const Data &datum) override {
+        assert(this->rev && "PersistentVersionedPTData::getVersionedKeyRevPts: "
+                            "constructed without reverse PT support!");
+        return atPTData.getRevPts(datum);
+    }
+
+    bool addPts(const Key &k, const Data &element) override {
+        return tlPTData.addPts(k, element);
+    }
+
+    bool addPts(const VersionedKey &vk, const Data &element) override {
+        return atPTData.addPts(vk, element);
+    }
+
+    bool unionPts(const Key &dstVar, const Key &srcVar) override {
+        return tlPTData.unionPts(dstVar, srcVar);
+    }
+
+    bool unionPts(const VersionedKey &dstVar,
+                  const VersionedKey &srcVar) override {
+        return atPTData.unionPts(dstVar, srcVar);
+    }
+
+    /// Cross-kind unions go straight through the IDs; no set is copied.
+    ///@{
+    bool unionPts(const VersionedKey &dstVar, const Key &srcVar) override {
+        return atPTData.unionPtsFromId(dstVar, tlPTData.getPtsId(srcVar));
+    }
+
+    bool unionPts(const Key &dstVar, const VersionedKey &srcVar) override {
+        return tlPTData.unionPtsFromId(dstVar, atPTData.getPtsId(srcVar));
+    }
+    ///@}
+
+    bool unionPts(const Key &dstVar, const DataSet &srcDataSet) override {
+        return tlPTData.unionPts(dstVar, srcDataSet);
+    }
+
+    bool unionPts(const VersionedKey &dstVar,
+                  const DataSet &srcDataSet) override {
+        return atPTData.unionPts(dstVar, srcDataSet);
+    }
+
+    void clearPts(const Key &k, const Data &element) override {
+        tlPTData.clearPts(k, element);
+    }
+
+    void clearPts(const VersionedKey &vk, const Data &element) override {
+        atPTData.clearPts(vk, element);
+    }
+
+    void clearFullPts(const Key &k) override { tlPTData.clearFullPts(k); }
+    void clearFullPts(const VersionedKey &vk) override {
+        atPTData.clearFullPts(vk);
+    }
+
+    inline void dumpPTData() override {
+        SVFUtil::outs() << "== Top-level points-to information\n";
+        tlPTData.dumpPTData();
+        SVFUtil::outs() << "== Address-taken points-to information\n";
+        atPTData.dumpPTData();
+    }
+
+    /// Methods to support type inquiry through isa, cast, and dyn_cast:
+    ///@{
+    static inline bool classof(const PTData<Key, KeySet, Data, DataSet> *ptd) {
+        return ptd->getPTDTY() == PTDataTy::PersVersioned;
+    }
+    ///@}
+
+  private:
+    /// PTData for Keys (top-level pointers, generally).
+    PersistentPTData<Key, KeySet, Data, DataSet> tlPTData;
+    /// PTData for VersionedKeys (address-taken objects, generally).
+    PersistentPTData<VersionedKey, VersionedKeySet, Data, DataSet> atPTData;
+};
+
+} // End namespace SVF
+
+#endif // PERSISTENT_POINTSTO_H_
@@ -35,6 +35,7 @@
 #include "MemoryModel/AbstractPointsToDS.h"
 #include "MemoryModel/ConditionalPT.h"
 #include "MemoryModel/MutablePointsToDS.h"
+#include "MemoryModel/PersistentPointsToDS.h"
 #include "Util/PathCondAllocator.h"
 #include "Util/SCC.h"
 
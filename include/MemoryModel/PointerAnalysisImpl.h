@@ -31,6 +31,7 @@
 #define INCLUDE_MEMORYMODEL_POINTERANALYSISIMPL_H_
 
 #include "MemoryModel/PointerAnalysis.h"
+#include "MemoryModel/PointsToFile.h"
 
 namespace SVF {
 
@@ -54,6 +55,31 @@ class BVDataPTAImpl : public PointerAnalysis {
     using MutVersionedPTDataTy =
         MutableVersionedPTData<NodeID, NodeBS, NodeID, PointsTo, VersionedVar,
                                Set<VersionedVar>>;
+    using PersPTDataTy = PersistentPTData<NodeID, NodeBS, NodeID, PointsTo>;
+    using PersDiffPTDataTy =
+        PersistentDiffPTData<NodeID, NodeBS, NodeID, PointsTo>;
+    using PersDFPTDataTy = PersistentDFPTData<NodeID, NodeBS, NodeID, PointsTo>;
+    using PersIncDFPTDataTy =
+        PersistentIncDFPTData<NodeID, NodeBS, NodeID, PointsTo>;
+    using PersVersionedPTDataTy =
+        PersistentVersionedPTData<NodeID, NodeBS, NodeID, PointsTo,
+                                  VersionedVar, Set<VersionedVar>>;
+
+    /// How points-to sets are stored.
+    enum PTBackingType {
+        /// Every key owns a private, updatable points-to set.
+        Mutable,
+        /// Points-to sets are interned in a PersistentPointsToCache.
+        Persistent,
+    };
+
+    /// Format of the files written by writeToFile.
+    enum PTFileFormat {
+        /// One "var -> { obj1 obj2 }" line per node.
+        Text,
+        /// Indexed binary file (see PointsToFile), loaded lazily.
+        Binary,
+    };
 
     /// Constructor
     BVDataPTAImpl(SVFProject *proj, PointerAnalysis::PTATY type,
@@ -77,39 +103,52 @@ class BVDataPTAImpl : public PointerAnalysis {
     /// Get points-to and reverse points-to
     ///@{
     inline const PointsTo &getPts(NodeID id) override {
+        loadPts(id);
         return ptD->getPts(id);
     }
 
     inline const NodeBS &getRevPts(NodeID nodeId) override {
+        loadAllPts();
         return ptD->getRevPts(nodeId);
     }
     //@}
 
     /// Remove element from the points-to set of id.
     virtual inline void clearPts(NodeID id, NodeID element) {
+        loadPts(id);
         ptD->clearPts(id, element);
     }
 
     /// Clear points-to set of id.
-    virtual inline void clearFullPts(NodeID id) { ptD->clearFullPts(id); }
+    virtual inline void clearFullPts(NodeID id) {
+        loadPts(id);
+        ptD->clearFullPts(id);
+    }
 
     /// Union/add points-to. Add the reverse points-to for node collapse purpose
     /// To be noted that adding reverse pts might incur 10% total overhead
     /// during solving
     //@{
     virtual inline bool unionPts(NodeID id, const PointsTo &target) {
+        loadPts(id);
         return ptD->unionPts(id, target);
     }
     virtual inline bool unionPts(NodeID id, NodeID ptd) {
+        loadPts(id);
+        loadPts(ptd);
         return ptD->unionPts(id, ptd);
     }
     virtual inline bool addPts(NodeID id, NodeID ptd) {
+        loadPts(id);
         return ptD->addPts(id, ptd);
     }
     //@}
 
     /// Clear all data
-    virtual inline void clearAllPts() { ptD->clear(); }
+    virtual inline void clearAllPts() {
+        ptsFile.reset();
+        ptD->clear();
+    }
 
     /// Expand FI objects
     virtual void expandFIObjs(const PointsTo &pts, PointsTo &expandedPts);
@@ -121,12 +160,24 @@ class BVDataPTAImpl : public PointerAnalysis {
     //@}
 
   protected:
+    /// Points-to sets read from a binary file are only copied into ptD when
+    /// first accessed. Every access to ptD must load the keys it touches.
+    //@{
+    inline void loadPts(NodeID id) {
+        if (ptsFile != nullptr) {
+            loadPtsFromFile(id);
+        }
+    }
+    inline void loadAllPts() {
+        if (ptsFile != nullptr) {
+            loadAllPtsFromFile();
+        }
+    }
+    //@}
+
     /// Finalization of pointer analysis, and normalize points-to information to
     /// Bit Vector representation
-    void finalize() override {
-        normalizePointsTo();
-        PointerAnalysis::finalize();
-    }
+    void finalize() override;
 
     /// Update callgraph. This should be implemented by its subclass.
     virtual inline bool updateCallGraph(const CallSiteToFunPtrMap &) {
@@ -137,6 +188,11 @@ class BVDataPTAImpl : public PointerAnalysis {
     /// Get points-to data structure
     inline PTDataTy *getPTDataTy() const { return ptD; }
 
+    /// Get the cache interning points-to sets for Persistent backings.
+    inline const PersistentPointsToCache<PointsTo> &getPtCache() const {
+        return ptCache;
+    }
+
     inline DiffPTDataTy *getDiffPTDataTy() const {
         auto *diff = llvm::dyn_cast<DiffPTDataTy>(ptD);
         assert(diff && "BVDataPTAImpl::getDiffPTDataTy: not a DiffPTDataTy!");
@@ -187,9 +243,30 @@ class BVDataPTAImpl : public PointerAnalysis {
         }
     }
 
+    /// Store the points-to sets in the binary format of PointsToFile
+    bool writeToBinaryFile(const std::string &filename);
+
   private:
     /// Points-to data
     PTDataTy *ptD = nullptr;
+    /// Unique table of points-to sets, used when ptD is a Persistent backing.
+    PersistentPointsToCache<PointsTo> ptCache;
+
+    /// Binary result file whose points-to sets are not all in ptD yet.
+    std::unique_ptr<PointsToFile> ptsFile;
+    /// Nodes whose points-to set has been looked up in ptsFile.
+    NodeBS ptsLoadedFromFile;
+    /// Number of points-to sets of ptsFile copied into ptD.
+    u32_t numOfPtsLoadedFromFile = 0;
+
+    /// Result file I/O in each format
+    //@{
+    void writeToTextFile(const std::string &filename);
+    bool readFromTextFile(const std::string &filename);
+    bool readFromBinaryFile(const std::string &filename);
+    void loadPtsFromFile(NodeID id);
+    void loadAllPtsFromFile();
+    //@}
 
   public:
     /// Interface expose to users of our pointer analysis, given Location infos
@@ -208,7 +285,10 @@ class BVDataPTAImpl : public PointerAnalysis {
 
     /// dump and debug, print out conditional pts
     //@{
-    void dumpCPts() override { ptD->dumpPTData(); }
+    void dumpCPts() override {
+        loadAllPts();
+        ptD->dumpPTData();
+    }
 
     void dumpTopLevelPtsTo() override;
 
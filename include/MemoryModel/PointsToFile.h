@@ -0,0 +1,131 @@
+//===- PointsToFile.h -- Binary pointer analysis result files ----------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * PointsToFile.h
+ *
+ * Versioned binary format for storing points-to results (-write-ander).
+ * A file is laid out as
+ *
+ *   Header | PtsIndexEntry * numOfPts | GepObjEntry * numOfGepObjs | payload
+ *
+ * The index is sorted by node ID so a points-to set can be found with a
+ * binary search directly in the mapped file. Each points-to set is stored in
+ * the payload once, as the ULEB128-encoded deltas between its sorted
+ * elements; nodes with equal points-to sets share the same payload.
+ */
+
+#ifndef POINTSTOFILE_H_
+#define POINTSTOFILE_H_
+
+#include "Util/BasicTypes.h"
+
+#include <llvm/Support/MemoryBuffer.h>
+
+namespace SVF {
+
+/*!
+ * Writer of a binary points-to file.
+ */
+class PointsToFileWriter {
+  public:
+    /// Record the points-to set of node. Empty sets need not be added.
+    void addPts(NodeID node, const PointsTo &pts);
+
+    /// Record a GEP object created during solving.
+    void addGepObj(NodeID id, NodeID base, Size_t offset);
+
+    /// Write everything recorded so far to filename.
+    /// Returns false if the file could not be written.
+    bool write(const std::string &filename);
+
+  private:
+    /// Offset of the encoded pts in payload, encoding it if it is new.
+    u64_t getPayloadOffset(const PointsTo &pts);
+
+    struct PtsEntry {
+        NodeID node;
+        u32_t size;
+        u64_t offset;
+    };
+    struct GepObj {
+        NodeID id;
+        NodeID base;
+        Size_t offset;
+    };
+
+    std::vector<PtsEntry> ptsEntries;
+    std::vector<GepObj> gepObjs;
+    Map<PointsTo, u64_t> ptsToOffset;
+    std::string payload;
+};
+
+/*!
+ * A binary points-to file mapped into memory.
+ * Points-to sets are decoded one at a time on request.
+ */
+class PointsToFile {
+  public:
+    /// Version of the format written by PointsToFileWriter.
+    static const u32_t version = 1;
+
+    /// Whether filename starts like a binary points-to file.
+    static bool isPointsToFile(const std::string &filename);
+
+    /// Map filename. Returns nullptr (after printing why) if the file cannot
+    /// be read, is of a different version or is corrupt.
+    static std::unique_ptr<PointsToFile> open(const std::string &filename);
+
+    /// Number of nodes with a (non-empty) points-to set in the file.
+    u32_t getNumOfPts() const;
+
+    /// Decode the points-to set of node into pts.
+    /// Returns false if the file has no points-to set for node or the set
+    /// cannot be decoded.
+    bool readPts(NodeID node, PointsTo &pts) const;
+
+    /// Node ID of the i-th points-to set of the index (sorted by node ID).
+    NodeID getPtsNode(u32_t i) const;
+
+    /// GEP objects recorded in the file, as (id, base, offset).
+    //@{
+    u32_t getNumOfGepObjs() const;
+    void getGepObj(u32_t i, NodeID &id, NodeID &base, Size_t &offset) const;
+    //@}
+
+  private:
+    explicit PointsToFile(std::unique_ptr<llvm::MemoryBuffer> buf)
+        : buffer(std::move(buf)) {}
+
+    /// Check the header, the section sizes and the index against the buffer.
+    bool validate() const;
+
+    /// Decode the points-to set of the i-th index entry into pts.
+    /// Returns false, leaving pts unchanged, if the payload is corrupt.
+    bool decodePts(u32_t i, PointsTo &pts) const;
+
+    std::unique_ptr<llvm::MemoryBuffer> buffer;
+};
+
+} // End namespace SVF
+
+#endif /* POINTSTOFILE_H_ */
@@ -67,6 +67,8 @@ class SaberSVFGBuilder : virtual public SVFGBuilder,
   protected:
     /// Re-write create SVFG method
     void buildSVFG() override;
+    /// Collect the global SVFG nodes of a cached SVFG
+    void restoreFromCache(BVDataPTAImpl *pta) override;
 
   private:
     /// Remove direct value-flow edge to a dereference point for Saber
@@ -76,6 +78,9 @@ class SaberSVFGBuilder : virtual public SVFGBuilder,
     /// they can not pass the value to other definitions
     void rmDerefDirSVFGEdges(BVDataPTAImpl *pta);
 
+    /// Collect the stores and loads which access global memory
+    void collectGlobalSVFGNodes(BVDataPTAImpl *pta);
+
     /// Add actual parameter SVFGNode for 1st argument of a deallocation like
     /// external function In order to path sensitive leak detection
     virtual void AddExtActualParmSVFGNodes(PTACallGraph *callgraph);
@@ -60,13 +60,71 @@ class SrcSnkDDA : virtual public CFLSrcSnkSolver {
     using SVFGNodeBS = NodeBS;
     using WorkList = ProgSlice::VFWorkList;
 
+  protected:
+    /*!
+     * Computes the slice of one source at a time: the forward slice up to
+     * the sinks, the backward slice from the sinks and the guards on it.
+     * A worker owns its traversal state, so workers with their own path
+     * condition allocators can slice different sources concurrently.
+     */
+    class SliceWorker : public CFLSrcSnkSolver {
+      public:
+        SliceWorker(SrcSnkDDA *dda, PathCondAllocator *pa)
+            : dda(dda), pathCondAllocator(pa), slice(nullptr) {
+            setGraph(dda->svfg);
+        }
+
+        /// Slice src; the caller owns the returned slice
+        ProgSlice *solve(const SVFGNode *src);
+
+      protected:
+        /// Forward traverse
+        void FWProcessCurNode(const DPIm &item) override;
+        /// Propagate information forward by matching context
+        void FWProcessOutgoingEdge(const DPIm &item, SVFGEdge *edge) override;
+        /// Backward traverse
+        void BWProcessCurNode(const DPIm &item) override;
+        /// Propagate information backward without matching context, as
+        /// forward analysis already did it
+        void BWProcessIncomingEdge(const DPIm &item, SVFGEdge *edge) override;
+        /// Whether has been visited or not, in order to avoid recursion on
+        /// SVFG
+        //@{
+        inline bool forwardVisited(const SVFGNode *node, const DPIm &item) {
+            auto it = nodeToDPItemsMap.find(node);
+            if (it != nodeToDPItemsMap.end())
+                return it->second.find(item) != it->second.end();
+            else
+                return false;
+        }
+        inline void addForwardVisited(const SVFGNode *node, const DPIm &item) {
+            nodeToDPItemsMap[node].insert(item);
+        }
+        inline bool backwardVisited(const SVFGNode *node) {
+            return visitedSet.find(node) != visitedSet.end();
+        }
+        inline void addBackwardVisited(const SVFGNode *node) {
+            visitedSet.insert(node);
+        }
+        inline void clearVisitedMap() {
+            nodeToDPItemsMap.clear();
+            visitedSet.clear();
+        }
+        //@}
+
+      private:
+        SrcSnkDDA *dda;
+        PathCondAllocator *pathCondAllocator;
+        ProgSlice *slice;                      ///< slice being computed
+        SVFGNodeToDPItemsMap nodeToDPItemsMap; ///< forward visited dpitems
+        SVFGNodeSet visitedSet;                ///< backward visited nodes
+    };
+
   private:
     ProgSlice *_curSlice; /// current program slice
     SVFGNodeSet sources;  /// source nodes
     SVFGNodeSet sinks;    /// source nodes
     PathCondAllocator *pathCondAllocator;
-    SVFGNodeToDPItemsMap nodeToDPItemsMap; ///<  record forward visited dpitems
-    SVFGNodeSet visitedSet;                ///<  record backward visited nodes
 
   protected:
     PAG *pag;
@@ -128,7 +186,8 @@ class SrcSnkDDA : virtual public CFLSrcSnkSolver {
     }
     /// Slice operations
     //@{
-    virtual void setCurSlice(const SVFGNode *src);
+    /// Make slice (owned by this analysis from now on) the current slice
+    virtual void setCurSlice(ProgSlice *slice);
 
     inline ProgSlice *getCurSlice() const { return _curSlice; }
     inline void addSinkToCurSlice(const SVFGNode *node) {
@@ -181,50 +240,12 @@ class SrcSnkDDA : virtual public CFLSrcSnkSolver {
     PathCondAllocator *getPathAllocator() const { return pathCondAllocator; }
 
   protected:
-    /// Forward traverse
-    inline void FWProcessCurNode(const DPIm &item) override {
-        const SVFGNode *node = getNode(item.getCurNodeID());
-        if (isSink(node)) {
-            addSinkToCurSlice(node);
-            _curSlice->setPartialReachable();
-        } else
-            addToCurForwardSlice(node);
-    }
-    /// Backward traverse
-    inline void BWProcessCurNode(const DPIm &item) override {
-        const SVFGNode *node = getNode(item.getCurNodeID());
-        if (isInCurForwardSlice(node)) {
-            addToCurBackwardSlice(node);
-        }
-    }
-    /// Propagate information forward by matching context
-    void FWProcessOutgoingEdge(const DPIm &item, SVFGEdge *edge) override;
-    /// Propagate information backward without matching context, as forward
-    /// analysis already did it
-    void BWProcessIncomingEdge(const DPIm &item, SVFGEdge *edge) override;
-    /// Whether has been visited or not, in order to avoid recursion on SVFG
-    //@{
-    inline bool forwardVisited(const SVFGNode *node, const DPIm &item) {
-        auto it = nodeToDPItemsMap.find(node);
-        if (it != nodeToDPItemsMap.end())
-            return it->second.find(item) != it->second.end();
-        else
-            return false;
-    }
-    inline void addForwardVisited(const SVFGNode *node, const DPIm &item) {
-        nodeToDPItemsMap[node].insert(item);
-    }
-    inline bool backwardVisited(const SVFGNode *node) {
-        return visitedSet.find(node) != visitedSet.end();
-    }
-    inline void addBackwardVisited(const SVFGNode *node) {
-        visitedSet.insert(node);
-    }
-    inline void clearVisitedMap() {
-        nodeToDPItemsMap.clear();
-        visitedSet.clear();
-    }
-    //@}
+    /// Slice the sources with numOfThreads workers, reporting the slices in
+    /// the order of srcs
+    void analyzeInParallel(const std::vector<const SVFGNode *> &srcs,
+                           unsigned numOfThreads);
+    /// Report the bugs on a slice and make it the current slice
+    void reportSlice(ProgSlice *slice);
 
     /// Whether it is all path reachable from a source
     virtual bool isAllPathReachable() { return _curSlice->isAllReachable(); }
@@ -0,0 +1,126 @@
+//===- ProjectSnapshot.h -- Function fingerprints of an SVFProject ----------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * ProjectSnapshot.h
+ *
+ * A snapshot records a fingerprint of every function body and global
+ * initializer of a project and a key for every PAG node which does not
+ * depend on node numbering: the function owning the node's value plus the
+ * value's position in that function. Comparing the snapshots of two versions
+ * of a program gives the functions which changed between them, and the nodes
+ * of unchanged functions can be matched up through their keys. The PAG edges
+ * are recorded by the keys of their ends, which tells whether constraints
+ * were removed between the two versions.
+ */
+
+#ifndef INCLUDE_SVF_FE_PROJECTSNAPSHOT_H_
+#define INCLUDE_SVF_FE_PROJECTSNAPSHOT_H_
+
+#include "Util/BasicTypes.h"
+
+namespace SVF {
+
+class SVFProject;
+class PAG;
+
+/*!
+ * \class ProjectSnapshot
+ *
+ * Function fingerprints and stable PAG node keys of an SVFProject.
+ */
+class ProjectSnapshot {
+  public:
+    /// Functions, and global variables as "@name", to their fingerprints
+    using FunToHashMap = OrderedMap<std::string, u64_t>;
+    using NodeToKeyMap = OrderedMap<NodeID, std::string>;
+    /// GEP object ID -> (base object ID, offset)
+    using GepObjMap = OrderedMap<NodeID, std::pair<NodeID, Size_t>>;
+    /// Hash of a PAG edge's kind and end keys -> number of such edges
+    using ConsToCountMap = OrderedMap<u64_t, u32_t>;
+
+    /// Version of the snapshot file format
+    static const u32_t version = 2;
+
+    /// Empty snapshot, to be filled by readFromFile
+    ProjectSnapshot() = default;
+
+    /// Fingerprint the functions and PAG nodes of proj
+    explicit ProjectSnapshot(SVFProject *proj);
+
+    /// Snapshot file I/O
+    //@{
+    bool writeToFile(const std::string &filename) const;
+    bool readFromFile(const std::string &filename);
+    //@}
+
+    /// Names of the functions (and "@name" of the global variables) which
+    /// were added, removed or modified since the snapshot old was taken
+    Set<std::string> getChangedFunctions(const ProjectSnapshot &old) const;
+
+    /// Whether a PAG edge of old may be missing from this snapshot, i.e.
+    /// an edge of old has no counterpart, or a function or global of
+    /// changedFuns had edges whose ends have no key.
+    bool hasRemovedConstraints(const ProjectSnapshot &old,
+                               const Set<std::string> &changedFuns) const;
+
+    /// Map the nodes of old to the nodes of this snapshot with the same key,
+    /// leaving out the nodes of changedFuns. GEP objects are not mapped as
+    /// they may not have been created yet, see getGepObjs.
+    void mapNodes(const ProjectSnapshot &old,
+                  const Set<std::string> &changedFuns,
+                  Map<NodeID, NodeID> &oldToNew) const;
+
+    /// Get methods
+    //@{
+    inline const FunToHashMap &getFunHashes() const { return funHashes; }
+    inline const NodeToKeyMap &getNodeKeys() const { return nodeKeys; }
+    inline const GepObjMap &getGepObjs() const { return gepObjs; }
+    inline const ConsToCountMap &getConsCounts() const { return consCounts; }
+    //@}
+
+  private:
+    /// Fingerprint fun, and give keys to its arguments and instructions
+    u64_t hashFunction(const Function &fun,
+                       Map<const Value *, std::string> &valueKeys) const;
+
+    /// Fingerprint the type and initializer of glob
+    u64_t hashGlobal(const GlobalVariable &glob) const;
+
+    /// Record the edges of pag by the keys of their ends
+    void recordConstraints(PAG *pag,
+                           const Map<const Value *, std::string> &valueKeys);
+
+    /// Function whose nodes a key belongs to ("" for global nodes)
+    static std::string getKeyFunction(const std::string &key);
+
+    FunToHashMap funHashes;
+    NodeToKeyMap nodeKeys;
+    GepObjMap gepObjs;
+    ConsToCountMap consCounts;
+    /// Owners of the edges with an end without a key ("?" if unknown)
+    OrderedSet<std::string> unkeyedConsOwners;
+};
+
+} // End namespace SVF
+
+#endif /* INCLUDE_SVF_FE_PROJECTSNAPSHOT_H_ */
@@ -40,6 +40,18 @@ class ThreadAPI;
 class MemObj;
 
 class SVFProject {
+  public:
+    /// Kind of boost archive used to (de)serialize the graphs of a project
+    enum ArchiveKind {
+        /// Human readable, portable text archive
+        TextArchive,
+        /// Native binary archive. Boost checks on load that the archive was
+        /// written with the same byte order and type sizes.
+        BinaryArchive,
+        /// Binary archive written through a zlib stream
+        CompressedBinaryArchive,
+    };
+
   private:
     vector<string> modNameVec;
     SymbolTableInfo *symTableInfo = nullptr;
@@ -49,6 +61,8 @@ class SVFProject {
     ICFG *icfg = nullptr;
 
     ThreadAPI *threadAPI = nullptr;
+
+    ArchiveKind archiveKind = TextArchive;
     // bool _built = false;
     static SVFProject *currentProject;
 
@@ -74,6 +88,12 @@ class SVFProject {
 
     ThreadAPI *getThreadAPI();
 
+    /// Archive kind used by saveToArchive/loadFromArchive (Serialization.h)
+    //@{
+    ArchiveKind getArchiveKind() const { return archiveKind; }
+    void setArchiveKind(ArchiveKind kind) { archiveKind = kind; }
+    //@}
+
     /// Return true if this is a thread creation call
     ///@{
     bool isThreadForkCall(const CallSite cs);
@@ -0,0 +1,57 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#ifndef __TESTS_DDA_DDAPASS_H__
+#define __TESTS_DDA_DDAPASS_H__
+
+#include "DDA/DDAPass.h"
+#include "SVF-FE/LLVMModule.h"
+#include "SVF-FE/SVFProject.h"
+
+#include <llvm/IR/InstIterator.h>
+#include <string>
+#include <vector>
+
+namespace SVF {
+
+/// Alias results of the DDA selected by -dda on pairs of the first pointers
+/// of ll_file
+inline std::vector<AliasResult> getDDAAliasResults(std::string ll_file) {
+    SVFProject proj(ll_file);
+    PAG *pag = proj.getPAG();
+    std::vector<const Value *> ptrs;
+    for (const Function &fun : *proj.getLLVMModSet()->getModule(0)) {
+        for (const Instruction &inst : llvm::instructions(fun)) {
+            if (ptrs.size() < 12 && inst.getType()->isPointerTy() &&
+                pag->hasValueNode(&inst))
+                ptrs.push_back(&inst);
+        }
+    }
+
+    std::vector<AliasResult> results;
+    DDAPass pass;
+    pass.runOnModule(&proj);
+    for (const Value *p : ptrs) {
+        for (const Value *q : ptrs)
+            results.push_back(pass.alias(p, q));
+    }
+
+    return results;
+}
+
+} // namespace SVF
+
+#endif
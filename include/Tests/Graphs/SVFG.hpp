@@ -0,0 +1,85 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#ifndef __TESTS_GRAPHS_SVFG_H__
+#define __TESTS_GRAPHS_SVFG_H__
+
+#include "Graphs/SVFG.h"
+#include "config.h"
+
+#include <set>
+#include <string>
+
+namespace SVF {
+
+/// Programs the multi-threaded builders are compared with their sequential
+/// results on
+static const char *const ThreadTestPrograms[] = {
+    SVF_BUILD_DIR "tests/ICFG/fptr_test_cpp.ll",
+    SVF_BUILD_DIR "tests/ICFG/virt_call_test_cpp.ll",
+    SVF_BUILD_DIR "tests/SABER/leak_cpp.ll",
+};
+
+/// Node key made of its ID and kind
+inline std::string getSVFGNodeIDKey(const SVFGNode *node) {
+    return std::to_string(node->getId()) + " " +
+           std::to_string(node->getNodeKind());
+}
+
+/// Nodes and edges of an SVFG as strings, so that graphs built differently
+/// can be compared as sets
+struct SVFGSets {
+    std::set<std::string> nodes;
+    std::set<std::string> edges;
+
+    /// Keys of the nodes of svfg given by nodeKey, and of its edges: their
+    /// kind, the keys of their ends, and for indirect edges the call site
+    /// and points-to set
+    template <typename NodeKey>
+    SVFGSets(SVFG *svfg, NodeKey nodeKey) {
+        for (auto &it : *svfg) {
+            const SVFGNode *node = it.second;
+            nodes.insert(nodeKey(node));
+            for (const SVFGEdge *edge : node->getOutEdges())
+                edges.insert(getEdgeKey(edge, nodeKey));
+        }
+    }
+
+    explicit SVFGSets(SVFG *svfg) : SVFGSets(svfg, getSVFGNodeIDKey) {}
+
+  private:
+    template <typename NodeKey>
+    static std::string getEdgeKey(const SVFGEdge *edge, NodeKey nodeKey) {
+        std::string key = std::to_string(edge->getEdgeKind()) + " " +
+                          nodeKey(edge->getSrcNode()) + " -> " +
+                          nodeKey(edge->getDstNode());
+        if (const auto *call = llvm::dyn_cast<CallIndSVFGEdge>(edge))
+            key += " cs" + std::to_string(call->getCallSiteId());
+        else if (const auto *ret = llvm::dyn_cast<RetIndSVFGEdge>(edge))
+            key += " cs" + std::to_string(ret->getCallSiteId());
+        if (const auto *ind = llvm::dyn_cast<IndirectSVFGEdge>(edge)) {
+            key += " {";
+            for (NodeID o : ind->getPointsTo())
+                key += " " + std::to_string(o);
+            key += " }";
+        }
+        return key;
+    }
+};
+
+} /* end of namespace SVF */
+
+#endif /* __TESTS_GRAPHS_SVFG_H__ */
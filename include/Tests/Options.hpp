@@ -0,0 +1,48 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#ifndef __TESTS_OPTIONS_H__
+#define __TESTS_OPTIONS_H__
+
+#include "Util/Options.h"
+
+namespace SVF {
+
+/// Set a command line option for the lifetime of the guard. The previous
+/// value is restored however the scope is left, e.g. by a failed ASSERT.
+template <typename T>
+class OptionGuard {
+  public:
+    OptionGuard(const llvm::cl::opt<T> &o, const T &value)
+        : opt(const_cast<llvm::cl::opt<T> &>(o)), old(o.getValue()) {
+        opt.setValue(value);
+    }
+    ~OptionGuard() { opt.setValue(old); }
+
+    OptionGuard(const OptionGuard &) = delete;
+    OptionGuard &operator=(const OptionGuard &) = delete;
+
+  private:
+    llvm::cl::opt<T> &opt;
+    T old;
+};
+
+template <typename T, typename V>
+OptionGuard(const llvm::cl::opt<T> &, const V &) -> OptionGuard<T>;
+
+} /* end of namespace SVF */
+
+#endif /* __TESTS_OPTIONS_H__ */
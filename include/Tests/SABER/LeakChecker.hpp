@@ -0,0 +1,60 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#ifndef __TESTS_SABER_LEAKCHECKER_H__
+#define __TESTS_SABER_LEAKCHECKER_H__
+
+#include "SABER/LeakChecker.h"
+#include "SVF-FE/SVFProject.h"
+
+#include <string>
+#include <vector>
+
+namespace SVF {
+
+/// Leak checker recording what it finds about each slice, in report order
+class RecordingLeakChecker : public LeakChecker {
+  public:
+    explicit RecordingLeakChecker(SVFProject *proj) : LeakChecker(proj) {}
+
+    std::vector<std::string> reports;
+
+  protected:
+    void reportBug(ProgSlice *slice) override {
+        std::string report;
+        raw_string_ostream os(report);
+        os << slice->getSource()->getId() << " " << isAllPathReachable()
+           << " " << isSomePathReachable() << " "
+           << slice->getForwardSliceSize() << " "
+           << slice->getBackwardSliceSize() << " " << slice->evalFinalCond();
+        reports.push_back(os.str());
+
+        LeakChecker::reportBug(slice);
+    }
+};
+
+/// Reports of the leak checker on ll_file
+inline std::vector<std::string> checkLeaks(std::string ll_file) {
+    SVFProject proj(ll_file);
+    RecordingLeakChecker checker(&proj);
+    checker.runOnModule(proj.getSVFModule());
+
+    return checker.reports;
+}
+
+} // namespace SVF
+
+#endif
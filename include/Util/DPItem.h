@@ -34,6 +34,7 @@
 #include "Util/PathCondAllocator.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm> // std::sort
+#include <atomic>
 
 namespace SVF {
 
@@ -173,8 +174,11 @@ class ContextCond {
         if (context.size() < maximumCxtLen) {
             context.push_back(ctx);
 
-            if (context.size() > maximumCxt) {
-                maximumCxt = context.size();
+            // Contexts may be pushed on several threads, see SrcSnkDDA.
+            u32_t size = context.size();
+            u32_t max = maximumCxt.load(std::memory_order_relaxed);
+            while (size > max &&
+                   !maximumCxt.compare_exchange_weak(max, size)) {
             }
             return true;
         }
@@ -254,7 +258,7 @@ class ContextCond {
     bool concreteCxt;
 
   public:
-    static u32_t maximumCxt;
+    static std::atomic<u32_t> maximumCxt;
 };
 
 /*!
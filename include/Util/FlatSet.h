@@ -0,0 +1,132 @@
+//===- FlatSet.h -- Ordered set stored in a sorted vector -------------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * FlatSet.h
+ *
+ * A set of small trivially copyable elements (e.g. edge pointers) kept in
+ * one sorted array. It iterates in the same order as an OrderedSet with the
+ * same comparator but needs neither a tree node per element nor a tree
+ * header per set. Insertion and removal move the elements behind the
+ * position, so it suits the many small sets of a graph, not one big set.
+ *
+ * As with a vector, insert and erase invalidate all iterators.
+ */
+
+#ifndef INCLUDE_UTIL_FLATSET_H_
+#define INCLUDE_UTIL_FLATSET_H_
+
+#include <llvm/ADT/SmallVector.h>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace SVF {
+
+template <typename Key, typename Compare = std::less<Key>>
+class FlatSet {
+
+  private:
+    using StorageTy = llvm::SmallVector<Key, 0>;
+
+  public:
+    using value_type = Key;
+    using key_compare = Compare;
+    using size_type = typename StorageTy::size_type;
+    /// Elements must stay sorted, so they are read-only as in a std::set
+    using iterator = typename StorageTy::const_iterator;
+    using const_iterator = typename StorageTy::const_iterator;
+
+    FlatSet() = default;
+
+    /// Iterators
+    //@{
+    inline const_iterator begin() const { return elements.begin(); }
+    inline const_iterator end() const { return elements.end(); }
+    //@}
+
+    inline size_type size() const { return elements.size(); }
+    inline bool empty() const { return elements.empty(); }
+
+    /// Insert key; the second result is false if it was already there
+    std::pair<iterator, bool> insert(const Key &key) {
+        auto it = lowerBound(key);
+        if (it != elements.end() && !cmp(key, *it)) {
+            return std::make_pair(iterator(it), false);
+        }
+
+        it = elements.insert(it, key);
+        return std::make_pair(iterator(it), true);
+    }
+
+    /// Remove key, returning the number of removed elements
+    size_type erase(const Key &key) {
+        auto it = lowerBound(key);
+        if (it == elements.end() || cmp(key, *it)) {
+            return 0;
+        }
+
+        elements.erase(it);
+        return 1;
+    }
+
+    inline const_iterator find(const Key &key) const {
+        auto it = lowerBound(key);
+        if (it == elements.end() || cmp(key, *it)) {
+            return elements.end();
+        }
+        return it;
+    }
+
+    inline size_type count(const Key &key) const {
+        return find(key) == end() ? 0 : 1;
+    }
+
+    inline void clear() { elements.clear(); }
+
+    inline bool operator==(const FlatSet &rhs) const {
+        return elements == rhs.elements;
+    }
+    inline bool operator!=(const FlatSet &rhs) const {
+        return !(*this == rhs);
+    }
+
+  private:
+    StorageTy elements;
+
+    /// The comparator is stateless, so it is not stored in every set
+    static inline bool cmp(const Key &lhs, const Key &rhs) {
+        return Compare()(lhs, rhs);
+    }
+
+    inline typename StorageTy::iterator lowerBound(const Key &key) {
+        return std::lower_bound(elements.begin(), elements.end(), key, cmp);
+    }
+    inline const_iterator lowerBound(const Key &key) const {
+        return std::lower_bound(elements.begin(), elements.end(), key, cmp);
+    }
+};
+
+} // End namespace SVF
+
+#endif /* INCLUDE_UTIL_FLATSET_H_ */
@@ -68,6 +68,11 @@ class NodeIDAllocator {
     /// Notify the allocator that all symbols have had IDs allocated.
     void endSymbolAllocation();
 
+    /// Treat every ID up to id as allocated, for nodes whose IDs were not
+    /// allocated here (e.g., read from a PAG file). Values are still taken
+    /// from the top with DENSE, so ids should stay well below UINT_MAX.
+    void reserveIds(NodeID id);
+
   private:
     /// These are moreso counters than amounts.
     ///@{
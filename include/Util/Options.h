@@ -5,6 +5,7 @@
 
 #include "MemoryModel/PointerAnalysisImpl.h"
 #include "Util/NodeIDAllocator.h"
+#include "Util/WorkList.h"
 #include "WPA/WPAPass.h"
 #include <sstream>
 
@@ -58,6 +59,12 @@ class Options {
     // FlowDDA.cpp
     static const llvm::cl::opt<unsigned long long> FlowBudget;
 
+    // Value-flow based demand-driven solver (DDAVFSolver.h)
+    static const llvm::cl::opt<unsigned> DDACacheSize;
+
+    // Generic graph (GenericGraph.h)
+    static const llvm::cl::opt<bool> FreezeGraphs;
+
     // Offline constraint graph (OfflineConsG.cpp)
     static const llvm::cl::opt<bool> OCGDotGraph;
 
@@ -69,6 +76,7 @@ class Options {
     static const llvm::cl::opt<bool> ContextInsensitive;
     static const llvm::cl::opt<bool> KeepAOFI;
     static const llvm::cl::opt<std::string> SelfCycle;
+    static const llvm::cl::opt<unsigned> SVFGOPTThreads;
 
     // Sparse value-flow graph (VFG.cpp)
     static const llvm::cl::opt<bool> DumpVFG;
@@ -83,6 +91,7 @@ class Options {
     static const llvm::cl::opt<bool> PTSAllPrint;
     static const llvm::cl::opt<bool> PStat;
     static const llvm::cl::opt<unsigned> StatBudget;
+    static const llvm::cl::opt<std::string> StatExport;
     static const llvm::cl::opt<bool> PAGDotGraph;
     static const llvm::cl::opt<bool> PAGDotGraphShorter;
     static const llvm::cl::opt<bool> DumpICFG;
@@ -96,6 +105,7 @@ class Options {
 
     // PointerAnalysisImpl.cpp
     static const llvm::cl::opt<bool> INCDFPTData;
+    static const llvm::cl::opt<BVDataPTAImpl::PTBackingType> PtDataBacking;
 
     // Memory region (MemRegion.cpp)
     static const llvm::cl::opt<bool> IgnoreDeadFun;
@@ -110,6 +120,10 @@ class Options {
     static const llvm::cl::opt<bool> SVFGWithIndirectCall;
     static const llvm::cl::opt<bool> SingleVFG;
     static llvm::cl::opt<bool> OPTSVFG;
+    static const llvm::cl::opt<unsigned> MSSAThreads;
+    static const llvm::cl::opt<bool> LazySVFG;
+    static const llvm::cl::opt<unsigned> LazySVFGCacheSize;
+    static const llvm::cl::opt<std::string> SVFGCacheDir;
 
     // FSMPTA.cpp
     static const llvm::cl::opt<bool> UsePCG;
@@ -149,6 +163,7 @@ class Options {
     // Source-sink analyzer (SrcSnkDDA.cpp)
     static const llvm::cl::opt<bool> DumpSlice;
     static const llvm::cl::opt<unsigned> CxtLimit;
+    static const llvm::cl::opt<unsigned> SaberThreads;
 
     // CHG.cpp
     static const llvm::cl::opt<bool> DumpCHA;
@@ -182,11 +197,29 @@ class Options {
     static const llvm::cl::opt<std ::string> WriteAnder;
     // static const llvm::cl::opt<string> ReadAnder;
     static const llvm::cl::opt<std ::string> ReadAnder;
+    static const llvm::cl::opt<BVDataPTAImpl::PTFileFormat> PtsFileFormat;
+    static const llvm::cl::opt<std::string> AnderSnapshot;
     static const llvm::cl::opt<bool> PtsDiff;
     static const llvm::cl::opt<bool> MergePWC;
+    static const llvm::cl::opt<bool> IncrementalSCC;
+    static const llvm::cl::opt<unsigned> SCCThreads;
+    static const llvm::cl::opt<bool> SteensPrePass;
+    static const llvm::cl::opt<bool> OfflineSubst;
+    static const llvm::cl::opt<NodeWorkList::Order> AnderWorkList;
+
+    // AndersenWaveDiff.cpp
+    static const llvm::cl::opt<unsigned> AnderThreads;
+
+    // AndersenSFR.cpp
+    static const llvm::cl::opt<unsigned> SFRMaxFieldExpand;
 
     // FlowSensitive.cpp
     static const llvm::cl::opt<bool> CTirAliasEval;
+    static const llvm::cl::opt<unsigned> FSThreads;
+    static const llvm::cl::opt<NodeWorkList::Order> FSWorkList;
+
+    // VersionedFlowSensitive.cpp
+    static const llvm::cl::opt<unsigned> VFSLabelThreads;
 
     // FlowSensitiveTBHC.cpp
     static const llvm::cl::opt<bool> TBHCStoreReuse;
@@ -0,0 +1,95 @@
+//===- Parallel.h -- Minimal fork-join helpers used in SVF-------------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * Parallel.h
+ *
+ * Solvers which run parts of their work on several threads use parallelFor
+ * as a fork-join barrier: every index of the loop has been processed when it
+ * returns. Bodies must only write to state owned by their own index; any
+ * shared state they read must not be modified during the loop. Results which
+ * have to be applied to shared structures are buffered per index and then
+ * committed sequentially in index order, which keeps solvers deterministic
+ * whatever the number of threads.
+ */
+
+#ifndef PARALLEL_H_
+#define PARALLEL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace SVF {
+
+/// Number of threads to use when the user asked for numThreads (0 meaning
+/// "as many as the hardware has").
+inline unsigned getNumOfWorkerThreads(unsigned numThreads) {
+    if (numThreads == 0) {
+        numThreads = std::thread::hardware_concurrency();
+    }
+    return std::max(numThreads, 1u);
+}
+
+/// Call body(i) for every i in [0, n) using up to numThreads threads.
+/// Indices are handed out in small chunks so uneven work is balanced.
+/// With one thread (or little work) the loop runs on the calling thread.
+template <typename Body>
+void parallelFor(size_t n, unsigned numThreads, const Body &body) {
+    numThreads = getNumOfWorkerThreads(numThreads);
+    if (numThreads == 1 || n < 2) {
+        for (size_t i = 0; i < n; ++i) {
+            body(i);
+        }
+        return;
+    }
+
+    numThreads = std::min<size_t>(numThreads, n);
+    const size_t chunk = std::max<size_t>(1, n / (numThreads * 8));
+    std::atomic<size_t> next(0);
+
+    auto worker = [&]() {
+        for (size_t begin = next.fetch_add(chunk); begin < n;
+             begin = next.fetch_add(chunk)) {
+            size_t end = std::min(begin + chunk, n);
+            for (size_t i = begin; i < end; ++i) {
+                body(i);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    for (unsigned t = 1; t < numThreads; ++t) {
+        threads.emplace_back(worker);
+    }
+    // The calling thread does its share too.
+    worker();
+    for (std::thread &t : threads) {
+        t.join();
+    }
+}
+
+} // End namespace SVF
+
+#endif /* PARALLEL_H_ */
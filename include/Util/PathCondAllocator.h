@@ -67,10 +67,23 @@ class PathCondAllocator {
                                           ///< computation
 
     using IndexToConditionMap = Map<u32_t, Condition *>;
+    using BBCondVarsMap =
+        Map<const BasicBlock *,
+            std::vector<u32_t>>; ///< map a branch to its decision variables
+
+    /// Constructor of an allocator sharing one BDD manager with the others
+    PathCondAllocator(SVFModule *svfMod)
+        : ownsCondMgr(false), svfMod(svfMod) {
+        condMgr = getBddCondManager();
+    }
 
-    /// Constructor
-    PathCondAllocator(SVFModule *svfMod) : svfMod(svfMod) {
-        getBddCondManager();
+    /// Constructor of an allocator with a private BDD manager, which reuses
+    /// the decision variables and program exits found by shared->allocate().
+    /// It may be used on a different thread than shared, which must outlive
+    /// it, but its conditions must not be mixed with those of shared.
+    explicit PathCondAllocator(const PathCondAllocator *shared)
+        : ownsCondMgr(true), sharedAllocator(shared), svfMod(shared->svfMod) {
+        condMgr = new BddCondManager();
     }
 
     /// Destructor
@@ -122,15 +135,15 @@ class PathCondAllocator {
     /// Condition operations
     //@{
     inline Condition *condAnd(Condition *lhs, Condition *rhs) {
-        return bddCondMgr->AND(lhs, rhs);
+        return condMgr->AND(lhs, rhs);
     }
     inline Condition *condOr(Condition *lhs, Condition *rhs) {
-        return bddCondMgr->OR(lhs, rhs);
+        return condMgr->OR(lhs, rhs);
     }
-    inline Condition *condNeg(Condition *cond) { return bddCondMgr->NEG(cond); }
-    inline Condition *getTrueCond() const { return bddCondMgr->getTrueCond(); }
+    inline Condition *condNeg(Condition *cond) { return condMgr->NEG(cond); }
+    inline Condition *getTrueCond() const { return condMgr->getTrueCond(); }
     inline Condition *getFalseCond() const {
-        return bddCondMgr->getFalseCond();
+        return condMgr->getFalseCond();
     }
     /// Given an index, get its condition
     inline Condition *getCond(u32_t i) const {
@@ -141,17 +154,17 @@ class PathCondAllocator {
     /// Iterator every element of the bdd
     inline NodeBS exactCondElem(Condition *cond) {
         NodeBS elems;
-        bddCondMgr->BddSupport(cond, elems);
+        condMgr->BddSupport(cond, elems);
         return elems;
     }
     /// Decrease reference counting for the bdd
     inline void markForRelease(Condition *cond) {
-        bddCondMgr->markForRelease(cond);
+        condMgr->markForRelease(cond);
     }
     /// Print debug information for this condition
-    inline void printDbg(Condition *cond) { bddCondMgr->printDbg(cond); }
+    inline void printDbg(Condition *cond) { condMgr->printDbg(cond); }
     inline std::string dumpCond(Condition *cond) const {
-        return bddCondMgr->dumpStr(cond);
+        return condMgr->dumpStr(cond);
     }
     //@}
 
@@ -185,6 +198,10 @@ class PathCondAllocator {
   private:
     /// Allocate path condition for every basic block
     virtual void allocateForBB(const BasicBlock &bb);
+    /// Create the conditions of the branches of bb from its decision
+    /// variables
+    void allocateBranchConds(const BasicBlock *bb,
+                             const std::vector<u32_t> &vars);
 
     /// Get/Set a branch condition, and its terminator instruction
     //@{
@@ -265,13 +282,13 @@ class PathCondAllocator {
     inline Condition *createNewCond(u32_t i) {
         assert(indexToDDNodeMap.find(i) == indexToDDNodeMap.end() &&
                "This should be fresh index to create new BDD");
-        Condition *d = bddCondMgr->Cudd_bdd(i);
+        Condition *d = condMgr->Cudd_bdd(i);
         indexToDDNodeMap[i] = d;
         return d;
     }
-    /// Allocate a new condition
-    inline Condition *newCond(const Instruction *inst) {
-        Condition *cond = createNewCond(totalCondNum++);
+    /// Allocate the condition of decision variable i
+    inline Condition *newCond(u32_t i, const Instruction *inst) {
+        Condition *cond = createNewCond(i);
         assert(condToInstMap.find(cond) == condToInstMap.end() &&
                "this should be a fresh condition");
         condToInstMap[cond] = inst;
@@ -294,13 +311,18 @@ class PathCondAllocator {
     PTACFInfoBuilder cfInfoBuilder;  ///< map a function to its loop info
     FunToExitBBsMap funToExitBBsMap; ///< map a function to all its basic blocks
                                      ///< calling program exit
+    BBCondVarsMap bbCondVars; ///< map a branch to its decision variables
     BBToCondMap bbToCondMap; ///< map a basic block to its path condition
                              ///< starting from root
     const Value *curEvalVal; ///< current llvm value to evaluate branch
                              ///< condition when computing guards
 
   protected:
-    static BddCondManager *bddCondMgr; ///< bbd manager
+    static BddCondManager *bddCondMgr; ///< bbd manager shared by allocators
+    BddCondManager *condMgr;           ///< bdd manager of this allocator
+    bool ownsCondMgr;                  ///< whether condMgr is private
+    /// allocator whose allocation this one reuses, if any
+    const PathCondAllocator *sharedAllocator = nullptr;
     BBCondMap bbConds; ///< map basic block to its successors/predecessors
                        ///< branch conditions
     IndexToConditionMap indexToDDNodeMap;
@@ -41,8 +41,14 @@
 #define SCC_H_
 
 #include "Util/BasicTypes.h" // for NodeBS
+#include "Util/Parallel.h"
+
+#include <algorithm>
+#include <atomic>
 #include <climits>
 #include <map>
+#include <memory>
+#include <numeric>
 #include <stack>
 #include <type_traits>
 
@@ -50,6 +56,15 @@ namespace SVF {
 
 class GNodeSCCInfo;
 
+/*!
+ * SCC detection on the direct edges of a graph.
+ *
+ * find() visits the graph with an explicit stack, so deep graphs cannot
+ * overflow the call stack. With several threads (setNumOfThreads) it uses
+ * the coloring algorithm of Orzan ("On Distributed Verification and
+ * Verified Distribution", 2004) instead. findIncremental() only revisits
+ * the part of the graph reachable from edges added since the last run.
+ */
 template <class GraphType>
 class SCCDetection {
 
@@ -87,8 +102,8 @@ class SCCDetection {
         NodeBS _subNodes; /// nodes in the scc represented by this node
     };
 
-    using GNODESCCInfoMap = Map<NodeID, GNodeSCCInfo>;
-    using NodeToNodeMap = Map<NodeID, NodeID>;
+    /// Indexed by node ID
+    using GNODESCCInfoMap = std::vector<GNodeSCCInfo>;
 
     explicit SCCDetection(const GraphType &GT) : _graph(GT), _I(0) {}
 
@@ -97,15 +112,21 @@ class SCCDetection {
     // and improve efficiency.
     inline GNodeStack &topoNodeStack() { return _T; }
 
+    /// Rep nodes in topological order, if the last detection was not
+    /// partial
+    //@{
+    inline bool hasTopoOrder() const { return _ordered; }
+    inline const std::vector<NodeID> &topoOrder() const { return _order; }
+    //@}
+
     const inline GNODESCCInfoMap &GNodeSCCInfo() const {
         return _NodeSCCAuxInfo;
     }
 
     /// get the rep node, if not found, return itself
     inline NodeID repNode(NodeID n) const {
-        typename GNODESCCInfoMap::const_iterator it = _NodeSCCAuxInfo.find(n);
-        assert(it != _NodeSCCAuxInfo.end() && "scc rep not found");
-        NodeID rep = it->second.rep();
+        assert(n < _NodeSCCAuxInfo.size() && "scc rep not found");
+        NodeID rep = _NodeSCCAuxInfo[n].rep();
         return rep != UINT_MAX ? rep : n;
     }
 
@@ -133,9 +154,8 @@ class SCCDetection {
 
     /// get all subnodes in one scc
     inline const NodeBS &subNodes(NodeID n) const {
-        typename GNODESCCInfoMap::const_iterator it = _NodeSCCAuxInfo.find(n);
-        assert(it != _NodeSCCAuxInfo.end() && "scc rep not found");
-        return it->second.subNodes();
+        assert(n < _NodeSCCAuxInfo.size() && "scc rep not found");
+        return _NodeSCCAuxInfo[n].subNodes();
     }
 
     /// get all repNodeID
@@ -143,22 +163,55 @@ class SCCDetection {
 
     const inline GraphType &graph() { return _graph; }
 
+    /// Number of threads used by find() (0 uses all hardware threads)
+    inline void setNumOfThreads(unsigned n) {
+        numOfThreads = getNumOfWorkerThreads(n);
+    }
+
   private:
+    /// A node whose children are being visited
+    struct VisitFrame {
+        NodeID v;
+        child_iterator EI;
+        child_iterator EE;
+    };
+
+    /// Direct edges of the graph with the nodes numbered 0..size()-1
+    struct EdgeSnapshot {
+        std::vector<NodeID> ids; /// number -> node ID
+        std::vector<u32_t> succOffsets;
+        std::vector<u32_t> succs;
+        std::vector<u32_t> predOffsets;
+        std::vector<u32_t> preds;
+
+        inline u32_t size() const { return ids.size(); }
+    };
+
     GNODESCCInfoMap _NodeSCCAuxInfo; /// NodeID -> GNodeSCCInfo
 
     const GraphType _graph;
-    NodeID _I;        /// timestamp variable
-    NodeToNodeMap _D; /// this map is used to save
-                      /// the timestamp of a node when it is visited
-    GNodeStack _SS;   /// the internal stack for saving the nodes
-                      /// in a strongly connected components
-    GNodeStack _T;    /// all the representative nodes
+    u64_t _I;                     /// timestamp variable, never reset
+    u64_t _runStart = 0;          /// _I when the current detection started
+    std::vector<u64_t> _D;        /// this vector is used to save
+                                  /// the timestamp of a node when it is
+                                  /// visited, 0 if it never was
+    GNodeStack _SS;               /// the internal stack for saving the nodes
+                                  /// in a strongly connected components
+    GNodeStack _T;                /// all the representative nodes
     NodeBS repNodes;
-
-    inline bool visited(NodeID n) { return _NodeSCCAuxInfo[n].visited(); }
+    std::vector<VisitFrame> _DFS; /// the explicit stack of the DFS
+    std::vector<NodeID> _finished; /// rep nodes of the current detection
+                                   /// in the order their SCCs completed
+    std::vector<NodeID> _order;    /// all rep nodes in topological order,
+    bool _ordered = false;         /// if the last detection was not partial
+    unsigned numOfThreads = 1;
+
+    /// The node was visited by the current detection
+    inline bool visited(NodeID n) const {
+        return n < _D.size() && _D[n] > _runStart;
+    }
     inline bool inSCC(NodeID n) { return _NodeSCCAuxInfo[n].inSCC(); }
 
-    inline void setVisited(NodeID n, bool v) { _NodeSCCAuxInfo[n].visited(v); }
     inline void setInSCC(NodeID n, bool v) { _NodeSCCAuxInfo[n].inSCC(v); }
     inline void rep(NodeID n, NodeID r) {
         _NodeSCCAuxInfo[n].rep(r);
@@ -169,7 +222,6 @@ class SCCDetection {
     }
 
     inline NodeID rep(NodeID n) { return _NodeSCCAuxInfo[n].rep(); }
-    inline bool isInSCC(NodeID n) { return _NodeSCCAuxInfo[n].inSCC(); }
 
     inline GNODE Node(NodeID id) const { return GTraits::getNode(_graph, id); }
 
@@ -177,28 +229,51 @@ class SCCDetection {
         return GTraits::getNodeID(node);
     }
 
-    /// A standard Tarjan algorithm to compute strongly-connected
-    /// components
-    void visit(NodeID v) {
-        // SVFUtil::outs() << "visit GNODE: " << Node_Index(v)<< "\n";
-        // save the timestamp of node v
-        _I += 1;
-        _D[v] = _I;
-
-        // set v as the representative of itself
-        rep(v, v);
-        setVisited(v, true);
+    /// Give n a timestamp and drop what an earlier detection found for it
+    inline void stamp(NodeID n) {
+        if (n >= _D.size()) {
+            _NodeSCCAuxInfo.resize(n + 1);
+            _D.resize(n + 1, 0);
+        }
+        _D[n] = ++_I;
 
-        child_iterator EI = GTraits::direct_child_begin(Node(v));
-        child_iterator EE = GTraits::direct_child_end(Node(v));
+        auto &info = _NodeSCCAuxInfo[n];
+        info.visited(true);
+        info.inSCC(false);
+        info.rep(UINT_MAX);
+        info.subNodes().clear();
+    }
 
-        // DFS the graph
-        for (; EI != EE; ++EI) {
-            NodeID w = Node_Index(*EI);
+    /// Start visiting v, it is the representative of itself until a
+    /// back-edge says otherwise
+    inline void enter(NodeID v) {
+        stamp(v);
+        rep(v, v);
+        GNODE node = Node(v);
+        _DFS.push_back({v, GTraits::direct_child_begin(node),
+                        GTraits::direct_child_end(node)});
+    }
 
+    /// A standard Tarjan algorithm to compute strongly-connected
+    /// components, with the recursion replaced by the _DFS stack
+    void visit(NodeID root) {
+        enter(root);
+        while (!_DFS.empty()) {
+            VisitFrame &frame = _DFS.back();
+            NodeID v = frame.v;
+            if (frame.EI == frame.EE) {
+                _DFS.pop_back();
+                finish(v);
+                continue;
+            }
+
+            // DFS the graph; w is looked at again once it is finished
+            NodeID w = Node_Index(*frame.EI);
             if (!visited(w)) {
-                visit(w);
+                enter(w);
+                continue;
             }
+            ++frame.EI;
 
             if (!inSCC(w)) {
                 // if this is a back-edge
@@ -209,7 +284,10 @@ class SCCDetection {
                 rep(v, _rep);
             }
         }
+    }
 
+    /// All children of v have been visited
+    void finish(NodeID v) {
         if (rep(v) == v) {
             // this is a root (representative)
             // of a strongly-connected component
@@ -228,8 +306,8 @@ class SCCDetection {
             }
 
             // Save the root (representative) of each
-            // strongly-connected component to the stack
-            _T.push(v);
+            // strongly-connected component
+            _finished.push_back(v);
             repNodes.set(v);
         } else {
             /// The node is one node in a SCC (not the SCC root),
@@ -239,41 +317,289 @@ class SCCDetection {
     }
 
     void clear() {
-        _NodeSCCAuxInfo.clear();
-        _I = 0;
-        _D.clear();
+        assert(_SS.empty() && _DFS.empty() && "detection not finished");
+        _runStart = _I;
         repNodes.clear();
-
-        while (!_SS.empty()) {
-            _SS.pop();
-        }
+        _finished.clear();
 
         while (!_T.empty()) {
             _T.pop();
         }
     }
 
+    /// Use order (rep nodes, sources first) as the result of this detection
+    void setTopoOrder(std::vector<NodeID> &order) {
+        for (auto it = order.rbegin(), eit = order.rend(); it != eit; ++it) {
+            _T.push(*it);
+        }
+        _order.swap(order);
+        _ordered = true;
+    }
+
+    /// Take a snapshot of the direct edges of the graph
+    void buildEdgeSnapshot(EdgeSnapshot &g) const {
+        NodeID maxId = 0;
+        for (node_iterator I = GTraits::nodes_begin(_graph),
+                           E = GTraits::nodes_end(_graph);
+             I != E; ++I) {
+            g.ids.push_back(Node_Index(*I));
+            maxId = std::max(maxId, g.ids.back());
+        }
+
+        std::vector<u32_t> number(g.ids.empty() ? 0 : maxId + 1, UINT_MAX);
+        for (u32_t i = 0; i < g.size(); ++i) {
+            number[g.ids[i]] = i;
+        }
+
+        g.succOffsets.reserve(g.size() + 1);
+        for (u32_t i = 0; i < g.size(); ++i) {
+            g.succOffsets.push_back(g.succs.size());
+            GNODE node = Node(g.ids[i]);
+            child_iterator EI = GTraits::direct_child_begin(node);
+            child_iterator EE = GTraits::direct_child_end(node);
+            for (; EI != EE; ++EI) {
+                g.succs.push_back(number[Node_Index(*EI)]);
+            }
+        }
+        g.succOffsets.push_back(g.succs.size());
+
+        // Reverse the edges by counting sort on their destinations
+        g.predOffsets.assign(g.size() + 1, 0);
+        for (u32_t j : g.succs) {
+            g.predOffsets[j + 1]++;
+        }
+        for (u32_t i = 0; i < g.size(); ++i) {
+            g.predOffsets[i + 1] += g.predOffsets[i];
+        }
+        std::vector<u32_t> pos(g.predOffsets.begin(), g.predOffsets.end() - 1);
+        g.preds.resize(g.succs.size());
+        for (u32_t i = 0; i < g.size(); ++i) {
+            for (u32_t k = g.succOffsets[i]; k < g.succOffsets[i + 1]; ++k) {
+                g.preds[pos[g.succs[k]]++] = i;
+            }
+        }
+    }
+
+    /// Make every node of todo without incoming or outgoing edges from or
+    /// to other unassigned nodes an SCC of its own, until there are none
+    void trim(const EdgeSnapshot &g, const std::vector<u32_t> &todo,
+              std::vector<u32_t> &sccOf) const {
+        std::vector<u32_t> inDeg(g.size(), 0);
+        std::vector<u32_t> outDeg(g.size(), 0);
+        for (u32_t i : todo) {
+            for (u32_t k = g.succOffsets[i]; k < g.succOffsets[i + 1]; ++k) {
+                u32_t j = g.succs[k];
+                if (j != i && sccOf[j] == UINT_MAX) {
+                    outDeg[i]++;
+                    inDeg[j]++;
+                }
+            }
+        }
+
+        std::vector<u32_t> worklist;
+        for (u32_t i : todo) {
+            if (inDeg[i] == 0 || outDeg[i] == 0) {
+                worklist.push_back(i);
+            }
+        }
+        while (!worklist.empty()) {
+            u32_t i = worklist.back();
+            worklist.pop_back();
+            if (sccOf[i] != UINT_MAX) {
+                continue;
+            }
+
+            sccOf[i] = i;
+            for (u32_t k = g.succOffsets[i]; k < g.succOffsets[i + 1]; ++k) {
+                u32_t j = g.succs[k];
+                if (j != i && sccOf[j] == UINT_MAX && --inDeg[j] == 0) {
+                    worklist.push_back(j);
+                }
+            }
+            for (u32_t k = g.predOffsets[i]; k < g.predOffsets[i + 1]; ++k) {
+                u32_t j = g.preds[k];
+                if (j != i && sccOf[j] == UINT_MAX && --outDeg[j] == 0) {
+                    worklist.push_back(j);
+                }
+            }
+        }
+    }
+
+    /// SCC of every node of g: the lowest number of a node in it. Colors
+    /// are propagated forwards until every node has the lowest number of
+    /// the nodes reaching it; the nodes keeping their own number are roots,
+    /// and each root's SCC is the nodes of its color reaching it. Both
+    /// steps run on several threads; their result does not depend on the
+    /// schedule.
+    void colorSCCs(const EdgeSnapshot &g, std::vector<u32_t> &sccOf) const {
+        std::unique_ptr<std::atomic<u32_t>[]> color(
+            new std::atomic<u32_t>[g.size()]);
+        std::unique_ptr<std::atomic<bool>[]> changed(
+            new std::atomic<bool>[g.size()]);
+        for (u32_t i = 0; i < g.size(); ++i) {
+            changed[i].store(false, std::memory_order_relaxed);
+        }
+
+        std::vector<u32_t> todo(g.size());
+        std::iota(todo.begin(), todo.end(), 0);
+        while (true) {
+            trim(g, todo, sccOf);
+            todo.erase(std::remove_if(todo.begin(), todo.end(),
+                                      [&](u32_t i) {
+                                          return sccOf[i] != UINT_MAX;
+                                      }),
+                       todo.end());
+            if (todo.empty()) {
+                break;
+            }
+
+            for (u32_t i : todo) {
+                color[i].store(i, std::memory_order_relaxed);
+            }
+
+            std::vector<u32_t> frontier(todo);
+            while (!frontier.empty()) {
+                parallelFor(frontier.size(), numOfThreads, [&](size_t f) {
+                    u32_t i = frontier[f];
+                    u32_t c = color[i].load(std::memory_order_relaxed);
+                    for (u32_t k = g.succOffsets[i]; k < g.succOffsets[i + 1];
+                         ++k) {
+                        u32_t j = g.succs[k];
+                        if (sccOf[j] != UINT_MAX) {
+                            continue;
+                        }
+                        u32_t old = color[j].load(std::memory_order_relaxed);
+                        while (old > c && !color[j].compare_exchange_weak(
+                                              old, c,
+                                              std::memory_order_relaxed)) {
+                        }
+                        if (old > c) {
+                            changed[j].store(true, std::memory_order_relaxed);
+                        }
+                    }
+                });
+
+                frontier.clear();
+                for (u32_t i : todo) {
+                    if (changed[i].exchange(false, std::memory_order_relaxed)) {
+                        frontier.push_back(i);
+                    }
+                }
+            }
+
+            std::vector<u32_t> roots;
+            for (u32_t i : todo) {
+                if (color[i].load(std::memory_order_relaxed) == i) {
+                    roots.push_back(i);
+                }
+            }
+            // Roots have different colors, so no node is claimed twice.
+            parallelFor(roots.size(), numOfThreads, [&](size_t r) {
+                u32_t root = roots[r];
+                std::vector<u32_t> queue(1, root);
+                sccOf[root] = root;
+                for (size_t q = 0; q < queue.size(); ++q) {
+                    u32_t i = queue[q];
+                    for (u32_t k = g.predOffsets[i]; k < g.predOffsets[i + 1];
+                         ++k) {
+                        u32_t j = g.preds[k];
+                        if (color[j].load(std::memory_order_relaxed) == root &&
+                            sccOf[j] == UINT_MAX) {
+                            sccOf[j] = root;
+                            queue.push_back(j);
+                        }
+                    }
+                }
+            });
+        }
+    }
+
+    /// find() on several threads
+    void findInParallel() {
+        clear();
+        EdgeSnapshot g;
+        buildEdgeSnapshot(g);
+        std::vector<u32_t> sccOf(g.size(), UINT_MAX);
+        colorSCCs(g, sccOf);
+
+        for (NodeID id : g.ids) {
+            stamp(id);
+            setInSCC(id, true);
+        }
+        for (u32_t i = 0; i < g.size(); ++i) {
+            rep(g.ids[i], g.ids[sccOf[i]]);
+        }
+
+        // Order the SCCs topologically (Kahn's algorithm)
+        std::vector<u32_t> inDeg(g.size(), 0);
+        for (u32_t i = 0; i < g.size(); ++i) {
+            for (u32_t k = g.succOffsets[i]; k < g.succOffsets[i + 1]; ++k) {
+                if (sccOf[g.succs[k]] != sccOf[i]) {
+                    inDeg[sccOf[g.succs[k]]]++;
+                }
+            }
+        }
+
+        // Group the nodes by SCC
+        std::vector<u32_t> memberOffsets(g.size() + 1, 0);
+        for (u32_t i = 0; i < g.size(); ++i) {
+            memberOffsets[sccOf[i] + 1]++;
+        }
+        for (u32_t i = 0; i < g.size(); ++i) {
+            memberOffsets[i + 1] += memberOffsets[i];
+        }
+        std::vector<u32_t> members(g.size());
+        std::vector<u32_t> pos(memberOffsets.begin(), memberOffsets.end() - 1);
+        for (u32_t i = 0; i < g.size(); ++i) {
+            members[pos[sccOf[i]]++] = i;
+        }
+
+        std::vector<u32_t> queue;
+        for (u32_t i = 0; i < g.size(); ++i) {
+            if (sccOf[i] == i && inDeg[i] == 0) {
+                queue.push_back(i);
+            }
+        }
+        std::vector<NodeID> order;
+        for (size_t q = 0; q < queue.size(); ++q) {
+            u32_t root = queue[q];
+            order.push_back(g.ids[root]);
+            repNodes.set(g.ids[root]);
+            for (u32_t m = memberOffsets[root]; m < memberOffsets[root + 1];
+                 ++m) {
+                u32_t i = members[m];
+                for (u32_t k = g.succOffsets[i]; k < g.succOffsets[i + 1];
+                     ++k) {
+                    u32_t s = sccOf[g.succs[k]];
+                    if (s != root && --inDeg[s] == 0) {
+                        queue.push_back(s);
+                    }
+                }
+            }
+        }
+        assert(order.size() == repNodes.count() && "SCC graph has a cycle?");
+        setTopoOrder(order);
+    }
+
   public:
     void find() {
-        // Visit each unvisited root node.   A root node is defined
-        // to be a node that has no incoming copy/skew edges
+        if (numOfThreads > 1) {
+            findInParallel();
+            return;
+        }
+
         clear();
         node_iterator I = GTraits::nodes_begin(_graph);
         node_iterator E = GTraits::nodes_end(_graph);
         for (; I != E; ++I) {
             NodeID node = Node_Index(*I);
             if (!visited(node)) {
-                // We skip any nodes that have a representative other than
-                // themselves.  Such nodes occur as a result of merging
-                // nodes either through unifying an ACC or other node
-                // merging optimizations.  Any such node should have no
-                // outgoing edges and therefore should no longer be a member
-                // of an SCC.
-                if (rep(node) == UINT_MAX || rep(node) == node) {
-                    visit(node);
-                }
+                visit(node);
             }
         }
+
+        std::vector<NodeID> order(_finished.rbegin(), _finished.rend());
+        setTopoOrder(order);
     }
 
     void find(const NodeSet &candidates) {
@@ -281,11 +607,79 @@ class SCCDetection {
         clear();
         for (NodeID node : candidates) {
             if (!visited(node)) {
-                if (rep(node) == UINT_MAX || rep(node) == node) {
-                    visit(node);
+                visit(node);
+            }
+        }
+
+        for (NodeID rep : _finished) {
+            _T.push(rep);
+        }
+        // Other nodes have not been ordered.
+        _ordered = false;
+    }
+
+    /// Update the SCCs after direct edges have been added to the graph,
+    /// srcs being the sources of the edges added since the last find() or
+    /// findIncremental(). A new cycle goes through a new edge, so only the
+    /// nodes reachable from srcs and from new nodes are visited again. The
+    /// others keep their SCCs and their topological order, before all the
+    /// nodes visited again as those cannot reach them. Nodes merged into
+    /// their rep must have been removed from the graph; no edge may have
+    /// been removed otherwise, as that could split the SCCs which are kept.
+    void findIncremental(const NodeBS &srcs) {
+        if (!_ordered) {
+            find();
+            return;
+        }
+
+        clear();
+        std::vector<bool> present;
+        std::vector<NodeID> newNodes;
+        for (node_iterator I = GTraits::nodes_begin(_graph),
+                           E = GTraits::nodes_end(_graph);
+             I != E; ++I) {
+            NodeID node = Node_Index(*I);
+            if (node >= present.size()) {
+                present.resize(node + 1, false);
+            }
+            present[node] = true;
+            if (node >= _D.size() || _D[node] == 0) {
+                newNodes.push_back(node);
+            }
+        }
+        auto isPresent = [&present](NodeID n) {
+            return n < present.size() && present[n];
+        };
+
+        for (NodeID src : srcs) {
+            if (isPresent(src) && !visited(src)) {
+                visit(src);
+            }
+        }
+        for (NodeID node : newNodes) {
+            if (!visited(node)) {
+                visit(node);
+            }
+        }
+
+        std::vector<NodeID> order;
+        for (NodeID repId : _order) {
+            if (!isPresent(repId) || visited(repId)) {
+                continue;
+            }
+
+            NodeBS merged;
+            for (NodeID sub : subNodes(repId)) {
+                if (!isPresent(sub)) {
+                    merged.set(sub);
                 }
             }
+            _NodeSCCAuxInfo[repId].subNodes().intersectWithComplement(merged);
+            order.push_back(repId);
+            repNodes.set(repId);
         }
+        order.insert(order.end(), _finished.rbegin(), _finished.rend());
+        setTopoOrder(order);
     }
 };
 
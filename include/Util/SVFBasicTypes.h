@@ -62,6 +62,8 @@ using Version = unsigned int;
 using NodeBS = llvm::SparseBitVector<>;
 using PointsTo = NodeBS;
 using AliasSet = PointsTo;
+/// Handle to a points-to set interned by a PersistentPointsToCache.
+using PointsToID = unsigned;
 
 template <typename Key, typename Hash = std::hash<Key>,
           typename KeyEqual = std::equal_to<Key>,
@@ -233,4 +235,18 @@ struct std::hash<SVF::SmallVector<T, N>> {
     }
 };
 
+/// Specialise hash for SparseBitVectors (used to intern points-to sets).
+template <unsigned N>
+struct std::hash<llvm::SparseBitVector<N>> {
+    size_t operator()(const llvm::SparseBitVector<N> &sbv) const {
+        std::hash<std::pair<size_t, size_t>> hts;
+        size_t hash = sbv.count();
+        for (unsigned e : sbv) {
+            hash = hts(std::make_pair(hash, static_cast<size_t>(e)));
+        }
+
+        return hash;
+    }
+};
+
 #endif /* INCLUDE_UTIL_SVFBASICTYPES_H_ */
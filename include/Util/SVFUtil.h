@@ -87,6 +87,9 @@ void reportMemoryUsageKB(const std::string &infor,
 /// Get memory usage from system file. Return TRUE if succeed.
 bool getMemoryUsageKB(u32_t *vmrss_kb, u32_t *vmsize_kb);
 
+/// Peak resident set size of the process in KB (0 if unknown)
+u32_t getPeakMemoryUsageKB();
+
 /// Increase the stack size limit
 void increaseStackSize();
 
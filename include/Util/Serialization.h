@@ -21,8 +21,12 @@
 
 #ifndef SERIALIZATION_H_
 #define SERIALIZATION_H_
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
 #include <boost/serialization/array.hpp>
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/binary_object.hpp>
@@ -333,4 +337,79 @@ void load_pair(Archive &ar, std::pair<FirstType, SecondType> &pair) {
 } // end of namespace serialization
 } // end of namespace boost
 
+namespace SVF {
+
+/// Save obj into os with an archive of the given kind.
+/// obj is typically a pointer to a graph, node or edge.
+template <typename T>
+void saveToArchive(std::ostream &os, const T &obj,
+                   SVFProject::ArchiveKind kind) {
+    switch (kind) {
+    case SVFProject::TextArchive: {
+        boost::archive::text_oarchive oa{os};
+        oa << obj;
+        break;
+    }
+    case SVFProject::BinaryArchive: {
+        boost::archive::binary_oarchive oa{os};
+        oa << obj;
+        break;
+    }
+    case SVFProject::CompressedBinaryArchive: {
+        boost::iostreams::filtering_ostream zos;
+        zos.push(boost::iostreams::zlib_compressor());
+        zos.push(os);
+        {
+            boost::archive::binary_oarchive oa{zos};
+            oa << obj;
+        }
+        // Flush the compressor before os is used again.
+        zos.reset();
+        break;
+    }
+    }
+}
+
+/// Load obj from is, which must have been written by saveToArchive with the
+/// same kind.
+template <typename T>
+void loadFromArchive(std::istream &is, T &obj, SVFProject::ArchiveKind kind) {
+    switch (kind) {
+    case SVFProject::TextArchive: {
+        boost::archive::text_iarchive ia{is};
+        ia >> obj;
+        break;
+    }
+    case SVFProject::BinaryArchive: {
+        boost::archive::binary_iarchive ia{is};
+        ia >> obj;
+        break;
+    }
+    case SVFProject::CompressedBinaryArchive: {
+        boost::iostreams::filtering_istream zis;
+        zis.push(boost::iostreams::zlib_decompressor());
+        zis.push(is);
+        boost::archive::binary_iarchive ia{zis};
+        ia >> obj;
+        break;
+    }
+    }
+}
+
+/// Save/load with the archive kind of the current project.
+//@{
+template <typename T> void saveToArchive(std::ostream &os, const T &obj) {
+    assert(SVFProject::getCurrentProject() && "no current project!");
+    saveToArchive(os, obj, SVFProject::getCurrentProject()->getArchiveKind());
+}
+
+template <typename T> void loadFromArchive(std::istream &is, T &obj) {
+    assert(SVFProject::getCurrentProject() && "no current project!");
+    loadFromArchive(is, obj,
+                    SVFProject::getCurrentProject()->getArchiveKind());
+}
+//@}
+
+} // end of namespace SVF
+
 #endif // SERIALIZATION_H_
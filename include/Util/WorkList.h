@@ -37,7 +37,9 @@
 
 #include "Util/BasicTypes.h"
 
+#include <algorithm>
 #include <assert.h>
+#include <climits>
 #include <cstdlib>
 #include <deque>
 #include <set>
@@ -234,6 +236,192 @@ class FILOWorkList {
     DataVector data_list; ///< work list using std::vector.
 };
 
+/**
+ * Worklist of node IDs with an order chosen at run time.
+ * Membership is kept in a bit vector indexed by ID, FIFO order in a ring
+ * buffer and the other orders in binary heaps, so pushing and popping do
+ * not allocate once the buffers have grown.
+ *  - FIFO: first in first out.
+ *  - LRF: least recently fired first; a node fires when it is popped.
+ *  - TOPO: two phases in topological order. Nodes pushed while a phase is
+ *    processed join it if they come after the last popped node, and wait
+ *    for the next phase otherwise.
+ *  - PRIO: lowest topological rank first, in a single priority queue.
+ * Topological ranks are set by the solver; nodes without one come last.
+ */
+class NodeWorkList {
+  public:
+    enum class Order { FIFO, LRF, TOPO, PRIO };
+
+    explicit NodeWorkList(Order order = Order::FIFO) : order(order) {}
+
+    /// Change the order of an empty worklist
+    inline void setOrder(Order o) {
+        assert(empty() && "work list is not empty");
+        order = o;
+    }
+    inline Order getOrder() const { return order; }
+
+    /// Whether the order depends on the topological ranks
+    inline bool needsRanks() const {
+        return order == Order::TOPO || order == Order::PRIO;
+    }
+
+    /// Set the topological rank of a node, which is used when it is pushed
+    inline void setRank(NodeID id, u32_t rank) {
+        if (id >= ranks.size()) {
+            ranks.resize(id + 1, UINT_MAX);
+        }
+        ranks[id] = rank;
+    }
+
+    inline bool empty() const { return numOfNodes == 0; }
+
+    inline bool find(NodeID id) const {
+        return id < inList.size() && inList[id];
+    }
+
+    /**
+     * Push a node into the work list.
+     */
+    inline bool push(NodeID id) {
+        if (find(id)) {
+            return false;
+        }
+
+        if (id >= inList.size()) {
+            inList.resize(std::max<size_t>(id + 1, 2 * inList.size()), false);
+        }
+        inList[id] = true;
+        numOfNodes++;
+
+        switch (order) {
+        case Order::FIFO:
+            pushRing(id);
+            break;
+        case Order::LRF:
+            pushHeap(Entry{id < fired.size() ? fired[id] : 0, id});
+            break;
+        case Order::TOPO:
+            if (inPhase && getRank(id) > phaseRank) {
+                pushHeap(Entry{getRank(id), id});
+            } else {
+                next.push_back(Entry{getRank(id), id});
+            }
+            break;
+        case Order::PRIO:
+            pushHeap(Entry{getRank(id), id});
+            break;
+        }
+        return true;
+    }
+
+    /**
+     * Pop the next node in the order of the work list.
+     */
+    inline NodeID pop() {
+        assert(!empty() && "work list is empty");
+        NodeID id;
+        if (order == Order::FIFO) {
+            id = ring[head];
+            head = (head + 1) & (ring.size() - 1);
+            ringSize--;
+        } else {
+            if (heap.empty()) {
+                // Only the two-phase order has nodes waiting.
+                heap.swap(next);
+                std::make_heap(heap.begin(), heap.end(), later);
+                inPhase = true;
+            }
+            std::pop_heap(heap.begin(), heap.end(), later);
+            id = heap.back().id;
+            phaseRank = heap.back().key;
+            heap.pop_back();
+
+            if (order == Order::LRF) {
+                if (id >= fired.size()) {
+                    fired.resize(id + 1, 0);
+                }
+                fired[id] = ++clock;
+            }
+        }
+
+        inList[id] = false;
+        numOfNodes--;
+        return id;
+    }
+
+    /*!
+     * Clear all the data
+     */
+    inline void clear() {
+        inList.assign(inList.size(), false);
+        head = 0;
+        ringSize = 0;
+        heap.clear();
+        next.clear();
+        inPhase = false;
+        numOfNodes = 0;
+    }
+
+  private:
+    struct Entry {
+        u64_t key;
+        NodeID id;
+    };
+
+    Order order;
+    std::vector<bool> inList; ///< nodes in the work list
+    u32_t numOfNodes = 0;
+
+    /// Ring buffer of the FIFO order, whose capacity is a power of 2
+    //@{
+    std::vector<NodeID> ring;
+    size_t head = 0;
+    size_t ringSize = 0;
+    //@}
+
+    /// Min-heap of the other orders and, for the two-phase order, the
+    /// nodes of the next phase
+    //@{
+    std::vector<Entry> heap;
+    std::vector<Entry> next;
+    bool inPhase = false;
+    u64_t phaseRank = 0;
+    //@}
+
+    std::vector<u32_t> ranks; ///< topological ranks
+    std::vector<u64_t> fired; ///< when each node was last popped
+    u64_t clock = 0;
+
+    inline u64_t getRank(NodeID id) const {
+        return id < ranks.size() ? ranks[id] : UINT_MAX;
+    }
+
+    /// Heap order: the entry with the lowest key (then ID) is popped first
+    static inline bool later(const Entry &lhs, const Entry &rhs) {
+        return lhs.key > rhs.key || (lhs.key == rhs.key && lhs.id > rhs.id);
+    }
+
+    inline void pushHeap(const Entry &entry) {
+        heap.push_back(entry);
+        std::push_heap(heap.begin(), heap.end(), later);
+    }
+
+    inline void pushRing(NodeID id) {
+        if (ringSize == ring.size()) {
+            std::vector<NodeID> grown(std::max<size_t>(16, 2 * ring.size()));
+            for (size_t i = 0; i < ringSize; ++i) {
+                grown[i] = ring[(head + i) & (ring.size() - 1)];
+            }
+            ring.swap(grown);
+            head = 0;
+        }
+        ring[(head + ringSize) & (ring.size() - 1)] = id;
+        ringSize++;
+    }
+};
+
 } // End namespace SVF
 
 #endif /* WORKLIST_H_ */
@@ -37,6 +37,8 @@
 #include "Graphs/OfflineConsG.h"
 #include "Graphs/PAG.h"
 #include "MemoryModel/PointerAnalysisImpl.h"
+#include "WPA/OfflineVarSubst.h"
+#include "WPA/SteensgaardSolver.h"
 #include "WPA/WPASolver.h"
 #include "WPA/WPAStat.h"
 
@@ -126,6 +128,19 @@ class AndersenBase : public WPAConstraintSolver, public BVDataPTAImpl {
     //@}
 
   protected:
+    /// Incremental solving across versions of a program (-ander-snapshot)
+    //@{
+    /// Seed points-to sets with the results of a previous run, except for
+    /// the nodes of functions changed since, unless constraints of that run
+    /// were removed. Returns the number of nodes seeded.
+    u32_t seedFromSnapshot(const std::string &filename);
+    /// Record a snapshot of the program and the results of this run
+    void writeSnapshot(const std::string &filename);
+    //@}
+
+    /// Number of field-insensitive objects, which only grows while solving
+    u32_t getNumOfFieldInsensitiveObjs();
+
     /// Constraint Graph
     ConstraintGraph *consCG = nullptr;
 };
@@ -145,7 +160,7 @@ class Andersen : public AndersenBase {
         : AndersenBase(proj, type, alias_check), pwcOpt(false), diffOpt(true) {}
 
     /// Destructor
-    ~Andersen() override {}
+    ~Andersen() override { delete steensPrePass; }
 
     /// Initialize analysis
     void initialize() override;
@@ -188,20 +203,32 @@ class Andersen : public AndersenBase {
 
     /// Operation of points-to set
     inline const PointsTo &getPts(NodeID id) override {
-        return getPTDataTy()->getPts(sccRepNode(id));
+        id = sccRepNode(id);
+        loadPts(id);
+        return getPTDataTy()->getPts(id);
     }
 
     inline bool unionPts(NodeID id, const PointsTo &target) override {
         id = sccRepNode(id);
+        loadPts(id);
         return getPTDataTy()->unionPts(id, target);
     }
 
     inline bool unionPts(NodeID id, NodeID ptd) override {
         id = sccRepNode(id);
         ptd = sccRepNode(ptd);
+        loadPts(id);
+        loadPts(ptd);
         return getPTDataTy()->unionPts(id, ptd);
     }
 
+    /// Alias queries Steensgaard's pre-analysis answers with no-alias do
+    /// not look at the points-to sets
+    //@{
+    using BVDataPTAImpl::alias;
+    AliasResult alias(NodeID node1, NodeID node2) override;
+    //@}
+
     void dumpTopLevelPtsTo() override;
 
     void setPWCOpt(bool flag) {
@@ -229,6 +256,14 @@ class Andersen : public AndersenBase {
     bool pwcOpt;
     bool diffOpt;
 
+    /// Steensgaard's analysis run before solving (-steens-prepass)
+    SteensgaardSolver *steensPrePass = nullptr;
+    /// Remove the constraints which cannot carry any object as the nodes
+    /// in emptyNodes point to nothing
+    void removeEmptyPtsConstraints(const NodeBS &emptyNodes);
+    /// Merge pointer-equivalent nodes offline (-offline-var-subst)
+    void substituteOffline();
+
     /// Handle diff points-to set.
     virtual inline void computeDiffPts(NodeID id) {
         if (enableDiff()) {
@@ -381,6 +416,7 @@ class AndersenWaveDiff : public Andersen {
         return diffWave;
     }
 
+    void initialize() override;
     void solveWorklist() override;
     void processNode(NodeID nodeId) override;
     virtual void postProcessNode(NodeID nodeId);
@@ -392,6 +428,27 @@ class AndersenWaveDiff : public Andersen {
   protected:
     void mergeNodeToRep(NodeID nodeId, NodeID newRepId) override;
 
+    /// Re-process worklist nodes once more when PWCs are not merged
+    void processPWCWorklist();
+
+    /// Parallel wave propagation (-ander-threads).
+    /// Computes the same points-to sets as the sequential solver.
+    //@{
+    /// Whether the parallel solver can be used for this analysis
+    virtual bool canSolveInParallel() const;
+    void solveWorklistInParallel();
+    /// Bucket the nodes of the SCC DAG by their longest distance from a root
+    void computeTopoLevels(NodeStack &nodeStack,
+                           std::vector<NodeVector> &levels);
+    /// Propagate diff points-to sets along the copy/gep edges of one level
+    void propagateLevel(const NodeVector &level);
+    /// Handle loads/stores of all worklist nodes in one batch
+    void postProcessWorklist();
+    //@}
+
+    /// Number of threads used by the parallel solver, 1 if sequential
+    unsigned numOfThreads = 1;
+
     /// process "bitcast" CopyCGEdge
     virtual void processCast(const ConstraintEdge *) {}
 };
@@ -98,6 +98,7 @@ class AndersenSFR : public AndersenSCD {
     static AndersenSFR *sfrAndersen;
 
     CSC *csc;
+    StrideCache *strideCache = nullptr;
     NodeSet sfrObjNodes;
     FieldReps fieldReps;
 
@@ -126,6 +127,7 @@ class AndersenSFR : public AndersenSCD {
             delete (csc);
             csc = nullptr;
         }
+        delete strideCache;
     }
 
   protected:
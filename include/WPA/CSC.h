@@ -38,6 +38,7 @@
 #include <limits.h>
 #include <map>
 #include <stack>
+#include <tuple>
 
 namespace SVF {
 
@@ -83,6 +84,51 @@ class CSC {
     //    const NodeSet& getPWCReps() const { return  _pwcReps; }
 };
 
+/*!
+ * class StrideCache: memoised stride expansion for SFR
+ *
+ * Expanding an object o by the strides S of a positive weight cycle from
+ * offset f gives the fields of o's object at o's offset + f + k * s (s in S)
+ * below the object's field limit. These only depend on o, f and S, so the
+ * offsets of each expansion are computed once and its field nodes are only
+ * created the first time it is asked for. Stride sets are interned, so
+ * nodes with the same strides share their expansions.
+ */
+class StrideCache {
+  public:
+    explicit StrideCache(ConstraintGraph *g) : _consG(g) {}
+
+    /// Fields obj expands to from offset by strides, nullptr (and no field
+    /// created) if there would be more than maxFields of them (0 for no
+    /// limit). obj must not be field-insensitive.
+    const PointsTo *getFields(NodeID obj, Size_t offset, const NodeBS &strides,
+                              u32_t maxFields);
+
+    inline u32_t getNumOfHits() const { return numOfHits; }
+    inline u32_t getNumOfMisses() const { return numOfMisses; }
+
+  private:
+    using OffsetsKey = std::tuple<Size_t, Size_t, u32_t, Size_t>;
+    using FieldsKey = std::tuple<NodeID, Size_t, u32_t>;
+
+    ConstraintGraph *_consG;
+    Map<NodeBS, u32_t> strideSetIds;
+    /// (initial offset, offset, stride set, limit) -> offsets from initial
+    OrderedMap<OffsetsKey, std::vector<Size_t>> offsetsCache;
+    /// (object, offset, stride set) -> fields
+    OrderedMap<FieldsKey, PointsTo> fieldsCache;
+    u32_t numOfHits = 0;
+    u32_t numOfMisses = 0;
+
+    u32_t getStrideSetId(const NodeBS &strides);
+
+    /// Offsets, from initOffset, of the fields reached from offset
+    const std::vector<Size_t> &getOffsets(Size_t initOffset, Size_t offset,
+                                          u32_t strideSetId,
+                                          const NodeBS &strides,
+                                          Size_t maxLimit);
+};
+
 } // End namespace SVF
 
 #endif // PROJECT_CSC_H
@@ -38,6 +38,9 @@
 #include "MSSA/SVFGBuilder.h"
 #include "WPA/WPAFSSolver.h"
 
+#include <atomic>
+#include <mutex>
+
 namespace SVF {
 
 class AndersenWaveDiff;
@@ -70,6 +73,7 @@ class FlowSensitive : public WPASVFGFSSolver, public BVDataPTAImpl {
         solveTime = sccTime = processTime = propagationTime = updateTime = 0;
         addrTime = copyTime = gepTime = loadTime = storeTime = phiTime = 0;
         updateCallGraphTime = directPropaTime = indirectPropaTime = 0;
+        parallelTime = 0;
         numOfProcessedAddr = numOfProcessedCopy = numOfProcessedGep = 0;
         numOfProcessedLoad = numOfProcessedStore = 0;
         numOfProcessedPhi = numOfProcessedActualParam =
@@ -128,6 +132,23 @@ class FlowSensitive : public WPASVFGFSSolver, public BVDataPTAImpl {
     /// SCC detection
     NodeStack &SCCDetect() override;
 
+    /// Solve the worklist, in parallel if several threads are used
+    void solveWorklist() override;
+
+    /// Parallel solving (-fs-threads)
+    //@{
+    /// Whether this analysis can be solved by solveWorklistInParallel
+    virtual bool canSolveInParallel() const;
+    /// Solve the worklist in rounds of independent nodes
+    void solveWorklistInParallel();
+    /// Move the nodes of frontier which can be solved in the same round to
+    /// selected, and push the others back into the worklist
+    void selectIndependentNodes(const NodeVector &frontier,
+                                NodeVector &selected);
+    /// Process and propagate the nodes of a round
+    void solveIndependentNodes(const NodeVector &selected);
+    //@}
+
     /// Propagation
     //@{
     /// Propagate points-to information from an edge's src node to its dst node.
@@ -212,6 +233,7 @@ class FlowSensitive : public WPASVFGFSSolver, public BVDataPTAImpl {
     /// Handle various constraints
     //@{
     void processNode(NodeID nodeId) override;
+    void propagate(SVFGNode **v) override;
     bool processSVFGNode(SVFGNode *node);
     virtual bool processAddr(const AddrSVFGNode *addr);
     virtual bool processCopy(const CopySVFGNode *copy);
@@ -272,15 +294,17 @@ class FlowSensitive : public WPASVFGFSSolver, public BVDataPTAImpl {
 
     /// Statistics.
     //@{
-    Size_t numOfProcessedAddr;        /// Number of processed Addr node
-    Size_t numOfProcessedCopy;        /// Number of processed Copy node
-    Size_t numOfProcessedGep;         /// Number of processed Gep node
-    Size_t numOfProcessedPhi;         /// Number of processed Phi node
-    Size_t numOfProcessedLoad;        /// Number of processed Load node
-    Size_t numOfProcessedStore;       /// Number of processed Store node
-    Size_t numOfProcessedActualParam; /// Number of processed actual param node
-    Size_t numOfProcessedFormalRet;   /// Number of processed formal ret node
-    Size_t numOfProcessedMSSANode;    /// Number of processed mssa node
+    /// Number of processed nodes of each kind, counted atomically as nodes
+    /// may be processed in parallel
+    std::atomic<Size_t> numOfProcessedAddr;
+    std::atomic<Size_t> numOfProcessedCopy;
+    std::atomic<Size_t> numOfProcessedGep;
+    std::atomic<Size_t> numOfProcessedPhi;
+    std::atomic<Size_t> numOfProcessedLoad;
+    std::atomic<Size_t> numOfProcessedStore;
+    std::atomic<Size_t> numOfProcessedActualParam;
+    std::atomic<Size_t> numOfProcessedFormalRet;
+    std::atomic<Size_t> numOfProcessedMSSANode;
 
     Size_t maxSCCSize;
     Size_t numOfSCC;
@@ -302,10 +326,20 @@ class FlowSensitive : public WPASVFGFSSolver, public BVDataPTAImpl {
     double storeTime;           ///< time of store edges
     double phiTime;             ///< time of phi nodes.
     double updateCallGraphTime; ///< time of updating call graph
+    double parallelTime; ///< wall time of processing and propagating nodes
+                         ///< concurrently, which the times above leave out
 
     NodeBS svfgHasSU;
     //@}
 
+    /// Number of threads solving the worklist
+    unsigned numOfThreads = 1;
+    /// Set while nodes are processed or propagated concurrently, when the
+    /// per-node times above are not updated (see parallelTime)
+    bool inParallelPhase = false;
+    /// Guards svfgHasSU, which stores may update concurrently
+    std::mutex svfgHasSULock;
+
     void svfgStat();
 };
 
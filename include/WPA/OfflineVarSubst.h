@@ -0,0 +1,136 @@
+//===- OfflineVarSubst.h -- Offline variable substitution -------------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * OfflineVarSubst.h
+ *
+ * Offline variable substitution by hash-based value numbering with the
+ * union of labels of HU (Hardekopf and Lin, "Exploiting Pointer and
+ * Location Equivalence to Optimize Pointer Analysis", SAS 2007).
+ *
+ * Every node gets a label standing for a set of atoms which determines its
+ * points-to set: an atom for each object whose address it takes, for the
+ * targets of each label it loads from, for each field it computes from a
+ * label, and a fresh one for each node whose points-to set the graph does
+ * not determine (objects, and parameters and returns which indirect calls
+ * may connect). Nodes are visited in topological order, so a node's atoms
+ * are those of its predecessors; sets are hash-consed to labels. Nodes with
+ * the same label have the same points-to set, and those with label 0 have
+ * an empty one.
+ */
+
+#ifndef INCLUDE_WPA_OFFLINEVARSUBST_H_
+#define INCLUDE_WPA_OFFLINEVARSUBST_H_
+
+#include "Graphs/ConsG.h"
+
+namespace SVF {
+
+class SVFModule;
+
+class OfflineVarSubst {
+
+  public:
+    /// Constructor
+    OfflineVarSubst(ConstraintGraph *consCG, SVFModule *svfMod)
+        : consCG(consCG), svfMod(svfMod) {}
+
+    /// Label the nodes of the graph
+    void solve();
+
+    /// Label of a node of the graph
+    inline u32_t getLabel(NodeID id) const {
+        assert(id < labels.size() && "not a node of the solved graph");
+        return labels[id];
+    }
+
+    /// Nodes which are neither objects nor parameters of indirect calls
+    /// and whose points-to sets stay empty
+    inline const NodeBS &getEmptyNodes() const { return emptyNodes; }
+
+    /// Pairs of a node and the node with the lowest ID with the same
+    /// label, which it can be merged into
+    inline const std::vector<NodePair> &getMerges() const { return merges; }
+
+    /// Number of labels, including 0
+    inline u32_t getNumOfLabels() const { return labelSets.size(); }
+
+  private:
+    using AtomSet = std::vector<u32_t>; ///< sorted
+
+    ConstraintGraph *consCG;
+    SVFModule *svfMod;
+
+    std::vector<u32_t> labels;
+    /// Nodes whose points-to sets do not only depend on their predecessors
+    std::vector<bool> indirect;
+    /// Nodes which may be merged with others of the same label
+    std::vector<bool> mergeable;
+    NodeBS emptyNodes;
+    std::vector<NodePair> merges;
+
+    /// Atoms of each label, and label of each set of atoms
+    std::vector<AtomSet> labelSets;
+    OrderedMap<AtomSet, u32_t> setToLabel;
+    u32_t numOfAtoms = 0;
+
+    /// Atoms which stand for the address of an object, the targets of a
+    /// label's objects, and a field of an atom's objects
+    //@{
+    Map<NodeID, u32_t> addrAtoms;
+    Map<u32_t, u32_t> refAtoms;
+    OrderedMap<std::pair<u32_t, LocationSet>, u32_t> gepAtoms;
+    Map<u32_t, u32_t> variantGepAtoms;
+    //@}
+
+    /// Mark the nodes whose points-to sets the graph does not determine
+    void markIndirectNodes();
+
+    /// Strongly connected components of the copy, gep and load edges
+    /// (from pointer to loaded value), in topological order
+    void findSCCs(std::vector<NodeID> &members,
+                  std::vector<u32_t> &offsets) const;
+
+    /// Label the nodes of an SCC whose predecessors are labelled
+    void labelSCC(const NodeID *members, u32_t size, std::vector<u32_t> &sccOf,
+                  u32_t scc);
+
+    /// Label of a set of atoms, which may be unsorted
+    u32_t getLabelOfSet(AtomSet &atoms);
+
+    /// A new label which has a new atom only
+    u32_t newLabel();
+
+    /// Atom for a key, added with a new number if there is none
+    template <typename MapTy, typename KeyTy>
+    inline u32_t getAtom(MapTy &atoms, const KeyTy &key) {
+        auto res = atoms.insert(std::make_pair(key, numOfAtoms));
+        if (res.second) {
+            numOfAtoms++;
+        }
+        return res.first->second;
+    }
+};
+
+} // End namespace SVF
+
+#endif /* INCLUDE_WPA_OFFLINEVARSUBST_H_ */
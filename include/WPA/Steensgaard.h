@@ -19,12 +19,12 @@ using WPAConstraintSolver = WPASolver<ConstraintGraph *>;
 class Steensgaard : public AndersenBase {
 
   public:
-    using NodeToEquivClassMap = Map<NodeID, NodeID>;
-    using NodeToSubsMap = Map<NodeID, Set<NodeID>>;
-
     /// Constructor
     Steensgaard(SVFProject *proj) : AndersenBase(proj, Steensgaard_WPA, true) {}
 
+    /// Destructor
+    ~Steensgaard() override { delete solver; }
+
     /// Create an singleton instance
     static Steensgaard *createSteensgaard(SVFProject *proj) {
         if (steens == nullptr) {
@@ -42,9 +42,9 @@ class Steensgaard : public AndersenBase {
 
     void solveWorklist() override;
 
-    void processAllAddr();
-
-    void ecUnion(NodeID id, NodeID ec);
+    /// Add the callees of indirect calls to the call graph. The solver has
+    /// already connected their parameters.
+    bool updateCallGraph(const CallSiteToFunPtrMap &callsites) override;
 
     /// Methods for support type inquiry through isa, cast, and dyn_cast:
     //@{
@@ -55,44 +55,41 @@ class Steensgaard : public AndersenBase {
 
     /// Operation of points-to set
     inline const PointsTo &getPts(NodeID id) override {
-        return getPTDataTy()->getPts(getEC(id));
+        id = getEC(id);
+        loadPts(id);
+        return getPTDataTy()->getPts(id);
     }
     /// pts(id) = pts(id) U target
     inline bool unionPts(NodeID id, const PointsTo &target) override {
         id = getEC(id);
+        loadPts(id);
         return getPTDataTy()->unionPts(id, target);
     }
     /// pts(id) = pts(id) U pts(ptd)
     inline bool unionPts(NodeID id, NodeID ptd) override {
         id = getEC(id);
         ptd = getEC(ptd);
+        loadPts(id);
+        loadPts(ptd);
         return getPTDataTy()->unionPts(id, ptd);
     }
 
     /// API for equivalence class operations
     /// Every constraint node maps to an unique equivalence class EC
-    /// An equivalence class has a set of sub constraint nodes.
+    /// identified by one of its nodes, all of which have the same points-to
+    /// set.
     inline NodeID getEC(NodeID id) const {
-        auto it = nodeToECMap.find(id);
-        if (it == nodeToECMap.end())
-            return id;
-        else
-            return it->second;
+        return id < nodeToEC.size() ? nodeToEC[id] : id;
     }
-    void setEC(NodeID node, NodeID rep);
 
-    inline Set<NodeID> &getSubNodes(NodeID id) {
-        nodeToSubsMap[id].insert(id);
-        return nodeToSubsMap[id];
-    }
-    inline void addSubNode(NodeID node, NodeID sub) {
-        nodeToSubsMap[node].insert(sub);
-    }
+  protected:
+    /// Solving does not use the worklist
+    void initWorklist() override {}
 
   private:
     static Steensgaard *steens; // static instance
-    NodeToEquivClassMap nodeToECMap;
-    NodeToSubsMap nodeToSubsMap;
+    SteensgaardSolver *solver = nullptr;
+    std::vector<NodeID> nodeToEC;
 };
 
 } // namespace SVF
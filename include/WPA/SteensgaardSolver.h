@@ -0,0 +1,139 @@
+//===- SteensgaardSolver.h -- Unification-based constraint solver -----------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * SteensgaardSolver.h
+ *
+ * Steensgaard's analysis of a constraint graph in almost linear time. Nodes
+ * are partitioned into equivalence classes kept in a union-find forest, and
+ * all nodes of a class point to the nodes of at most one other class.
+ * Fields are not told apart and indirect calls are resolved until nothing
+ * changes, so the points-to set Andersen's analysis finds for a node on the
+ * same graph only has objects of the class the node's class points to.
+ */
+
+#ifndef INCLUDE_WPA_STEENSGAARDSOLVER_H_
+#define INCLUDE_WPA_STEENSGAARDSOLVER_H_
+
+#include "Graphs/ConsG.h"
+
+namespace SVF {
+
+class SVFModule;
+
+class SteensgaardSolver {
+
+  public:
+    /// Constructor
+    SteensgaardSolver(ConstraintGraph *consCG, SVFModule *svfMod)
+        : consCG(consCG), svfMod(svfMod) {}
+
+    /// Solve the constraints of the graph, once
+    void solve();
+
+    /// Equivalence class of node id
+    inline NodeID getEC(NodeID id) {
+        assert(id < parent.size() && "not a node of the solved graph");
+        // Path halving
+        while (parent[id] != id) {
+            parent[id] = parent[parent[id]];
+            id = parent[id];
+        }
+        return id;
+    }
+
+    /// Class the class of id points to, UINT_MAX if it points to nothing
+    inline NodeID getPointeeEC(NodeID id) {
+        NodeID ec = getEC(id);
+        return pointee[ec] == UINT_MAX ? UINT_MAX : getEC(pointee[ec]);
+    }
+
+    /// Whether id is a node of the solved graph (and not one added since)
+    inline bool isSolved(NodeID id) const { return id < numOfNodes; }
+
+    /// Whether the points-to set of id may not be empty
+    bool mayPointToObjs(NodeID id);
+
+    /// Whether the points-to sets of id1 and id2 may overlap or one of them
+    /// may have the black hole
+    bool mayAlias(NodeID id1, NodeID id2);
+
+    /// Objects of the solved graph
+    inline const NodeBS &getObjs() const { return objs; }
+
+    /// Number of equivalence classes of the nodes of the solved graph
+    u32_t getNumOfECs();
+
+  private:
+    ConstraintGraph *consCG;
+    SVFModule *svfMod;
+
+    /// Union-find forest; IDs from numOfNodes on are classes which were
+    /// created as the pointee of another class
+    std::vector<NodeID> parent;
+    std::vector<u32_t> rank;
+    /// Pointee class of the class of each root, UINT_MAX if none
+    std::vector<NodeID> pointee;
+    /// The class of each root has objects
+    std::vector<bool> hasObjs;
+    NodeID numOfNodes = 0;
+    NodeBS objs;
+
+    /// Function objects and their functions
+    std::vector<std::pair<NodeID, const SVFFunction *>> funObjs;
+    /// Callees connected to each indirect callsite
+    Map<const CallBlockNode *, Set<const SVFFunction *>> callees;
+
+    /// A new class without nodes
+    NodeID newEC();
+
+    /// Class the class of id points to, created if there is none
+    inline NodeID getOrAddPointeeEC(NodeID id) {
+        NodeID ec = getEC(id);
+        if (pointee[ec] == UINT_MAX) {
+            NodeID p = newEC();
+            pointee[ec] = p;
+            return p;
+        }
+        return getEC(pointee[ec]);
+    }
+
+    /// Unify the classes of id1 and id2, and then their pointees
+    void join(NodeID id1, NodeID id2);
+
+    /// dst = src
+    inline void assign(NodeID dst, NodeID src) {
+        join(getOrAddPointeeEC(dst), getOrAddPointeeEC(src));
+    }
+
+    /// Resolve indirect calls with the current classes, returning whether
+    /// a new callee was found
+    bool resolveIndCalls();
+
+    /// Pass the arguments and the return value of cs to and from callee
+    void connectCaller2Callee(const CallBlockNode *cs,
+                              const SVFFunction *callee);
+};
+
+} // End namespace SVF
+
+#endif /* INCLUDE_WPA_STEENSGAARDSOLVER_H_ */
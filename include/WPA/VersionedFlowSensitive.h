@@ -16,6 +16,10 @@
 #include "WPA/FlowSensitive.h"
 #include "WPA/WPAFSSolver.h"
 
+#include <llvm/ADT/ArrayRef.h>
+
+#include <algorithm>
+
 namespace SVF {
 
 class AndersenWaveDiff;
@@ -31,14 +35,56 @@ class VersionedFlowSensitive : public FlowSensitive {
     using MeldVersion = llvm::SparseBitVector<>;
 
   public:
-    using ObjToVersionMap = Map<NodeID, Version>;
-    using ObjToMeldVersionMap = Map<NodeID, MeldVersion>;
+    using ObjVersion = std::pair<NodeID, Version>;
+
+    /// Version of each object at each SVFG node, in one array sorted by node
+    /// and then by object.
+    class LocVersionTable {
+      public:
+        /// Build the table for nodes [0, numOfNodes). forEach(add) must call
+        /// add(l, o, v) for every version, with increasing o for the same l;
+        /// it is called twice.
+        template <typename ForEach>
+        void build(NodeID numOfNodes, const ForEach &forEach) {
+            offsets.assign(numOfNodes + 1, 0);
+            forEach([this](NodeID l, NodeID, Version) { offsets[l + 1]++; });
+            for (NodeID l = 0; l < numOfNodes; ++l) {
+                offsets[l + 1] += offsets[l];
+            }
+
+            entries.resize(offsets.back());
+            std::vector<u32_t> next(offsets.begin(), offsets.end() - 1);
+            forEach([this, &next](NodeID l, NodeID o, Version v) {
+                entries[next[l]++] = std::make_pair(o, v);
+            });
+        }
 
-    using LocVersionMap = Map<NodeID, ObjToVersionMap>;
-    /// Maps locations to all versions it sees (through objects).
-    using LocMeldVersionMap = Map<NodeID, ObjToMeldVersionMap>;
-    /// (o -> (v -> versions with rely on o:v).
-    using VersionRelianceMap = Map<NodeID, Map<Version, Set<Version>>>;
+        /// Version of o at l, nullptr if there is none
+        inline const Version *find(NodeID l, NodeID o) const {
+            llvm::ArrayRef<ObjVersion> ovs = at(l);
+            const auto *it = std::lower_bound(
+                ovs.begin(), ovs.end(), o,
+                [](const ObjVersion &ov, NodeID o) { return ov.first < o; });
+            return it != ovs.end() && it->first == o ? &it->second : nullptr;
+        }
+
+        /// Objects which have a version at l, and their versions
+        inline llvm::ArrayRef<ObjVersion> at(NodeID l) const {
+            if (l + 1 >= offsets.size()) {
+                return llvm::ArrayRef<ObjVersion>();
+            }
+            return llvm::makeArrayRef(entries.data() + offsets[l],
+                                      entries.data() + offsets[l + 1]);
+        }
+
+        inline NodeID getNumOfNodes() const {
+            return offsets.empty() ? 0 : offsets.size() - 1;
+        }
+
+      private:
+        std::vector<u32_t> offsets;
+        std::vector<ObjVersion> entries;
+    };
 
     enum VersionType {
         CONSUME,
@@ -104,24 +150,68 @@ class VersionedFlowSensitive : public FlowSensitive {
     }
 
   private:
-    /// Prelabel the SVFG: set y(o) for stores and c(o) for delta nodes to a new
-    /// version.
+    /// Meld labeling of one object, whose versions are independent of those
+    /// of other objects.
+    struct ObjMeldLabels {
+        NodeID obj;
+        /// Indirect edges l --obj--> l', sorted once labeling starts
+        std::vector<NodePair> edges;
+        /// Stores which may write obj according to Andersen's
+        std::vector<NodeID> stores;
+        /// Nodes with a version of obj, sorted, and their versions
+        //@{
+        std::vector<NodeID> nodes;
+        std::vector<MeldVersion> meldConsume;
+        std::vector<MeldVersion> meldYield;
+        std::vector<Version> consume;
+        std::vector<Version> yield;
+        //@}
+        Size_t numPrelabelVersions = 0;
+        Version numOfVersions = 0;
+    };
+
+    /// Versions of one object, which are numbered from 1.
+    struct ObjVersions {
+        NodeID obj;
+        /// Versions which rely on each version (sorted)
+        std::vector<std::vector<Version>> versionReliance;
+        /// Statement nodes which rely on each version
+        std::vector<NodeBS> stmtReliance;
+    };
+
+    /// Prelabel the SVFG: collect, for each object o, the stores which set
+    /// y(o) and the delta nodes which set c(o) to a new version.
     void prelabel();
-    /// Meld label the prelabeled SVFG.
+    /// Meld label the prelabeled SVFG, one object at a time.
     void meldLabel();
+    /// Meld label the SVFG for one object.
+    void meldLabelObj(ObjMeldLabels &labels) const;
     /// Melds v2 into v1 (in place), returns whether a change occurred.
-    bool meld(MeldVersion &mv1, MeldVersion &mv2);
+    static bool meld(MeldVersion &mv1, const MeldVersion &mv2);
 
     /// Moves meldConsume/Yield to consume/yield.
     void mapMeldVersions();
 
     /// Returns whether l is a delta node.
-    bool delta(NodeID l);
+    bool delta(NodeID l) const;
 
-    /// Returns a new MeldVersion for o during the prelabeling phase.
-    MeldVersion newMeldVersion(NodeID o);
     /// Whether l has a consume/yield version for o.
     bool hasVersion(NodeID l, NodeID o, enum VersionType v) const;
+    /// The consume/yield version of o at l, which must exist.
+    inline Version getVersion(NodeID l, NodeID o, enum VersionType v) const {
+        const Version *version =
+            (v == CONSUME ? consume : yield).find(l, o);
+        assert(version && "VFS::getVersion: no such version!");
+        return *version;
+    }
+
+    /// Versions of o, nullptr if it has none
+    inline ObjVersions *getObjVersions(NodeID o) {
+        if (o >= objToIdx.size() || objToIdx[o] == UINT_MAX) {
+            return nullptr;
+        }
+        return &objVersions[objToIdx[o]];
+    }
 
     /// Determine which versions rely on which versions (e.g. c_l'(o) relies on
     /// y_l(o) given l-o->l' and y_l(o) = a, c_l'(o) = b), and which statements
@@ -141,36 +231,28 @@ class VersionedFlowSensitive : public FlowSensitive {
     /// Dumps a MeldVersion to stdout.
     static void dumpMeldVersion(MeldVersion &v);
 
+    /// Per-object meld labeling, used until versions are mapped.
+    std::vector<ObjMeldLabels> objLabels;
+    /// Dense index of each object with versions, UINT_MAX for other nodes.
+    std::vector<u32_t> objToIdx;
+    /// SVFG node kinds, indexed by node ID.
+    //@{
+    std::vector<bool> deltaNodes;
+    std::vector<bool> storeNodes;
+    std::vector<bool> loadNodes;
+    //@}
+    /// Number of threads meld labeling runs on.
+    unsigned numOfLabelThreads = 1;
+
     /// SVFG node (label) x object -> version to consume.
-    /// Used during meld labeling. We use MeldVersions and Versions for
-    /// performance. MeldVersions are currently SparseBitVectors which are
-    /// necessary for the meld operator, but when meld labeling is complete, we
-    /// don't want to carry around SBVs and use them; integers are better.
-    LocMeldVersionMap meldConsume;
+    /// Created after meld labeling and used during the analysis.
+    LocVersionTable consume;
     /// SVFG node (label) x object -> version to yield.
-    /// Used during meld labeling.
-    /// For non-stores, yield == consume, so meldYield only has entries for
-    /// stores.
-    LocMeldVersionMap meldYield;
-    /// Object -> MeldVersion counter. Used in the prelabeling phase to generate
-    /// a new MeldVersion.
-    Map<NodeID, unsigned> meldVersions;
-
-    /// Like meldConsume but with Versions, not MeldVersions.
-    /// Created after meld labeling from meldConsume and used during the
-    /// analysis.
-    LocVersionMap consume;
-    /// Actual yield map. Yield analogue to consume.
-    LocVersionMap yield;
-
-    /// o -> (version -> versions which rely on it).
-    VersionRelianceMap versionReliance;
-    /// o x version -> statement nodes which rely on that o/version.
-    Map<NodeID, Map<Version, NodeBS>> stmtReliance;
-
-    /// Worklist for performing meld labeling, takes SVFG node l.
-    /// Nodes are added when the version they yield is changed.
-    FIFOWorkList<NodeID> vWorklist;
+    /// For non-stores, yield == consume.
+    LocVersionTable yield;
+
+    /// Reliances on the versions of each object, by dense object index.
+    std::vector<ObjVersions> objVersions;
 
     /// Points-to DS for working with versions.
     BVDataPTAImpl::VersionedPTDataTy *vPtD;
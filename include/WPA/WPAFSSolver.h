@@ -60,6 +60,7 @@ class WPAFSSolver : public WPASolver<GraphType> {
     NodeStack &SCCDetect() override {
         /// SCC detection
         this->getSCCDetector()->find();
+        this->rankNodesTopologically();
 
         /// Both rep and sub nodes need to be processed later.
         /// Collect sub nodes from SCCDetector.
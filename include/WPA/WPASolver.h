@@ -50,7 +50,7 @@ class WPASolver {
 
     using SCC = SCCDetection<GraphType>;
 
-    using WorkList = FIFOWorkList<NodeID>;
+    using WorkList = NodeWorkList;
 
   protected:
     /// Constructor
@@ -80,6 +80,7 @@ class WPASolver {
     /// SCC detection
     virtual inline NodeStack &SCCDetect() {
         getSCCDetector()->find();
+        rankNodesTopologically();
         return getSCCDetector()->topoNodeStack();
     }
     virtual inline NodeStack &SCCDetect(NodeSet &candidates) {
@@ -145,6 +146,22 @@ class WPASolver {
     inline bool isInWorklist(NodeID id) { return worklist.find(id); }
     //@}
 
+    /// Give the nodes of each SCC the SCC's topological rank, for worklists
+    /// ordered by it
+    inline void rankNodesTopologically() {
+        if (!worklist.needsRanks() || !getSCCDetector()->hasTopoOrder()) {
+            return;
+        }
+
+        u32_t rank = 0;
+        for (NodeID rep : getSCCDetector()->topoOrder()) {
+            for (NodeID sub : getSCCDetector()->subNodes(rep)) {
+                worklist.setRank(sub, rank);
+            }
+            rank++;
+        }
+    }
+
     /// Reanalyze if any constraint value changed
     bool reanalyze{};
     /// print out statistics for i-th iteration
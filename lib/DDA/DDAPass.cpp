@@ -8,6 +8,7 @@
 #include "DDA/ContextDDA.h"
 #include "DDA/DDAClient.h"
 #include "DDA/FlowDDA.h"
+#include "MemoryModel/PTAStat.h"
 #include "MemoryModel/PointerAnalysisImpl.h"
 #include "SVF-FE/PAGBuilder.h"
 #include "Util/Options.h"
@@ -106,10 +107,17 @@ void DDAPass::runPointerAnalysis(SVFProject *proj, u32_t kind) {
     if (Options::WPANum) {
         _client->collectWPANum(proj->getSVFModule());
     } else {
+        PhaseTimer timer("DDA");
         /// initialize
-        _pta->initialize();
+        {
+            PhaseTimer initTimer("Initialize");
+            _pta->initialize();
+        }
         /// compute points-to
-        _client->answerQueries(_pta);
+        {
+            PhaseTimer queryTimer("Queries");
+            _client->answerQueries(_pta);
+        }
         /// finalize
         _pta->finalize();
         if (Options::PrintCPts) {
@@ -302,6 +310,89 @@ AliasResult DDAPass::alias(const Value *V1, const Value *V2) {
     return llvm::MayAlias;
 }
 
+/*!
+ * Batch alias queries on Values. Values without PAG nodes may alias anything,
+ * as for a single query.
+ */
+void DDAPass::alias(const std::vector<ValuePair> &queries,
+                    std::vector<AliasResult> &results) {
+    PAG *pag = _pta->getPAG();
+
+    std::vector<NodePair> nodeQueries;
+    std::vector<u32_t> queryIdx(queries.size(), UINT_MAX);
+    for (u32_t i = 0; i < queries.size(); ++i) {
+        const Value *V1 = queries[i].first;
+        const Value *V2 = queries[i].second;
+        if (pag->hasValueNode(V1) && pag->hasValueNode(V2)) {
+            queryIdx[i] = nodeQueries.size();
+            nodeQueries.push_back(
+                std::make_pair(pag->getValueNode(V1), pag->getValueNode(V2)));
+        }
+    }
+
+    std::vector<AliasResult> nodeResults;
+    alias(nodeQueries, nodeResults);
+
+    results.clear();
+    results.reserve(queries.size());
+    for (u32_t idx : queryIdx) {
+        if (idx == UINT_MAX) {
+            results.push_back(llvm::MayAlias);
+        } else {
+            results.push_back(nodeResults[idx]);
+        }
+    }
+}
+
+/*!
+ * Batch alias queries on PAG nodes
+ */
+void DDAPass::alias(const std::vector<NodePair> &queries,
+                    std::vector<AliasResult> &results) {
+    std::vector<NodeID> ptrs;
+    ptrs.reserve(queries.size() * 2);
+    for (const NodePair &query : queries) {
+        ptrs.push_back(query.first);
+        ptrs.push_back(query.second);
+    }
+    computeDDAPts(ptrs);
+
+    /// alias is symmetric, so a pair is keyed by its smaller node first
+    Map<NodePair, AliasResult> pairToResult;
+    results.clear();
+    results.reserve(queries.size());
+    for (const NodePair &query : queries) {
+        NodePair key = query.first <= query.second
+                           ? query
+                           : std::make_pair(query.second, query.first);
+        auto it = pairToResult.find(key);
+        if (it == pairToResult.end()) {
+            AliasResult result = _pta->alias(key.first, key.second);
+            it = pairToResult.insert(std::make_pair(key, result)).first;
+        }
+        results.push_back(it->second);
+    }
+}
+
+/*!
+ * Compute the points-to set of every distinct valid top-level pointer of ptrs.
+ * Queries are solved one after another: solving one may add field objects
+ * to the PAG and resolved call edges to the SVFG, which later queries see.
+ */
+void DDAPass::computeDDAPts(const std::vector<NodeID> &ptrs) {
+    PAG *pag = _pta->getPAG();
+
+    NodeBS computed;
+    for (NodeID ptr : ptrs) {
+        if (!computed.test_and_set(ptr)) {
+            continue;
+        }
+        if (pag->isValidTopLevelPtr(pag->getGNode(ptr))) {
+            _pta->computeDDAPts(ptr);
+        }
+    }
+}
+
 /*!
  * Print queries' pts
  */
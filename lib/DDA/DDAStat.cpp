@@ -57,6 +57,10 @@ void DDAStat::initDefault() {
     _AnaTimeCyclePerQuery = 0;
     _TotalTimeOfQueries = 0;
 
+    _NumOfCacheHits = 0;
+    _NumOfCacheEvictions = 0;
+    _NumOfCacheInvalidations = 0;
+
     _vmrssUsageBefore = _vmrssUsageAfter = 0;
     _vmsizeUsageBefore = _vmsizeUsageAfter = 0;
 }
@@ -235,6 +239,9 @@ void DDAStat::performStat() {
     PTNumStatMap["PointsToBlkPtr"] = _NumOfBlackholePtr;
     PTNumStatMap["NumOfMustAA"] = _TotalNumOfMustAliases;
     PTNumStatMap["NumOfInfePath"] = _TotalNumOfInfeasiblePath;
+    PTNumStatMap["DPMCacheHits"] = _NumOfCacheHits;
+    PTNumStatMap["DPMCacheEvicts"] = _NumOfCacheEvictions;
+    PTNumStatMap["DPMCacheInvalids"] = _NumOfCacheInvalidations;
     PTNumStatMap["NumOfStore"] = pag->getPTAEdgeSet(PAGEdge::Store).size();
     PTNumStatMap["MemoryUsageVmrss"] = _vmrssUsageAfter - _vmrssUsageBefore;
     PTNumStatMap["MemoryUsageVmsize"] = _vmsizeUsageAfter - _vmsizeUsageBefore;
@@ -72,6 +72,8 @@ void ConstraintGraph::buildCG() {
     for (auto &it : *pag) {
         addGNode(new ConstraintNode(it.first, pag));
     }
+    // PAG node IDs are dense, look nodes up by ID in an array
+    buildNodeIndex();
 
     // initialize edges
     PAGEdge::PAGEdgeSetTy &addrs = getPAGEdgeSet(PAGEdge::Addr);
@@ -189,6 +191,8 @@ CopyCGEdge *ConstraintGraph::addCopyCGEdge(NodeID src, NodeID dst) {
     srcNode->addOutgoingCopyEdge(edge);
     dstNode->addIncomingCopyEdge(edge);
 
+    newDirectEdgeSrcs.set(src);
+
     // add the edge to GenericGraph
     addGEdge(edge);
 
@@ -214,6 +218,8 @@ NormalGepCGEdge *ConstraintGraph::addNormalGepCGEdge(NodeID src, NodeID dst,
     srcNode->addOutgoingGepEdge(edge);
     dstNode->addIncomingGepEdge(edge);
 
+    newDirectEdgeSrcs.set(src);
+
     // add the edge to GenericGraph
     addGEdge(edge);
 
@@ -238,6 +244,8 @@ VariantGepCGEdge *ConstraintGraph::addVariantGepCGEdge(NodeID src, NodeID dst) {
     srcNode->addOutgoingGepEdge(edge);
     dstNode->addIncomingGepEdge(edge);
 
+    newDirectEdgeSrcs.set(src);
+
     // add the edge to GenericGraph
     addGEdge(edge);
 
@@ -536,13 +544,14 @@ void ConstraintGraph::print() {
 
     outs() << "-----------------ConstraintGraph-----------------------\n";
 
-    ConstraintEdge::ConstraintEdgeSetTy &addrs = this->getAddrCGEdges();
+    ConstraintEdge::ConstraintEdgeOrderedSetTy &addrs = this->getAddrCGEdges();
     for (auto *addr : addrs) {
         outs() << addr->getSrcID() << " -- Addr --> " << addr->getDstID()
                << "\n";
     }
 
-    ConstraintEdge::ConstraintEdgeSetTy &directs = this->getDirectCGEdges();
+    ConstraintEdge::ConstraintEdgeOrderedSetTy &directs =
+        this->getDirectCGEdges();
     for (auto *direct : directs) {
         if (auto *copy = llvm::dyn_cast<CopyCGEdge>(direct)) {
             outs() << copy->getSrcID() << " -- Copy --> " << copy->getDstID()
@@ -558,13 +567,14 @@ void ConstraintGraph::print() {
         }
     }
 
-    ConstraintEdge::ConstraintEdgeSetTy &loads = this->getLoadCGEdges();
+    ConstraintEdge::ConstraintEdgeOrderedSetTy &loads = this->getLoadCGEdges();
     for (auto *load : loads) {
         outs() << load->getSrcID() << " -- Load --> " << load->getDstID()
                << "\n";
     }
 
-    ConstraintEdge::ConstraintEdgeSetTy &stores = this->getStoreCGEdges();
+    ConstraintEdge::ConstraintEdgeOrderedSetTy &stores =
+        this->getStoreCGEdges();
     for (auto *store : stores) {
         outs() << store->getSrcID() << " -- Store --> " << store->getDstID()
                << "\n";
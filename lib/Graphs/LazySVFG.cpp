@@ -0,0 +1,358 @@
+//===- LazySVFG.cpp -- SVFG built on demand ----------------------------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013-2017>  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * LazySVFG.cpp
+ */
+
+#include "Graphs/LazySVFG.h"
+#include "SVF-FE/LLVMUtil.h"
+#include "Util/SVFModule.h"
+
+using namespace SVF;
+using namespace SVFUtil;
+
+/*!
+ * Bucket loads, stores and the memory SSA of each function. Nodes and edges
+ * of address-taken variables are left to buildIndirectVFOn.
+ */
+void LazySVFG::buildSVFG() {
+    DBOUT(DGENERAL, outs() << pasMsg("Build Sparse Value-Flow Graph lazily\n"));
+
+    mainFun = getProgEntryFunction(pta->getSVFModule());
+
+    for (auto it = begin(), eit = end(); it != eit; ++it) {
+        const SVFGNode *node = it->second;
+        if (llvm::isa<LoadSVFGNode>(node) || llvm::isa<StoreSVFGNode>(node)) {
+            funToStmtNodes[getFunOf(node)].push_back(it->first);
+        }
+    }
+
+    LLVMModuleSet *modSet = pag->getModule()->getLLVMModSet();
+    for (auto &it : mssa->getBBToPhiSetMap()) {
+        const SVFFunction *fun = modSet->getSVFFunction(it.first->getParent());
+        funToPhiBBs[fun].push_back(it.first);
+    }
+
+    Set<const CallBlockNode *> callSites;
+    for (auto &it : mssa->getCallSiteToMuSetMap()) {
+        callSites.insert(it.first);
+    }
+    for (auto &it : mssa->getCallSiteToChiSetMap()) {
+        callSites.insert(it.first);
+    }
+    for (const CallBlockNode *cs : callSites) {
+        funToCallSites[cs->getCaller()].push_back(cs);
+    }
+}
+
+/*!
+ * Create the memory SSA nodes of a function, in the order of
+ * SVFG::addSVFGNodesForAddrTakenVars
+ */
+void LazySVFG::addFunNodes(const SVFFunction *fun) {
+    if (!builtFuns.insert(fun).second) {
+        return;
+    }
+
+    std::vector<NodeID> &mrNodes = funToMRNodes[fun];
+
+    for (NodeID id : funToStmtNodes[fun]) {
+        const SVFGNode *node = getGNode(id);
+        if (const auto *store = llvm::dyn_cast<StoreSVFGNode>(node)) {
+            const auto *storePE = llvm::cast<StorePE>(store->getPAGEdge());
+            for (auto *chi : mssa->getCHISet(storePE)) {
+                setDef(chi->getResVer(), store);
+            }
+        }
+    }
+
+    for (const BasicBlock *bb : funToPhiBBs[fun]) {
+        for (auto *phi : mssa->getBBToPhiSetMap()[bb]) {
+            addIntraMSSAPHISVFGNode(phi);
+            mrNodes.push_back(getDef(phi->getResVer()));
+        }
+    }
+
+    auto entryIt = mssa->getFunToEntryChiSetMap().find(fun);
+    if (entryIt != mssa->getFunToEntryChiSetMap().end()) {
+        for (auto *chi : entryIt->second) {
+            addFormalINSVFGNode(llvm::cast<ENTRYCHI>(chi));
+        }
+        for (NodeID id : getFormalINSVFGNodes(fun)) {
+            mrNodes.push_back(id);
+        }
+    }
+
+    auto retIt = mssa->getFunToRetMuSetMap().find(fun);
+    if (retIt != mssa->getFunToRetMuSetMap().end()) {
+        for (auto *mu : retIt->second) {
+            addFormalOUTSVFGNode(llvm::cast<RETMU>(mu));
+        }
+        for (NodeID id : getFormalOUTSVFGNodes(fun)) {
+            mrNodes.push_back(id);
+        }
+    }
+
+    for (const CallBlockNode *cs : funToCallSites[fun]) {
+        if (mssa->hasMU(cs)) {
+            for (auto *mu : mssa->getMUSet(cs)) {
+                addActualINSVFGNode(llvm::cast<CALLMU>(mu));
+            }
+            for (NodeID id : getActualINSVFGNodes(cs)) {
+                mrNodes.push_back(id);
+            }
+        }
+        if (mssa->hasCHI(cs)) {
+            for (auto *chi : mssa->getCHISet(cs)) {
+                addActualOUTSVFGNode(llvm::cast<CALLCHI>(chi));
+            }
+            for (NodeID id : getActualOUTSVFGNodes(cs)) {
+                mrNodes.push_back(id);
+            }
+        }
+    }
+}
+
+/*!
+ * Build the indirect edges of a function unless already built, and move the
+ * function to the front of the LRU list
+ */
+void LazySVFG::connectFun(const SVFFunction *fun) {
+    if (fun == nullptr) {
+        return;
+    }
+
+    auto it = lruPos.find(fun);
+    if (it != lruPos.end()) {
+        lru.splice(lru.begin(), lru, it->second);
+        return;
+    }
+
+    addFunNodes(fun);
+    connectFunEdges(fun);
+    lru.push_front(fun);
+    lruPos[fun] = lru.begin();
+}
+
+/*!
+ * Connect the indirect edges of a function as SVFG::connectIndirectSVFGEdges
+ * does for its nodes. Edges between a call site and a callee are added from
+ * both sides, so they exist as soon as either function is connected.
+ */
+void LazySVFG::connectFunEdges(const SVFFunction *fun) {
+    PTACallGraphEdge::CallInstSet callers;
+    callgraph->getDirCallSitesInvokingCallee(fun, callers);
+    for (const CallBlockNode *cs : callers) {
+        addFunNodes(cs->getCaller());
+    }
+    Map<const CallBlockNode *, std::vector<const SVFFunction *>> csToCallees;
+    for (const CallBlockNode *cs : funToCallSites[fun]) {
+        std::vector<const SVFFunction *> &callees = csToCallees[cs];
+        getDirCallees(cs, callees);
+        for (const SVFFunction *callee : callees) {
+            addFunNodes(callee);
+        }
+    }
+
+    for (NodeID id : funToStmtNodes[fun]) {
+        const SVFGNode *node = getGNode(id);
+        if (const auto *load = llvm::dyn_cast<LoadSVFGNode>(node)) {
+            const auto *loadPE = llvm::cast<LoadPE>(load->getPAGEdge());
+            for (auto *it : mssa->getMUSet(loadPE)) {
+                if (auto *mu = llvm::dyn_cast<LOADMU>(it)) {
+                    auto ver = mu->getVer();
+                    addIntraIndirectVFEdge(getDef(ver), id,
+                                           ver->getMR()->getPointsTo());
+                }
+            }
+        } else if (const auto *store = llvm::dyn_cast<StoreSVFGNode>(node)) {
+            const auto *storePE = llvm::cast<StorePE>(store->getPAGEdge());
+            for (auto *it : mssa->getCHISet(storePE)) {
+                if (auto *chi = llvm::dyn_cast<STORECHI>(it)) {
+                    auto ver = chi->getOpVer();
+                    addIntraIndirectVFEdge(getDef(ver), id,
+                                           ver->getMR()->getPointsTo());
+                }
+            }
+        }
+    }
+
+    for (NodeID id : funToMRNodes[fun]) {
+        const SVFGNode *node = getGNode(id);
+        if (const auto *formalIn = llvm::dyn_cast<FormalINSVFGNode>(node)) {
+            for (const CallBlockNode *cs : callers) {
+                if (!mssa->hasMU(cs)) {
+                    continue;
+                }
+                CallSiteID csId = getCallSiteID(cs, fun);
+                for (NodeID ai : getActualINSVFGNodes(cs)) {
+                    addInterIndirectVFCallEdge(
+                        llvm::cast<ActualINSVFGNode>(getGNode(ai)), formalIn,
+                        csId);
+                }
+            }
+        } else if (const auto *formalOut =
+                       llvm::dyn_cast<FormalOUTSVFGNode>(node)) {
+            for (const CallBlockNode *cs : callers) {
+                if (!mssa->hasCHI(cs)) {
+                    continue;
+                }
+                CallSiteID csId = getCallSiteID(cs, fun);
+                for (NodeID ao : getActualOUTSVFGNodes(cs)) {
+                    addInterIndirectVFRetEdge(
+                        formalOut, llvm::cast<ActualOUTSVFGNode>(getGNode(ao)),
+                        csId);
+                }
+            }
+            auto ver = formalOut->getRetMU()->getVer();
+            addIntraIndirectVFEdge(getDef(ver), id,
+                                   ver->getMR()->getPointsTo());
+        } else if (const auto *actualIn =
+                       llvm::dyn_cast<ActualINSVFGNode>(node)) {
+            const CallBlockNode *cs = actualIn->getCallSite();
+            for (const SVFFunction *callee : csToCallees[cs]) {
+                if (!hasFuncEntryChi(callee)) {
+                    continue;
+                }
+                CallSiteID csId = getCallSiteID(cs, callee);
+                for (NodeID fi : getFormalINSVFGNodes(callee)) {
+                    addInterIndirectVFCallEdge(
+                        actualIn, llvm::cast<FormalINSVFGNode>(getGNode(fi)),
+                        csId);
+                }
+            }
+            auto ver = actualIn->getCallMU()->getVer();
+            addIntraIndirectVFEdge(getDef(ver), id,
+                                   ver->getMR()->getPointsTo());
+        } else if (const auto *actualOut =
+                       llvm::dyn_cast<ActualOUTSVFGNode>(node)) {
+            const CallBlockNode *cs = actualOut->getCallSite();
+            for (const SVFFunction *callee : csToCallees[cs]) {
+                if (!hasFuncRetMu(callee)) {
+                    continue;
+                }
+                CallSiteID csId = getCallSiteID(cs, callee);
+                for (NodeID fo : getFormalOUTSVFGNodes(callee)) {
+                    addInterIndirectVFRetEdge(
+                        llvm::cast<FormalOUTSVFGNode>(getGNode(fo)),
+                        actualOut, csId);
+                }
+            }
+        } else if (const auto *phiNode =
+                       llvm::dyn_cast<MSSAPHISVFGNode>(node)) {
+            for (auto it = phiNode->opVerBegin(), eit = phiNode->opVerEnd();
+                 it != eit; it++) {
+                auto op = it->second;
+                addIntraIndirectVFEdge(getDef(op), id,
+                                       op->getMR()->getPointsTo());
+            }
+        }
+    }
+
+    if (fun == mainFun) {
+        connectFromGlobalToProgEntry();
+    }
+}
+
+/*!
+ * Remove the intra-procedural indirect edges into the nodes of a function,
+ * which are all the ones within it
+ */
+void LazySVFG::disconnectFun(const SVFFunction *fun) {
+    std::vector<SVFGEdge *> edges;
+    auto collectInEdges = [&](NodeID id) {
+        for (SVFGEdge *edge : getGNode(id)->getInEdges()) {
+            if (llvm::isa<IntraIndSVFGEdge>(edge)) {
+                edges.push_back(edge);
+            }
+        }
+    };
+    for (NodeID id : funToStmtNodes[fun]) {
+        collectInEdges(id);
+    }
+    for (NodeID id : funToMRNodes[fun]) {
+        collectInEdges(id);
+    }
+
+    for (SVFGEdge *edge : edges) {
+        removeGEdgeAndDelete(edge);
+    }
+}
+
+/*!
+ * Direct callees of a call site in the call graph
+ */
+void LazySVFG::getDirCallees(const CallBlockNode *cs,
+                             std::vector<const SVFFunction *> &callees) const {
+    if (!callgraph->hasCallGraphEdge(cs)) {
+        return;
+    }
+    for (auto it = callgraph->getCallEdgeBegin(cs),
+              eit = callgraph->getCallEdgeEnd(cs);
+         it != eit; ++it) {
+        const PTACallGraphEdge *edge = *it;
+        if (edge->getDirectCalls().count(cs) != 0) {
+            callees.push_back(edge->getDstNode()->getFunction());
+        }
+    }
+}
+
+/*!
+ * Connect all functions, e.g. for clients scanning the whole graph
+ */
+void LazySVFG::buildAllIndirectVF() {
+    pinned = true;
+    for (const SVFFunction *fun : *pta->getSVFModule()) {
+        if (!isExtCall(fun)) {
+            connectFun(fun);
+        }
+    }
+    connectFun(mainFun);
+}
+
+/*!
+ * Drop the least recently used functions beyond the capacity
+ */
+void LazySVFG::finishQuery() {
+    if (pinned || capacity == 0) {
+        return;
+    }
+
+    while (lru.size() > capacity) {
+        const SVFFunction *fun = lru.back();
+        lru.pop_back();
+        lruPos.erase(fun);
+        disconnectFun(fun);
+    }
+}
+
+/*!
+ * Build both sides of an indirect call before connecting them
+ */
+void LazySVFG::connectCallerAndCallee(const CallBlockNode *cs,
+                                      const SVFFunction *callee,
+                                      SVFGEdgeSetTy &edges) {
+    connectFun(cs->getCaller());
+    connectFun(callee);
+    SVFG::connectCallerAndCallee(cs, callee, edges);
+}
@@ -42,7 +42,7 @@ void OfflineConsG::buildOfflineCG() {
     StoreEdges stores;
 
     // Add a copy edge between the ref node of src node and dst node
-    for (ConstraintEdge::ConstraintEdgeSetTy::iterator
+    for (ConstraintEdge::ConstraintEdgeOrderedSetTy::iterator
              it = LoadCGEdgeSet.begin(),
              eit = LoadCGEdgeSet.end();
          it != eit; ++it) {
@@ -53,7 +53,7 @@ void OfflineConsG::buildOfflineCG() {
         addRefLoadEdge(src, dst);
     }
     // Add a copy edge between src node and the ref node of dst node
-    for (ConstraintEdge::ConstraintEdgeSetTy::iterator
+    for (ConstraintEdge::ConstraintEdgeOrderedSetTy::iterator
              it = StoreCGEdgeSet.begin(),
              eit = StoreCGEdgeSet.end();
          it != eit; ++it) {
@@ -33,6 +33,7 @@
 
 #include "Graphs/PAG.h"
 #include "Graphs/ExternalPAG.h"
+#include "MemoryModel/PTAStat.h"
 #include "SVF-FE/ICFGBuilder.h"
 #include "SVF-FE/LLVMUtil.h"
 #include "SVF-FE/PAGBuilder.h"
@@ -441,6 +442,7 @@ PAG::PAG(SVFProject *proj, bool buildFromFile)
     // here we should pass this pointer to the builder,
     // otherwise indirect infinite recursive call will
     // be triggered
+    PhaseTimer timer("PAG");
     PAGBuilder _builder(this, proj);
     _builder.build();
 }
@@ -209,6 +209,27 @@ SVFG::SVFG(MemSSA *_mssa, PAG *pag, VFGK k)
     stat = new SVFGStat(this);
 }
 
+/*!
+ * Restore the fields which are not serialized
+ */
+void SVFG::attachLoadedSVFG(PointerAnalysis *_pta) {
+    pta = _pta;
+    pag = pta->getPAG();
+    callgraph = pta->getPTACallGraph();
+    ICFG *icfg = pag->getICFG();
+    funToVFGNodesMap.clear();
+    for (auto &it : *this) {
+        SVFGNode *node = it.second;
+        ICFGNode *icfgNode = icfg->getGNode(node->getICFGNode()->getId());
+        icfgNode->addVFGNode(node);
+        if (const SVFFunction *fun = icfgNode->getFun()) {
+            funToVFGNodesMap[fun].insert(node);
+        }
+    }
+    delete stat;
+    stat = new SVFGStat(this);
+}
+
 /*!
  * Memory has been cleaned up at GenericGraph
  */
@@ -35,6 +35,7 @@
 #include "Graphs/SVFGOPT.h"
 #include "Graphs/SVFGStat.h"
 #include "Util/Options.h"
+#include "Util/Parallel.h"
 
 using namespace SVF;
 using namespace SVFUtil;
@@ -90,7 +91,7 @@ SVFGEdge *SVFGOPT::addRetIndirectSVFGEdge(NodeID srcId, NodeID dstId,
  *
  */
 void SVFGOPT::handleInterValueFlow() {
-    SVFGNodeSet candidates;
+    SVFGNodeVector candidates;
     for (auto it : *this) {
         SVFGNode *node = it.second;
         if (llvm::isa<ActualParmSVFGNode>(node) ||
@@ -101,45 +102,38 @@ void SVFGOPT::handleInterValueFlow() {
             llvm::isa<ActualOUTSVFGNode>(node) ||
             llvm::isa<FormalINSVFGNode>(node) ||
             llvm::isa<FormalOUTSVFGNode>(node)) {
-            candidates.insert(node);
+            candidates.push_back(node);
         }
     }
 
-    SVFGNodeSet nodesToBeDeleted;
+    SVFGNodeVector aInFOuts;
+    SVFGNodeVector nodesToBeDeleted;
     for (auto *node : candidates) {
         if (auto *fp = llvm::dyn_cast<FormalParmSVFGNode>(node)) {
             replaceFParamARetWithPHI(addInterPHIForFP(fp), fp);
-            nodesToBeDeleted.insert(fp);
+            nodesToBeDeleted.push_back(fp);
         } else if (auto *ar = llvm::dyn_cast<ActualRetSVFGNode>(node)) {
             replaceFParamARetWithPHI(addInterPHIForAR(ar), ar);
-            nodesToBeDeleted.insert(ar);
+            nodesToBeDeleted.push_back(ar);
         } else if (llvm::isa<ActualParmSVFGNode>(node) ||
                    llvm::isa<FormalRetSVFGNode>(node)) {
-            nodesToBeDeleted.insert(node);
+            nodesToBeDeleted.push_back(node);
         } else if (llvm::isa<ActualINSVFGNode>(node) ||
                    llvm::isa<FormalOUTSVFGNode>(node)) {
-            retargetEdgesOfAInFOut(node);
-            nodesToBeDeleted.insert(node);
+            /// only indirect edges are retargeted, which the above replacing
+            /// of direct edges does not touch
+            aInFOuts.push_back(node);
+            nodesToBeDeleted.push_back(node);
         } else if (llvm::isa<ActualOUTSVFGNode>(node) ||
                    llvm::isa<FormalINSVFGNode>(node)) {
             if (keepActualOutFormalIn == false) {
-                nodesToBeDeleted.insert(node);
+                nodesToBeDeleted.push_back(node);
             }
         }
     }
 
-    for (auto *node : nodesToBeDeleted) {
-        if (canBeRemoved(node)) {
-            if (llvm::isa<ActualOUTSVFGNode>(node) ||
-                llvm::isa<FormalINSVFGNode>(node)) {
-                retargetEdgesOfAOutFIn(
-                    node); /// reset def of address-taken variable
-            }
-
-            removeAllEdges(node);
-            removeGNodeAndDelete(node);
-        }
-    }
+    retargetEdgesOfAInFOut(aInFOuts);
+    removeInterNodes(nodesToBeDeleted);
 }
 
 /*!
@@ -196,32 +190,99 @@ void SVFGOPT::replaceFParamARetWithPHI(PHISVFGNode *phi, SVFGNode *svfgNode) {
 /*!
  * Record def sites of actual-in/formal-out and connect from those def-sites
  * to formal-in/actual-out directly if they exist.
+ * An actual-in/formal-out is never the def-site or the successor of another
+ * one, so the edges of all of them can be collected before any is changed.
  */
-void SVFGOPT::retargetEdgesOfAInFOut(SVFGNode *node) {
-    assert(
-        node->getInEdges().size() == 1 &&
-        "actual-in/formal-out can only have one incoming edge as its def size");
+void SVFGOPT::retargetEdgesOfAInFOut(const SVFGNodeVector &nodes) {
+    std::vector<NodeID> defs(nodes.size());
+    std::vector<BypassEdges> edges(nodes.size());
+    parallelFor(nodes.size(), Options::SVFGOPTThreads, [&](size_t i) {
+        defs[i] = collectEdgesOfAInFOut(nodes[i], edges[i]);
+    });
+
+    actualInToDefMap.reserve(actualInToDefMap.size() + nodes.size());
+    formalOutToDefMap.reserve(formalOutToDefMap.size() + nodes.size());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (llvm::isa<ActualINSVFGNode>(nodes[i])) {
+            setActualINDef(nodes[i]->getId(), defs[i]);
+        } else {
+            setFormalOUTDef(nodes[i]->getId(), defs[i]);
+        }
+        addBypassEdges(edges[i]);
+        removeAllEdges(nodes[i]);
+    }
+}
 
-    SVFGNode *def = nullptr;
-    PointsTo inPointsTo;
+/*!
+ * Nodes which are not adjacent to other candidates do not change each
+ * other's edges, so the bypassing edges of all of them are collected first,
+ * on several threads. The few remaining ones are then handled one by one.
+ * On a single thread all nodes are handled one by one, which is the
+ * reference the parallel result is tested against.
+ */
+void SVFGOPT::removeInterNodes(const SVFGNodeVector &nodes) {
+    SVFGNodeVector independent;
+    SVFGNodeVector dependent;
+    if (getNumOfWorkerThreads(Options::SVFGOPTThreads) == 1) {
+        dependent = nodes;
+    } else {
+        NodeBS candidates;
+        for (const SVFGNode *node : nodes) {
+            candidates.set(node->getId());
+        }
+        for (SVFGNode *node : nodes) {
+            if (isAdjacentTo(node, candidates)) {
+                dependent.push_back(node);
+            } else {
+                independent.push_back(node);
+            }
+        }
+    }
 
-    auto it = node->InEdgeBegin();
-    auto eit = node->InEdgeEnd();
-    for (; it != eit; ++it) {
-        const IndirectSVFGEdge *inEdge = llvm::cast<IndirectSVFGEdge>(*it);
-        inPointsTo = inEdge->getPointsTo();
+    std::vector<BypassEdges> edges(independent.size());
+    parallelFor(independent.size(), Options::SVFGOPTThreads, [&](size_t i) {
+        if (llvm::isa<ActualOUTSVFGNode>(independent[i]) ||
+            llvm::isa<FormalINSVFGNode>(independent[i])) {
+            collectEdgesOfAOutFIn(independent[i], edges[i]);
+        }
+    });
+
+    for (size_t i = 0; i < independent.size(); ++i) {
+        if (canBeRemoved(independent[i])) {
+            /// reset def of address-taken variable
+            addBypassEdges(edges[i]);
+            removeAllEdges(independent[i]);
+            removeGNodeAndDelete(independent[i]);
+        }
+    }
 
-        def = inEdge->getSrcNode();
-        if (llvm::isa<ActualINSVFGNode>(node)) {
-            setActualINDef(node->getId(), def->getId());
-        } else if (llvm::isa<FormalOUTSVFGNode>(node)) {
-            setFormalOUTDef(node->getId(), def->getId());
+    for (SVFGNode *node : dependent) {
+        if (canBeRemoved(node)) {
+            BypassEdges nodeEdges;
+            if (llvm::isa<ActualOUTSVFGNode>(node) ||
+                llvm::isa<FormalINSVFGNode>(node)) {
+                collectEdgesOfAOutFIn(node, nodeEdges);
+            }
+            addBypassEdges(nodeEdges);
+            removeAllEdges(node);
+            removeGNodeAndDelete(node);
         }
     }
+}
 
-    it = node->OutEdgeBegin(), eit = node->OutEdgeEnd();
-    for (; it != eit; ++it) {
-        const IndirectSVFGEdge *outEdge = llvm::cast<IndirectSVFGEdge>(*it);
+NodeID SVFGOPT::collectEdgesOfAInFOut(const SVFGNode *node,
+                                      BypassEdges &edges) const {
+    assert(
+        node->getInEdges().size() == 1 &&
+        "actual-in/formal-out can only have one incoming edge as its def size");
+
+    const auto *inEdge = llvm::cast<IndirectSVFGEdge>(*node->InEdgeBegin());
+    const PointsTo &inPointsTo = inEdge->getPointsTo();
+    NodeID def = inEdge->getSrcID();
+
+    for (auto it = node->OutEdgeBegin(), eit = node->OutEdgeEnd(); it != eit;
+         ++it) {
+        const auto *outEdge = llvm::cast<IndirectSVFGEdge>(*it);
         PointsTo intersection = inPointsTo;
         intersection &= outEdge->getPointsTo();
 
@@ -229,26 +290,27 @@ void SVFGOPT::retargetEdgesOfAInFOut(SVFGNode *node) {
             continue;
         }
 
-        SVFGNode *dstNode = outEdge->getDstNode();
+        NodeID dstId = outEdge->getDstID();
         if (const auto *callEdge = llvm::dyn_cast<CallIndSVFGEdge>(outEdge)) {
-            addCallIndirectSVFGEdge(def->getId(), dstNode->getId(),
-                                    callEdge->getCallSiteId(), intersection);
+            edges.push_back({def, dstId, SVFGEdge::CallIndVF,
+                             callEdge->getCallSiteId(), intersection});
         } else if (const auto *retEdge =
                        llvm::dyn_cast<RetIndSVFGEdge>(outEdge)) {
-            addRetIndirectSVFGEdge(def->getId(), dstNode->getId(),
-                                   retEdge->getCallSiteId(), intersection);
+            edges.push_back({def, dstId, SVFGEdge::RetIndVF,
+                             retEdge->getCallSiteId(), intersection});
         } else {
             assert(false && "expecting an inter-procedural SVFG edge");
         }
     }
 
-    removeAllEdges(node);
+    return def;
 }
 
 /*!
- *
+ * Connect actual-out/formal-in's predecessors to their successors directly.
  */
-void SVFGOPT::retargetEdgesOfAOutFIn(SVFGNode *node) {
+void SVFGOPT::collectEdgesOfAOutFIn(const SVFGNode *node,
+                                    BypassEdges &edges) const {
     auto inIt = node->InEdgeBegin();
     auto inEit = node->InEdgeEnd();
     for (; inIt != inEit; ++inIt) {
@@ -269,19 +331,30 @@ void SVFGOPT::retargetEdgesOfAOutFIn(SVFGNode *node) {
 
             NodeID dstId = outEdge->getDstID();
             if (const auto *retEdge = llvm::dyn_cast<RetIndSVFGEdge>(inEdge)) {
-                addRetIndirectSVFGEdge(srcId, dstId, retEdge->getCallSiteId(),
-                                       intersection);
+                edges.push_back({srcId, dstId, SVFGEdge::RetIndVF,
+                                 retEdge->getCallSiteId(), intersection});
             } else if (const auto *callEdge =
                            llvm::dyn_cast<CallIndSVFGEdge>(inEdge)) {
-                addCallIndirectSVFGEdge(srcId, dstId, callEdge->getCallSiteId(),
-                                        intersection);
+                edges.push_back({srcId, dstId, SVFGEdge::CallIndVF,
+                                 callEdge->getCallSiteId(), intersection});
             } else {
-                addIntraIndirectVFEdge(srcId, dstId, intersection);
+                edges.push_back(
+                    {srcId, dstId, SVFGEdge::IntraIndirectVF, 0, intersection});
             }
         }
     }
+}
 
-    removeAllEdges(node);
+void SVFGOPT::addBypassEdges(const BypassEdges &edges) {
+    for (const BypassEdge &edge : edges) {
+        if (edge.kind == SVFGEdge::CallIndVF) {
+            addCallIndirectSVFGEdge(edge.src, edge.dst, edge.csId, edge.pts);
+        } else if (edge.kind == SVFGEdge::RetIndVF) {
+            addRetIndirectSVFGEdge(edge.src, edge.dst, edge.csId, edge.pts);
+        } else {
+            addIntraIndirectVFEdge(edge.src, edge.dst, edge.pts);
+        }
+    }
 }
 
 /*!
@@ -318,6 +391,22 @@ bool SVFGOPT::isConnectingTwoCallSites(const SVFGNode *node) const {
     return false;
 }
 
+bool SVFGOPT::isAdjacentTo(const SVFGNode *node, const NodeBS &nodes) const {
+    for (const SVFGEdge *edge : node->getInEdges()) {
+        if (edge->getSrcID() != node->getId() &&
+            nodes.test(edge->getSrcID())) {
+            return true;
+        }
+    }
+    for (const SVFGEdge *edge : node->getOutEdges()) {
+        if (edge->getDstID() != node->getId() &&
+            nodes.test(edge->getDstID())) {
+            return true;
+        }
+    }
+    return false;
+}
+
 /// Return TRUE if this SVFGNode can be removed.
 /// Nodes can be removed if it is:
 /// 1. ActualParam/FormalParam/ActualRet/FormalRet
@@ -151,7 +151,7 @@ void MemSSAStat::printStat() {
 /*!
  * Constructor
  */
-SVFGStat::SVFGStat(SVFG *g) : PTAStat(g->getMSSA()->getPTA()) {
+SVFGStat::SVFGStat(SVFG *g) : PTAStat(g->getPTA()) {
     graph = g;
     clear();
     startClk();
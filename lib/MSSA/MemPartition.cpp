@@ -34,6 +34,8 @@
 
 #include "MSSA/MemPartition.h"
 
+#include <algorithm>
+
 using namespace SVF;
 
 /**
@@ -112,82 +114,143 @@ void DistinctMRG::getMRsForCallSiteRef(MRSet &aliasMRs, const PointsTo &cpts,
 
 /*-----------------------------------------------------*/
 
+/**
+ * Split each class which pts cuts into the objects in pts and the others.
+ */
+void PointsToPartition::refine(const PointsTo &pts) {
+    // Objects of pts by class (in class order, so class IDs do not depend on
+    // hashing), and those which are in no class yet.
+    OrderedMap<ClassID, std::vector<NodeID>> classToObjs;
+    std::vector<NodeID> newObjs;
+    for (NodeID obj : pts) {
+        auto it = objToClassMap.find(obj);
+        if (it == objToClassMap.end())
+            newObjs.push_back(obj);
+        else
+            classToObjs[it->second.first].push_back(obj);
+    }
+
+    for (const auto &it : classToObjs) {
+        // The class is within pts: nothing to split.
+        if (it.second.size() == classes[it.first].size())
+            continue;
+
+        ClassID split = classes.size();
+        classes.emplace_back();
+        for (NodeID obj : it.second) {
+            moveToClass(obj, split);
+        }
+    }
+
+    if (!newObjs.empty()) {
+        ClassID c = classes.size();
+        classes.emplace_back();
+        for (NodeID obj : newObjs) {
+            moveToClass(obj, c);
+        }
+    }
+}
+
+/**
+ * Move an object from its class (if any) to class c.
+ */
+void PointsToPartition::moveToClass(NodeID obj, ClassID c) {
+    auto it = objToClassMap.find(obj);
+    if (it != objToClassMap.end()) {
+        // Fill the object's place with the last object of its class.
+        std::vector<NodeID> &objs = classes[it->second.first];
+        u32_t pos = it->second.second;
+        objs[pos] = objs.back();
+        objToClassMap[objs[pos]].second = pos;
+        objs.pop_back();
+    }
+
+    objToClassMap[obj] = std::make_pair(c, classes[c].size());
+    classes[c].push_back(obj);
+}
+
+void PointsToPartition::countClassesOf(
+    const PointsTo &pts, OrderedMap<ClassID, u32_t> &counts) const {
+    for (NodeID obj : pts) {
+        auto it = objToClassMap.find(obj);
+        if (it != objToClassMap.end())
+            counts[it->second.first]++;
+    }
+}
+
+void PointsToPartition::getClassesOf(const PointsTo &pts,
+                                     ClassList &classList) const {
+    OrderedMap<ClassID, u32_t> counts;
+    countClassesOf(pts, counts);
+    for (const auto &it : counts) {
+        classList.push_back(it.first);
+    }
+}
+
+void PointsToPartition::getClassesWithin(const PointsTo &pts,
+                                         ClassList &classList) const {
+    OrderedMap<ClassID, u32_t> counts;
+    countClassesOf(pts, counts);
+    for (const auto &it : counts) {
+        if (it.second == classes[it.first].size())
+            classList.push_back(it.first);
+    }
+}
+
+PointsTo PointsToPartition::getClass(ClassID c) const {
+    PointsTo pts;
+    for (NodeID obj : classes[c]) {
+        pts.set(obj);
+    }
+    return pts;
+}
+
+/*-----------------------------------------------------*/
+
+/**
+ * The disjoint regions of a function are the classes of the partition of its
+ * objects refined by each of its conditional points-to sets.
+ */
 void IntraDisjointMRG::partitionMRs() {
     for (auto &it : getFunToPointsToList()) {
         const SVFFunction *fun = it.first;
+        DisjointMRs &mrs = getDisjointMRs(fun);
 
         for (const auto &cpts : it.second) {
-            PointsToList &inters = getIntersList(fun);
-            computeIntersections(cpts, inters);
+            mrs.partition.refine(cpts);
         }
 
         /// Create memory regions.
-        const PointsToList &inters = getIntersList(fun);
-        for (const auto &inter : inters) {
-            createDisjointMR(fun, inter);
+        std::vector<PointsTo> rankToPts;
+        rankClasses(mrs, rankToPts);
+        for (const auto &pts : rankToPts) {
+            createDisjointMR(fun, pts);
+        }
+        for (ClassID c = 0; c < mrs.partition.getNumOfClasses(); ++c) {
+            mrs.classToMR[c] = getMR(rankToPts[mrs.classToRank[c]]);
         }
     }
 }
 
 /**
- * Compute intersections between cpts and computed cpts intersections before.
+ * Regions are created in the order of their points-to sets, which keeps
+ * their IDs independent of the order of refinement.
  */
-void IntraDisjointMRG::computeIntersections(const PointsTo &cpts,
-                                            PointsToList &inters) {
-    if (inters.find(cpts) != inters.end()) {
-        // Skip this cpts if it is already in the map.
-        return;
-    } else if (cpts.count() == 1) {
-        // If this cpts has only one element, it will not intersect with any
-        // cpts in inters, just add it into intersection set.
-        inters.insert(cpts);
-        return;
-    } else {
-        PointsToList toBeDeleted;
-        PointsToList newInters;
-
-        PointsTo cpts_copy = cpts; // make a copy since cpts may be changed.
-
-        // check intersections with existing cpts in subSetMap
-        for (const auto &inter : inters) {
-            if (cpts_copy.intersects(inter)) {
-                // compute intersection between cpts and inter
-                PointsTo new_inter = inter;
-                new_inter &= cpts_copy;
-
-                // remove old intersection and add new one if possible
-                if (new_inter != inter) {
-                    toBeDeleted.insert(inter);
-                    newInters.insert(new_inter);
-
-                    // compute complement after intersection
-                    PointsTo complement = inter;
-                    complement.intersectWithComplement(new_inter);
-                    if (complement.empty() == false) {
-                        newInters.insert(complement);
-                    }
-                }
-
-                cpts_copy.intersectWithComplement(new_inter);
-
-                if (cpts_copy.empty())
-                    break;
-            }
-        }
-
-        // remove old intersections
-        for (const auto &temp_cpts : toBeDeleted) {
-            inters.erase(temp_cpts);
-        }
-
-        // add new intersections
-        for (const auto &temp_cpts : newInters) {
-            inters.insert(temp_cpts);
-        }
+void IntraDisjointMRG::rankClasses(DisjointMRs &mrs,
+                                   std::vector<PointsTo> &rankToPts) {
+    u32_t numOfClasses = mrs.partition.getNumOfClasses();
+    OrderedMap<PointsTo, ClassID, MemRegion::equalPointsTo> ptsToClass;
+    for (ClassID c = 0; c < numOfClasses; ++c) {
+        ptsToClass[mrs.partition.getClass(c)] = c;
+    }
 
-        // add remaining set into inters
-        if (cpts_copy.empty() == false)
-            inters.insert(cpts_copy);
+    mrs.classToMR.assign(numOfClasses, nullptr);
+    mrs.classToRank.assign(numOfClasses, 0);
+    rankToPts.clear();
+    rankToPts.reserve(numOfClasses);
+    for (const auto &it : ptsToClass) {
+        mrs.classToRank[it.second] = rankToPts.size();
+        rankToPts.push_back(it.first);
     }
 }
 
@@ -203,19 +266,34 @@ void IntraDisjointMRG::createDisjointMR(const SVFFunction *func,
     createMR(func, cpts);
 }
 
-void IntraDisjointMRG::getMRsForLoadFromInterList(MRSet &mrs,
-                                                  const PointsTo &cpts,
-                                                  const PointsToList &inters) {
-    auto it = inters.begin();
-    auto eit = inters.end();
-    for (; it != eit; ++it) {
-        const PointsTo &inter = *it;
-        if (cpts.contains(inter)) {
-            MemRegion mr(inter);
-            auto mit = memRegSet.find(&mr);
-            assert(mit != memRegSet.end() && "memory region not found!!");
-            mrs.insert(*mit);
-        }
+/**
+ * Regions whose objects are all in cpts. Only the classes of the objects of
+ * cpts are candidates.
+ */
+void IntraDisjointMRG::getMRsWithin(MRSet &mrs, const PointsTo &cpts,
+                                    const DisjointMRs &disjointMRs) {
+    PointsToPartition::ClassList classList;
+    disjointMRs.partition.getClassesWithin(cpts, classList);
+    for (ClassID c : classList) {
+        const MemRegion *mr = disjointMRs.classToMR[c];
+        assert(mr != nullptr && "memory region not found!!");
+        mrs.insert(mr);
+    }
+}
+
+/**
+ * Regions of fun sharing objects with cpts.
+ */
+void IntraDisjointMRG::getAliasMRs(MRSet &aliasMRs, const PointsTo &cpts,
+                                   const SVFFunction *fun,
+                                   const DisjointMRs &disjointMRs) {
+    const MRSet &funMRs = getFunMRSet(fun);
+    PointsToPartition::ClassList classList;
+    disjointMRs.partition.getClassesOf(cpts, classList);
+    for (ClassID c : classList) {
+        const MemRegion *mr = disjointMRs.classToMR[c];
+        if (mr != nullptr && funMRs.find(mr) != funMRs.end())
+            aliasMRs.insert(mr);
     }
 }
 
@@ -231,22 +309,40 @@ void IntraDisjointMRG::getMRsForCallSiteRef(MRSet &aliasMRs,
 
 /*-----------------------------------------------------*/
 
+/**
+ * The disjoint regions are the classes of the partition of all objects
+ * refined by every conditional points-to set. A function has those within
+ * its own sets.
+ */
 void InterDisjointMRG::partitionMRs() {
     /// Generate disjoint cpts.
     for (auto &it : getFunToPointsToList()) {
         for (const auto &cpts : it.second) {
-            computeIntersections(cpts, inters);
+            interMRs.partition.refine(cpts);
         }
     }
 
     /// Create memory regions.
+    std::vector<PointsTo> rankToPts;
+    rankClasses(interMRs, rankToPts);
+
+    PointsToPartition::ClassList classList;
     for (auto &it : getFunToPointsToList()) {
         const SVFFunction *fun = it.first;
 
         for (const auto &cpts : it.second) {
-            for (const auto &inter : inters) {
-                if (cpts.contains(inter))
-                    createDisjointMR(fun, inter);
+            classList.clear();
+            interMRs.partition.getClassesWithin(cpts, classList);
+            std::sort(classList.begin(), classList.end(),
+                      [this](ClassID c1, ClassID c2) {
+                          return interMRs.classToRank[c1] <
+                                 interMRs.classToRank[c2];
+                      });
+            for (ClassID c : classList) {
+                const PointsTo &pts = rankToPts[interMRs.classToRank[c]];
+                createDisjointMR(fun, pts);
+                if (interMRs.classToMR[c] == nullptr)
+                    interMRs.classToMR[c] = getMR(pts);
             }
         }
     }
@@ -33,9 +33,14 @@
 #include "SVF-FE/LLVMUtil.h"
 #include "Util/Options.h"
 
+#include <mutex>
+
 using namespace SVF;
 using namespace SVFUtil;
 
+/// Guards the phase times, added up over functions built concurrently
+static std::mutex timeMutex;
+
 static std::string kDistinctMemPar = "distinct";
 static std::string kIntraDisjointMemPar = "intra-disjoint";
 static std::string kInterDisjointMemPar = "inter-disjoint";
@@ -77,6 +82,46 @@ MemSSA::MemSSA(BVDataPTAImpl *p, bool ptrOnlyMSSA)
     timeOfGeneratingMemRegions += (mrEnd - mrStart) / TIMEINTERVAL;
 }
 
+/*!
+ * Constructor of a function Memory SSA, which uses the regions (and
+ * statistics) of the whole one
+ */
+MemSSA::MemSSA(MemSSA *whole)
+    : pta(whole->pta), mrGen(whole->mrGen), stat(whole->stat),
+      wholeMSSA(whole) {}
+
+std::unique_ptr<MemSSA> MemSSA::createFunMSSA() {
+    assert(wholeMSSA == nullptr && "not the whole Memory SSA");
+    return std::unique_ptr<MemSSA>(new MemSSA(this));
+}
+
+/*!
+ * Move the mus, chis and phis of a function Memory SSA into this one
+ */
+void MemSSA::mergeFunMSSA(MemSSA &funMSSA) {
+    assert(funMSSA.wholeMSSA == this && "not a function Memory SSA of ours");
+
+    for (const MRVerSPtr &ver : funMSSA.funVersions) {
+        ver->renumber();
+    }
+    funMSSA.funVersions.clear();
+
+    // Functions have disjoint loads, stores, callsites and basic blocks.
+    auto merge = [](auto &from, auto &to) {
+        for (auto &it : from) {
+            to[it.first] = std::move(it.second);
+        }
+        from.clear();
+    };
+    merge(funMSSA.load2MuSetMap, load2MuSetMap);
+    merge(funMSSA.store2ChiSetMap, store2ChiSetMap);
+    merge(funMSSA.callsiteToMuSetMap, callsiteToMuSetMap);
+    merge(funMSSA.callsiteToChiSetMap, callsiteToChiSetMap);
+    merge(funMSSA.bb2PhiSetMap, bb2PhiSetMap);
+    merge(funMSSA.funToEntryChiSetMap, funToEntryChiSetMap);
+    merge(funMSSA.funToReturnMuSetMap, funToReturnMuSetMap);
+}
+
 /*!
  * Set DF/DT
  */
@@ -105,18 +150,20 @@ void MemSSA::buildMemSSA(const SVFFunction &fun, DominanceFrontier *f,
     double muchiStart = stat->getClk(true);
     createMUCHI(fun);
     double muchiEnd = stat->getClk(true);
-    timeOfCreateMUCHI += (muchiEnd - muchiStart) / TIMEINTERVAL;
 
     /// Insert PHI for memory regions
     double phiStart = stat->getClk(true);
     insertPHI(fun);
     double phiEnd = stat->getClk(true);
-    timeOfInsertingPHI += (phiEnd - phiStart) / TIMEINTERVAL;
 
     /// SSA rename for memory regions
     double renameStart = stat->getClk(true);
     SSARename(fun);
     double renameEnd = stat->getClk(true);
+
+    std::lock_guard<std::mutex> lock(timeMutex);
+    timeOfCreateMUCHI += (muchiEnd - muchiStart) / TIMEINTERVAL;
+    timeOfInsertingPHI += (phiEnd - phiStart) / TIMEINTERVAL;
     timeOfSSARenaming += (renameEnd - renameStart) / TIMEINTERVAL;
 }
 
@@ -155,10 +202,17 @@ void MemSSA::createMUCHI(const SVFFunction &fun) {
             if (mrGen->hasPAGEdgeList(inst)) {
                 PAGEdgeList &pagEdgeList = mrGen->getPAGEdgesFromInst(inst);
                 for (const auto *inst : pagEdgeList) {
-                    if (const auto *load = llvm::dyn_cast<LoadPE>(inst))
-                        AddLoadMU(bb, load, mrGen->getLoadMRSet(load));
-                    else if (const auto *store = llvm::dyn_cast<StorePE>(inst))
-                        AddStoreCHI(bb, store, mrGen->getStoreMRSet(store));
+                    // Look the regions up without adding empty sets, as
+                    // functions may be built concurrently.
+                    if (const auto *load = llvm::dyn_cast<LoadPE>(inst)) {
+                        if (mrGen->hasLoadMRSet(load))
+                            AddLoadMU(bb, load, mrGen->getLoadMRSet(load));
+                    } else if (const auto *store =
+                                   llvm::dyn_cast<StorePE>(inst)) {
+                        if (mrGen->hasStoreMRSet(store))
+                            AddStoreCHI(bb, store,
+                                        mrGen->getStoreMRSet(store));
+                    }
                 }
             }
             if (isNonInstricCallSite(inst)) {
@@ -326,7 +380,13 @@ MRVerSPtr MemSSA::newSSAName(const MemRegion *mr, MSSADEF *def) {
 
     MRVERSION version = mr2CounterMap[mr];
     mr2CounterMap[mr] = version + 1;
-    auto mrVer = make_shared<MRVer>(mr, version, def);
+    MRVerSPtr mrVer;
+    if (wholeMSSA == nullptr) {
+        mrVer = make_shared<MRVer>(mr, version, def);
+    } else {
+        mrVer = make_shared<MRVer>(mr, version, def, 0);
+        funVersions.push_back(mrVer);
+    }
     mr2VerStackMap[mr].push_back(mrVer);
     return mrVer;
 }
@@ -378,9 +438,12 @@ void MemSSA::destroy() {
         }
     }
 
-    delete mrGen;
+    /// the regions and statistics of a function Memory SSA are not its own
+    if (wholeMSSA == nullptr) {
+        delete mrGen;
+        delete stat;
+    }
     mrGen = nullptr;
-    delete stat;
     stat = nullptr;
     pta = nullptr;
 }
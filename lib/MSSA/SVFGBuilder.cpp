@@ -28,13 +28,17 @@
  */
 
 #include "MSSA/SVFGBuilder.h"
+#include "Graphs/LazySVFG.h"
 #include "Graphs/SVFG.h"
 #include "MSSA/MemSSA.h"
+#include "MSSA/SVFGCache.h"
 #include "SVF-FE/LLVMUtil.h"
 #include "Util/Options.h"
+#include "Util/Parallel.h"
 #include "Util/SVFModule.h"
 #include "WPA/Andersen.h"
 #include <sstream>
+#include <typeinfo>
 
 using namespace SVF;
 using namespace SVFUtil;
@@ -47,6 +51,10 @@ SVFG *SVFGBuilder::buildPTROnlySVFGWithoutOPT(BVDataPTAImpl *pta) {
     return build(pta, VFG::PTRONLYSVFG);
 }
 
+SVFG *SVFGBuilder::buildLazyPTROnlySVFG(BVDataPTAImpl *pta) {
+    return build(pta, VFG::PTRONLYSVFG, true);
+}
+
 SVFG *SVFGBuilder::buildFullSVFG(BVDataPTAImpl *pta) {
     return build(pta, VFG::FULLSVFG_OPT);
 }
@@ -66,7 +74,23 @@ void SVFGBuilder::buildSVFG() {
 }
 
 /// Create DDA SVFG
-SVFG *SVFGBuilder::build(BVDataPTAImpl *pta, VFG::VFGK kind) {
+SVFG *SVFGBuilder::build(BVDataPTAImpl *pta, VFG::VFGK kind, bool lazy) {
+
+    /// A lazy SVFG is incomplete, and dumps need the memory SSA
+    SVFGCache cache(pta->getSVFProject(), pta->getAnalysisTy());
+    bool useCache =
+        cacheable && cache.isEnabled() && !lazy && !Options::DumpVFG;
+    std::string builderName = std::string(typeid(*this).name()) +
+                              (SVFGWithIndCall ? " indcall" : "");
+    if (useCache) {
+        svfg = cache.loadSVFG(pta, kind, builderName);
+        if (svfg != nullptr) {
+            restoreFromCache(pta);
+            if (Options::FreezeGraphs)
+                svfg->freeze();
+            return svfg;
+        }
+    }
 
     MemSSA *mssa = buildMSSA(
         pta, (VFG::PTRONLYSVFG == kind || VFG::PTRONLYSVFG_OPT == kind));
@@ -75,6 +99,9 @@ SVFG *SVFGBuilder::build(BVDataPTAImpl *pta, VFG::VFGK kind) {
     /// Note that we use callgraph from andersen analysis here
     if (kind == VFG::FULLSVFG_OPT || kind == VFG::PTRONLYSVFG_OPT)
         svfg = new SVFGOPT(mssa, pta->getPAG(), kind);
+    else if (lazy)
+        svfg = new LazySVFG(mssa, pta->getPAG(), kind,
+                            Options::LazySVFGCacheSize);
     else
         svfg = new SVFG(mssa, pta->getPAG(), kind);
     buildSVFG();
@@ -83,9 +110,16 @@ SVFG *SVFGBuilder::build(BVDataPTAImpl *pta, VFG::VFGK kind) {
     if (Options::SVFGWithIndirectCall || SVFGWithIndCall)
         svfg->updateCallGraph(pta);
 
+    if (useCache)
+        cache.saveSVFG(svfg, kind, builderName);
+
     if (Options::DumpVFG)
         svfg->dump("svfg_final");
 
+    /// A lazy SVFG keeps growing, so it is not worth freezing
+    if (Options::FreezeGraphs && !lazy)
+        svfg->freeze();
+
     return svfg;
 }
 
@@ -100,19 +134,39 @@ MemSSA *SVFGBuilder::buildMSSA(BVDataPTAImpl *pta, bool ptrOnlyMSSA) {
 
     auto *mssa = new MemSSA(pta, ptrOnlyMSSA);
 
-    DominatorTree dt;
-    MemSSADF df;
-
+    std::vector<const SVFFunction *> funs;
     SVFModule *svfModule = mssa->getPTA()->getSVFModule();
     for (const auto *fun : *svfModule) {
+        if (!isExtCall(fun))
+            funs.push_back(fun);
+    }
 
-        if (isExtCall(fun))
-            continue;
-
-        dt.recalculate(*fun->getLLVMFun());
-        df.runOnDT(dt);
-
-        mssa->buildMemSSA(*fun, &df, &dt);
+    unsigned numOfThreads = getNumOfWorkerThreads(Options::MSSAThreads);
+    if (numOfThreads == 1) {
+        DominatorTree dt;
+        MemSSADF df;
+        for (const auto *fun : funs) {
+            dt.recalculate(*fun->getLLVMFun());
+            df.runOnDT(dt);
+
+            mssa->buildMemSSA(*fun, &df, &dt);
+        }
+    } else {
+        /// Functions are built concurrently and merged in module order.
+        std::vector<std::unique_ptr<MemSSA>> funMSSAs(funs.size());
+        parallelFor(funs.size(), numOfThreads, [&](size_t i) {
+            DominatorTree dt;
+            MemSSADF df;
+            dt.recalculate(*funs[i]->getLLVMFun());
+            df.runOnDT(dt);
+
+            funMSSAs[i] = mssa->createFunMSSA();
+            funMSSAs[i]->buildMemSSA(*funs[i], &df, &dt);
+        });
+        for (auto &funMSSA : funMSSAs) {
+            mssa->mergeFunMSSA(*funMSSA);
+            funMSSA.reset();
+        }
     }
 
     mssa->performStat();
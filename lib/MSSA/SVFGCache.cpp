@@ -0,0 +1,241 @@
+//===- SVFGCache.cpp -- On-disk cache of SVFGs -------------------------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013-2017>  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * SVFGCache.cpp
+ */
+
+#include "MSSA/SVFGCache.h"
+#include "Graphs/SVFGOPT.h"
+#include "SVF-FE/LLVMModule.h"
+#include "Util/Options.h"
+#include "Util/Serialization.h"
+
+#include <fstream>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MD5.h>
+#include <llvm/Support/Path.h>
+#include <mutex>
+
+using namespace SVF;
+using namespace SVFUtil;
+
+namespace {
+
+/// Hex MD5 hash of data
+std::string getMD5(llvm::StringRef data) {
+    llvm::MD5 md5;
+    md5.update(data);
+    llvm::MD5::MD5Result result;
+    md5.final(result);
+    return result.digest().str().str();
+}
+
+} // End anonymous namespace
+
+/*!
+ * The key covers every option read while building the PAG and solving the
+ * constraints, even those which should not change the result (e.g. -diff or
+ * -ander-worklist), except the solver's thread counts, which are tested not
+ * to change it.
+ */
+SVFGCache::SVFGCache(SVFProject *proj, PointerAnalysis::PTATY ptaTy)
+    : proj(proj), dir(Options::SVFGCacheDir) {
+    if (!isEnabled())
+        return;
+
+    std::string str;
+    llvm::raw_string_ostream os(str);
+    os << "SVFGCache " << version << " " << getModuleHash(proj) << " "
+       << ptaTy << " " << Options::Graphtxt.getValue() << " "
+       << Options::SVFMain.getValue() << " "
+       // PAG and memory model
+       << Options::NodeAllocStrat.getValue() << " "
+       << Options::MaxFieldLimit.getValue() << " "
+       << Options::ModelConsts.getValue() << " "
+       << Options::LocMemModel.getValue() << " "
+       << Options::SingleStride.getValue() << " "
+       << Options::HandBlackHole.getValue() << " "
+       << Options::FirstFieldEqBase.getValue() << " "
+       // call graph
+       << Options::ConnectVCallOnCHA.getValue() << " "
+       << Options::EnableThreadCallGraph.getValue() << " "
+       << Options::IndirectCallLimit.getValue() << " "
+       << Options::UsePreCompFieldSensitive.getValue() << " "
+       // solving
+       << Options::PtDataBacking.getValue() << " "
+       << Options::PtsDiff.getValue() << " " << Options::MergePWC.getValue()
+       << " " << Options::IncrementalSCC.getValue() << " "
+       << Options::SteensPrePass.getValue() << " "
+       << Options::OfflineSubst.getValue() << " "
+       << static_cast<int>(Options::AnderWorkList.getValue()) << " "
+       << Options::SFRMaxFieldExpand.getValue();
+    key = getMD5(os.str());
+}
+
+/*!
+ * Writing the bitcode of a large program takes a while, so the hash is only
+ * computed once per project.
+ */
+const std::string &SVFGCache::getModuleHash(SVFProject *proj) {
+    static std::mutex mutex;
+    static Map<const SVFProject *, std::string> projToHash;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = projToHash.find(proj);
+    if (it != projToHash.end())
+        return it->second;
+
+    llvm::MD5 md5;
+    LLVMModuleSet *modSet = proj->getLLVMModSet();
+    for (u32_t i = 0; i < modSet->getModuleNum(); ++i) {
+        llvm::SmallVector<char, 0> buffer;
+        llvm::raw_svector_ostream os(buffer);
+        llvm::WriteBitcodeToFile(*modSet->getModule(i), os);
+        md5.update(llvm::StringRef(buffer.data(), buffer.size()));
+    }
+    llvm::MD5::MD5Result result;
+    md5.final(result);
+    return projToHash[proj] = result.digest().str().str();
+}
+
+std::string SVFGCache::getPtsFile() const {
+    llvm::SmallString<128> path(dir);
+    llvm::sys::path::append(path, key + ".pts");
+    return path.str().str();
+}
+
+/*!
+ * Besides the options of the memory SSA and SVFG construction, the file
+ * depends on the builder, as builders such as SaberSVFGBuilder rewrite the
+ * SVFG they build.
+ */
+std::string SVFGCache::getSVFGFile(VFG::VFGK kind,
+                                   const std::string &builder) const {
+    std::string str;
+    llvm::raw_string_ostream os(str);
+    os << key << " " << kind << " " << builder << " "
+       << Options::MemPar.getValue() << " " << Options::IgnoreDeadFun.getValue()
+       << " " << Options::OPTSVFG.getValue() << " "
+       << Options::SVFGWithIndirectCall.getValue() << " "
+       << Options::ContextInsensitive.getValue() << " "
+       << Options::KeepAOFI.getValue() << " " << Options::SelfCycle.getValue();
+
+    llvm::SmallString<128> path(dir);
+    llvm::sys::path::append(path, getMD5(os.str()) + ".svfg");
+    return path.str().str();
+}
+
+std::string SVFGCache::getSVFGHeader(PAG *pag,
+                                     const PTACallGraph *callgraph) const {
+    std::string callSites;
+    llvm::raw_string_ostream os(callSites);
+    for (CallSiteID id = 1; id <= callgraph->getTotalCallSiteNumber(); ++id) {
+        os << callgraph->getCallSite(id)->getId() << " "
+           << callgraph->getCalleeOfCallSite(id)->getName() << "\n";
+    }
+
+    return "SVFGCache " + std::to_string(version) + " " + key + " " +
+           std::to_string(pag->getTotalNodeNum()) + " " +
+           std::to_string(pag->getICFG()->getTotalNodeNum()) + " " +
+           getMD5(os.str());
+}
+
+/*!
+ * The SVFG is only loaded if its header matches this project, and is
+ * dropped if the archive turns out to be corrupted.
+ */
+SVFG *SVFGCache::loadSVFG(BVDataPTAImpl *pta, VFG::VFGK kind,
+                          const std::string &builder) const {
+    std::ifstream is(getSVFGFile(kind, builder), std::ios::binary);
+    if (!is)
+        return nullptr;
+
+    std::string header;
+    if (!std::getline(is, header) ||
+        header != getSVFGHeader(pta->getPAG(), pta->getPTACallGraph())) {
+        writeWrnMsg("SVFG cache entry is out of date, rebuilding");
+        return nullptr;
+    }
+
+    SVFProject::setCurrentProject(proj);
+    SVFG *svfg = nullptr;
+    try {
+        loadFromArchive(is, svfg, SVFProject::BinaryArchive);
+    } catch (const std::exception &e) {
+        writeWrnMsg(std::string("SVFG cache entry is corrupted (") + e.what() +
+                    "), rebuilding");
+        return nullptr;
+    }
+    if (svfg == nullptr || svfg->getKind() != kind) {
+        delete svfg;
+        return nullptr;
+    }
+
+    svfg->attachLoadedSVFG(pta);
+    return svfg;
+}
+
+bool SVFGCache::saveSVFG(const SVFG *svfg, VFG::VFGK kind,
+                         const std::string &builder) const {
+    SVFProject::setCurrentProject(proj);
+    std::string header =
+        getSVFGHeader(svfg->getPAG(), svfg->getCallGraph());
+    return writeAtomically(
+        getSVFGFile(kind, builder), [&](const std::string &filename) {
+            std::ofstream os(filename, std::ios::binary);
+            os << header << "\n";
+            saveToArchive(os, svfg, SVFProject::BinaryArchive);
+            os.close();
+            return !os.fail();
+        });
+}
+
+bool SVFGCache::writeAtomically(
+    const std::string &filename,
+    const std::function<bool(const std::string &)> &write) {
+    llvm::StringRef parent = llvm::sys::path::parent_path(filename);
+    if (!parent.empty() && llvm::sys::fs::create_directories(parent)) {
+        writeWrnMsg("cannot create cache directory " + parent.str());
+        return false;
+    }
+
+    llvm::SmallString<128> tmpFile;
+    if (llvm::sys::fs::createUniqueFile(filename + ".tmp-%%%%%%", tmpFile)) {
+        writeWrnMsg("cannot create a temporary file for " + filename);
+        return false;
+    }
+
+    bool written = false;
+    try {
+        written = write(tmpFile.str().str());
+    } catch (const std::exception &) {
+        // e.g. a graph class not exported to boost, reported below
+    }
+    if (!written || llvm::sys::fs::rename(tmpFile, filename)) {
+        llvm::sys::fs::remove(tmpFile);
+        writeWrnMsg("cannot write cache file " + filename);
+        return false;
+    }
+    return true;
+}
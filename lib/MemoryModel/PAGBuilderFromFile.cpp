@@ -59,6 +59,7 @@ static u32_t gepNodeNumIndex = 100000;
 PAG *PAGBuilderFromFile::build() {
 
     string line;
+    NodeID maxNodeId = 0;
     ifstream myfile(file.c_str());
     if (myfile.is_open()) {
         while (myfile.good()) {
@@ -81,7 +82,8 @@ PAG *PAGBuilderFromFile::build() {
                 istringstream ss(line);
                 ss >> nodeId;
                 ss >> nodetype;
-                outs() << "reading node :" << nodeId << "\n";
+                DBOUT(DPAGBuild, outs() << "reading node :" << nodeId << "\n");
+                maxNodeId = std::max(maxNodeId, nodeId);
                 if (nodetype == "v") {
                     pag->addDummyValNode(nodeId);
                 } else if (nodetype == "o") {
@@ -104,8 +106,10 @@ PAG *PAGBuilderFromFile::build() {
                 ss >> edge;
                 ss >> nodeDst;
                 ss >> offsetOrCSId;
-                outs() << "reading edge :" << nodeSrc << " " << edge << " "
-                       << nodeDst << " offsetOrCSId=" << offsetOrCSId << " \n";
+                DBOUT(DPAGBuild, outs() << "reading edge :" << nodeSrc << " "
+                                        << edge << " " << nodeDst
+                                        << " offsetOrCSId=" << offsetOrCSId
+                                        << " \n");
                 addEdge(nodeSrc, nodeDst, offsetOrCSId, edge);
             } else {
                 if (!line.empty()) {
@@ -122,6 +126,9 @@ PAG *PAGBuilderFromFile::build() {
         outs() << "Unable to open file\n";
     }
 
+    /// GEP objects created later must not take the IDs of the file's nodes.
+    pag->getNodeIDAllocator().reserveIds(maxNodeId);
+
     /// new gep node's id from lower bound, nodeNum may not reflect the total
     /// nodes.
     u32_t lower_bound = gepNodeNumIndex;
@@ -250,6 +250,10 @@ void PointerAnalysis::finalize() {
         pag->getICFG()->dump("icfg_final");
     }
 
+    if (Options::FreezeGraphs) {
+        ptaCallGraph->freeze();
+    }
+
     if (!DumpPAGFunctions.empty()) {
         pag->dumpFunctions(DumpPAGFunctions);
     }
@@ -25,21 +25,38 @@ BVDataPTAImpl::BVDataPTAImpl(SVFProject *proj, PointerAnalysis::PTATY type,
                              bool threadCallGraph)
     : PointerAnalysis(proj, type, alias_check, enableVirtualCallAnalysis,
                       threadCallGraph) {
+    bool persistent = Options::PtDataBacking == PTBackingType::Persistent;
     if (type == Andersen_BASE || type == Andersen_WPA ||
         type == AndersenWaveDiff_WPA || type == AndersenHCD_WPA ||
         type == AndersenHLCD_WPA || type == AndersenLCD_WPA ||
         type == TypeCPP_WPA || type == FlowS_DDA ||
         type == AndersenWaveDiffWithType_WPA || type == AndersenSCD_WPA ||
         type == AndersenSFR_WPA || type == Steensgaard_WPA) {
-        ptD = new MutDiffPTDataTy();
+        if (persistent) {
+            ptD = new PersDiffPTDataTy(ptCache);
+        } else {
+            ptD = new MutDiffPTDataTy();
+        }
     } else if (type == FSSPARSE_WPA || type == FSTBHC_WPA) {
         if (Options::INCDFPTData) {
-            ptD = new IncMutDFPTDataTy(false);
+            if (persistent) {
+                ptD = new PersIncDFPTDataTy(ptCache, false);
+            } else {
+                ptD = new IncMutDFPTDataTy(false);
+            }
         } else {
-            ptD = new MutDFPTDataTy(false);
+            if (persistent) {
+                ptD = new PersDFPTDataTy(ptCache, false);
+            } else {
+                ptD = new MutDFPTDataTy(false);
+            }
         }
     } else if (type == VFS_WPA) {
-        ptD = new MutVersionedPTDataTy(false);
+        if (persistent) {
+            ptD = new PersVersionedPTDataTy(ptCache, false);
+        } else {
+            ptD = new MutVersionedPTDataTy(false);
+        }
     } else {
         assert(false && "no points-to data available");
     }
@@ -47,6 +64,20 @@ BVDataPTAImpl::BVDataPTAImpl(SVFProject *proj, PointerAnalysis::PTATY type,
     ptaImplTy = BVDataImpl;
 }
 
+/*!
+ * Finalization of pointer analysis, and normalize points-to information to
+ * Bit Vector representation
+ */
+void BVDataPTAImpl::finalize() {
+    normalizePointsTo();
+    PointerAnalysis::finalize();
+
+    if (Options::PStat &&
+        Options::PtDataBacking == PTBackingType::Persistent) {
+        ptCache.printStats("final");
+    }
+}
+
 /*!
  * Expand all fields of an aggregate in all points-to sets
  */
@@ -68,6 +99,37 @@ void BVDataPTAImpl::expandFIObjs(const PointsTo &pts, PointsTo &expandedPts) {
 void BVDataPTAImpl::writeToFile(const string &filename) {
     outs() << "Storing pointer analysis results to '" << filename << "'...";
 
+    if (Options::PtsFileFormat == PTFileFormat::Binary) {
+        if (writeToBinaryFile(filename)) {
+            outs() << "\n";
+        }
+    } else {
+        writeToTextFile(filename);
+    }
+}
+
+/*!
+ * Store pointer analysis result in the binary format of PointsToFile
+ */
+bool BVDataPTAImpl::writeToBinaryFile(const string &filename) {
+    auto pag = getPAG();
+
+    PointsToFileWriter writer;
+    for (auto it = pag->begin(), ie = pag->end(); it != ie; ++it) {
+        writer.addPts(it->first, getPts(it->first));
+        if (auto *gepObjPN = llvm::dyn_cast<GepObjPN>(it->second)) {
+            writer.addGepObj(it->first, pag->getBaseObjNode(it->first),
+                             gepObjPN->getLocationSet().getOffset());
+        }
+    }
+
+    return writer.write(filename);
+}
+
+/*!
+ * Store pointer analysis result as text, one node per line
+ */
+void BVDataPTAImpl::writeToTextFile(const string &filename) {
     auto pag = getPAG();
 
     error_code err;
@@ -121,6 +183,86 @@ void BVDataPTAImpl::writeToFile(const string &filename) {
 bool BVDataPTAImpl::readFromFile(const string &filename) {
     outs() << "Loading pointer analysis results from '" << filename << "'...";
 
+    bool loaded = PointsToFile::isPointsToFile(filename)
+                      ? readFromBinaryFile(filename)
+                      : readFromTextFile(filename);
+    if (!loaded) {
+        return false;
+    }
+
+    // Update callgraph
+    updateCallGraph(getPAG()->getIndirectCallsites());
+
+    outs() << "\n";
+
+    return true;
+}
+
+/*!
+ * Map a binary result file. Only the PAG offset nodes are read here, the
+ * points-to sets are copied from the file when first accessed.
+ */
+bool BVDataPTAImpl::readFromBinaryFile(const string &filename) {
+    auto pag = getPAG();
+
+    std::unique_ptr<PointsToFile> file = PointsToFile::open(filename);
+    if (file == nullptr) {
+        return false;
+    }
+
+    for (u32_t i = 0, e = file->getNumOfGepObjs(); i < e; ++i) {
+        NodeID id;
+        NodeID base;
+        Size_t offset;
+        file->getGepObj(i, id, base, offset);
+
+        NodeID n =
+            pag->getGepObjNode(pag->getObject(base), LocationSet(offset));
+        assert(id == n && "Error adding GepObjNode into PAG!");
+    }
+
+    ptsFile = std::move(file);
+    ptsLoadedFromFile.clear();
+    numOfPtsLoadedFromFile = 0;
+
+    return true;
+}
+
+/*!
+ * Copy the points-to set of id from the mapped result file into ptD, unless
+ * that has been done before.
+ */
+void BVDataPTAImpl::loadPtsFromFile(NodeID id) {
+    if (!ptsLoadedFromFile.test_and_set(id)) {
+        return;
+    }
+
+    PointsTo pts;
+    if (ptsFile->readPts(id, pts)) {
+        ptD->unionPts(id, pts);
+        // The file is no longer needed once all of it is in ptD.
+        if (++numOfPtsLoadedFromFile == ptsFile->getNumOfPts()) {
+            ptsFile.reset();
+        }
+    }
+}
+
+/*!
+ * Copy every points-to set still in the mapped result file into ptD.
+ */
+void BVDataPTAImpl::loadAllPtsFromFile() {
+    for (u32_t i = 0, e = ptsFile->getNumOfPts(); i < e; ++i) {
+        loadPtsFromFile(ptsFile->getPtsNode(i));
+        if (ptsFile == nullptr) {
+            break;
+        }
+    }
+}
+
+/*!
+ * Parse a result file written by writeToTextFile
+ */
+bool BVDataPTAImpl::readFromTextFile(const string &filename) {
     auto pag = getPAG();
 
     ifstream F(filename.c_str());
@@ -180,11 +322,7 @@ bool BVDataPTAImpl::readFromFile(const string &filename) {
         getline(F, line);
     }
 
-    // Update callgraph
-    updateCallGraph(pag->getIndirectCallsites());
-
     F.close();
-    outs() << "\n";
 
     return true;
 }
@@ -0,0 +1,312 @@
+//===- PointsToFile.cpp -- Binary pointer analysis result files --------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * PointsToFile.cpp
+ */
+
+#include "MemoryModel/PointsToFile.h"
+#include "Util/SVFUtil.h"
+
+#include <llvm/Support/LEB128.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+using namespace SVF;
+using namespace SVFUtil;
+
+namespace {
+
+/// On-disk records. All of them are a multiple of 8 bytes so every section
+/// stays aligned in the mapped file.
+//@{
+struct FileHeader {
+    char magic[8];
+    u32_t version;
+    u32_t numOfPts;
+    u32_t numOfGepObjs;
+    /// Written as byteOrderMark, to reject files from the other endianness.
+    u32_t byteOrder;
+    u64_t payloadSize;
+};
+
+struct IndexEntry {
+    u32_t node;
+    /// Number of elements of the points-to set.
+    u32_t size;
+    /// Offset of the encoded set from the start of the payload.
+    u64_t offset;
+};
+
+struct GepObjEntry {
+    u32_t id;
+    u32_t base;
+    int64_t offset;
+};
+//@}
+
+static_assert(sizeof(FileHeader) == 32, "unexpected FileHeader layout");
+static_assert(sizeof(IndexEntry) == 16, "unexpected IndexEntry layout");
+static_assert(sizeof(GepObjEntry) == 16, "unexpected GepObjEntry layout");
+
+const char fileMagic[8] = {'S', 'V', 'F', 'P', 'T', 'S', '\0', '\n'};
+const u32_t byteOrderMark = 0x01020304;
+
+/// Records are copied out rather than cast in place as a buffer which is
+/// read instead of mapped is not guaranteed to be aligned.
+template <typename T> T readRecord(const char *data) {
+    T record;
+    std::memcpy(&record, data, sizeof(T));
+    return record;
+}
+
+template <typename T> void writeRecord(raw_ostream &os, const T &record) {
+    os.write(reinterpret_cast<const char *>(&record), sizeof(T));
+}
+
+inline size_t getIndexStart() { return sizeof(FileHeader); }
+
+inline size_t getGepObjsStart(const FileHeader &header) {
+    return getIndexStart() + header.numOfPts * sizeof(IndexEntry);
+}
+
+inline size_t getPayloadStart(const FileHeader &header) {
+    return getGepObjsStart(header) + header.numOfGepObjs * sizeof(GepObjEntry);
+}
+
+} // End anonymous namespace
+
+void PointsToFileWriter::addPts(NodeID node, const PointsTo &pts) {
+    if (pts.empty()) {
+        return;
+    }
+
+    ptsEntries.push_back({node, pts.count(), getPayloadOffset(pts)});
+}
+
+void PointsToFileWriter::addGepObj(NodeID id, NodeID base, Size_t offset) {
+    gepObjs.push_back({id, base, offset});
+}
+
+u64_t PointsToFileWriter::getPayloadOffset(const PointsTo &pts) {
+    auto it = ptsToOffset.find(pts);
+    if (it != ptsToOffset.end()) {
+        return it->second;
+    }
+
+    u64_t offset = payload.size();
+    llvm::raw_string_ostream os(payload);
+    NodeID prev = 0;
+    for (NodeID o : pts) {
+        llvm::encodeULEB128(o - prev, os);
+        prev = o;
+    }
+    os.flush();
+
+    ptsToOffset.emplace(pts, offset);
+    return offset;
+}
+
+bool PointsToFileWriter::write(const std::string &filename) {
+    std::error_code err;
+    ToolOutputFile F(filename.c_str(), err, llvm::sys::fs::F_None);
+    if (err) {
+        outs() << "  error opening file for writing!\n";
+        F.os().clear_error();
+        return false;
+    }
+
+    std::sort(ptsEntries.begin(), ptsEntries.end(),
+              [](const PtsEntry &a, const PtsEntry &b) {
+                  return a.node < b.node;
+              });
+
+    FileHeader header;
+    std::memcpy(header.magic, fileMagic, sizeof(fileMagic));
+    header.version = PointsToFile::version;
+    header.numOfPts = ptsEntries.size();
+    header.numOfGepObjs = gepObjs.size();
+    header.byteOrder = byteOrderMark;
+    header.payloadSize = payload.size();
+    writeRecord(F.os(), header);
+
+    for (const PtsEntry &entry : ptsEntries) {
+        writeRecord(F.os(), IndexEntry{entry.node, entry.size, entry.offset});
+    }
+    for (const GepObj &gepObj : gepObjs) {
+        writeRecord(F.os(), GepObjEntry{gepObj.id, gepObj.base,
+                                        static_cast<int64_t>(gepObj.offset)});
+    }
+    F.os() << payload;
+
+    F.os().close();
+    if (F.os().has_error()) {
+        F.os().clear_error();
+        return false;
+    }
+
+    F.keep();
+    return true;
+}
+
+bool PointsToFile::isPointsToFile(const std::string &filename) {
+    std::ifstream F(filename.c_str(), std::ios::binary);
+    char magic[sizeof(fileMagic)];
+    return F.read(magic, sizeof(magic)) &&
+           std::memcmp(magic, fileMagic, sizeof(fileMagic)) == 0;
+}
+
+std::unique_ptr<PointsToFile> PointsToFile::open(const std::string &filename) {
+    // Large files are mapped rather than read.
+    llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buf =
+        llvm::MemoryBuffer::getFile(filename, -1,
+                                    /*RequiresNullTerminator=*/false);
+    if (!buf) {
+        outs() << "  error opening file for reading!\n";
+        return nullptr;
+    }
+
+    std::unique_ptr<PointsToFile> file(new PointsToFile(std::move(*buf)));
+    if (!file->validate()) {
+        outs() << "  not a valid points-to file of version " << version
+               << "!\n";
+        return nullptr;
+    }
+
+    return file;
+}
+
+bool PointsToFile::validate() const {
+    if (buffer->getBufferSize() < sizeof(FileHeader)) {
+        return false;
+    }
+
+    FileHeader header = readRecord<FileHeader>(buffer->getBufferStart());
+    if (std::memcmp(header.magic, fileMagic, sizeof(fileMagic)) != 0 ||
+        header.version != version || header.byteOrder != byteOrderMark) {
+        return false;
+    }
+
+    // Subtract rather than add, so that a huge payload size cannot wrap
+    // around to the buffer size.
+    size_t payloadStart = getPayloadStart(header);
+    size_t bufferSize = buffer->getBufferSize();
+    if (payloadStart > bufferSize ||
+        header.payloadSize != bufferSize - payloadStart) {
+        return false;
+    }
+
+    // readPts relies on the index being sorted, and every element of a set
+    // takes at least one byte of the payload.
+    const char *index = buffer->getBufferStart() + getIndexStart();
+    for (u32_t i = 0; i < header.numOfPts; ++i) {
+        IndexEntry entry = readRecord<IndexEntry>(index);
+        index += sizeof(IndexEntry);
+        if (i > 0 && getPtsNode(i - 1) >= entry.node) {
+            return false;
+        }
+        if (entry.offset > header.payloadSize ||
+            entry.size > header.payloadSize - entry.offset) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+u32_t PointsToFile::getNumOfPts() const {
+    return readRecord<FileHeader>(buffer->getBufferStart()).numOfPts;
+}
+
+NodeID PointsToFile::getPtsNode(u32_t i) const {
+    assert(i < getNumOfPts() && "PointsToFile::getPtsNode: out of range!");
+    const char *entry =
+        buffer->getBufferStart() + getIndexStart() + i * sizeof(IndexEntry);
+    return readRecord<IndexEntry>(entry).node;
+}
+
+bool PointsToFile::readPts(NodeID node, PointsTo &pts) const {
+    // Binary search on the index.
+    u32_t lo = 0;
+    u32_t hi = getNumOfPts();
+    while (lo < hi) {
+        u32_t mid = lo + (hi - lo) / 2;
+        if (getPtsNode(mid) < node) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if (lo == getNumOfPts() || getPtsNode(lo) != node) {
+        return false;
+    }
+
+    return decodePts(lo, pts);
+}
+
+bool PointsToFile::decodePts(u32_t i, PointsTo &pts) const {
+    const char *start = buffer->getBufferStart();
+    FileHeader header = readRecord<FileHeader>(start);
+    IndexEntry entry = readRecord<IndexEntry>(start + getIndexStart() +
+                                              i * sizeof(IndexEntry));
+
+    const auto *p = reinterpret_cast<const uint8_t *>(
+        start + getPayloadStart(header) + entry.offset);
+    const auto *end = reinterpret_cast<const uint8_t *>(buffer->getBufferEnd());
+    // Only touch pts once the whole set has been decoded.
+    PointsTo decoded;
+    NodeID o = 0;
+    for (u32_t n = 0; n < entry.size; ++n) {
+        unsigned len = 0;
+        const char *error = nullptr;
+        o += llvm::decodeULEB128(p, &len, end, &error);
+        if (error != nullptr) {
+            writeWrnMsg(std::string("corrupt points-to file: ") + error);
+            return false;
+        }
+        p += len;
+        decoded.set(o);
+    }
+
+    pts |= decoded;
+    return true;
+}
+
+u32_t PointsToFile::getNumOfGepObjs() const {
+    return readRecord<FileHeader>(buffer->getBufferStart()).numOfGepObjs;
+}
+
+void PointsToFile::getGepObj(u32_t i, NodeID &id, NodeID &base,
+                             Size_t &offset) const {
+    FileHeader header = readRecord<FileHeader>(buffer->getBufferStart());
+    assert(i < header.numOfGepObjs &&
+           "PointsToFile::getGepObj: out of range!");
+    GepObjEntry entry = readRecord<GepObjEntry>(buffer->getBufferStart() +
+                                                getGepObjsStart(header) +
+                                                i * sizeof(GepObjEntry));
+    id = entry.id;
+    base = entry.base;
+    offset = entry.offset;
+}
@@ -47,6 +47,7 @@ void SaberSVFGBuilder::buildSVFG() {
           outs() << pasMsg("\tRemove Dereference Direct SVFG Edge\n"));
 
     rmDerefDirSVFGEdges(pta);
+    collectGlobalSVFGNodes(pta);
 
     DBOUT(DGENERAL, outs() << pasMsg("\tAdd Sink SVFG Nodes\n"));
 
@@ -56,6 +57,15 @@ void SaberSVFGBuilder::buildSVFG() {
         svfg->performStat();
 }
 
+/*!
+ * The cached SVFG already has the dereference edges removed and the sink
+ * nodes added
+ */
+void SaberSVFGBuilder::restoreFromCache(BVDataPTAImpl *pta) {
+    collectGlobals(pta);
+    collectGlobalSVFGNodes(pta);
+}
+
 /*!
  * Recursively collect global memory objects
  */
@@ -143,10 +153,6 @@ void SaberSVFGBuilder::rmDerefDirSVFGEdges(BVDataPTAImpl *pta) {
                                                        SVFGEdge::IntraDirectVF);
                 assert(edge && "Edge not found!");
                 svfg->removeGEdgeAndDelete(edge);
-
-                if (accessGlobal(pta, stmtNode->getPAGDstNode())) {
-                    globSVFGNodes.insert(stmtNode);
-                }
             } else if (llvm::isa<LoadSVFGNode>(stmtNode)) {
                 const SVFGNode *def =
                     svfg->getDefSVFGNode(stmtNode->getPAGSrcNode());
@@ -154,15 +160,24 @@ void SaberSVFGBuilder::rmDerefDirSVFGEdges(BVDataPTAImpl *pta) {
                                                        SVFGEdge::IntraDirectVF);
                 assert(edge && "Edge not found!");
                 svfg->removeGEdgeAndDelete(edge);
-
-                if (accessGlobal(pta, stmtNode->getPAGSrcNode())) {
-                    globSVFGNodes.insert(stmtNode);
-                }
             }
         }
     }
 }
 
+void SaberSVFGBuilder::collectGlobalSVFGNodes(BVDataPTAImpl *pta) {
+    for (auto &it : *svfg) {
+        const SVFGNode *node = it.second;
+        if (const auto *store = llvm::dyn_cast<StoreSVFGNode>(node)) {
+            if (accessGlobal(pta, store->getPAGDstNode()))
+                globSVFGNodes.insert(store);
+        } else if (const auto *load = llvm::dyn_cast<LoadSVFGNode>(node)) {
+            if (accessGlobal(pta, load->getPAGSrcNode()))
+                globSVFGNodes.insert(load);
+        }
+    }
+}
+
 /// Add actual parameter SVFGNode for 1st argument of a deallocation like
 /// external function
 void SaberSVFGBuilder::AddExtActualParmSVFGNodes(PTACallGraph *callgraph) {
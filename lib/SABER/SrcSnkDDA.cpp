@@ -34,6 +34,7 @@
 #include "SABER/SrcSnkDDA.h"
 #include "Graphs/SVFGStat.h"
 #include "Util/Options.h"
+#include "Util/Parallel.h"
 
 using namespace SVF;
 using namespace SVFUtil;
@@ -59,56 +60,119 @@ void SrcSnkDDA::analyze() {
 
     ContextCond::setMaxCxtLen(Options::CxtLimit);
 
-    for (auto iter = sourcesBegin(), eiter = sourcesEnd(); iter != eiter;
-         ++iter) {
-        setCurSlice(*iter);
-
-        DBOUT(DGENERAL, outs()
-                            << "Analysing slice:" << (*iter)->getId() << ")\n");
-        ContextCond cxt;
-        DPIm item((*iter)->getId(), cxt);
-        forwardTraverse(item);
-
-        /// do not consider there is bug when reaching a global SVFGNode
-        /// if we touch a global, then we assume the client uses this memory
-        /// until the program exits.
-        if (getCurSlice()->isReachGlobal()) {
-            DBOUT(DSaber, outs()
-                              << "Forward analysis reaches globals for slice:"
-                              << (*iter)->getId() << ")\n");
-        } else {
-            DBOUT(DSaber,
-                  outs() << "Forward process for slice:" << (*iter)->getId()
-                         << " (size = " << getCurSlice()->getForwardSliceSize()
-                         << ")\n");
-
-            for (auto sit = getCurSlice()->sinksBegin(),
-                      esit = getCurSlice()->sinksEnd();
-                 sit != esit; ++sit) {
-                ContextCond cxt;
-                DPIm item((*sit)->getId(), cxt);
-                backwardTraverse(item);
+    /// analyse the sources in a fixed order so that reports are stable
+    std::vector<const SVFGNode *> srcs(sourcesBegin(), sourcesEnd());
+    std::sort(srcs.begin(), srcs.end(),
+              [](const SVFGNode *lhs, const SVFGNode *rhs) {
+                  return lhs->getId() < rhs->getId();
+              });
+
+    unsigned numOfThreads = getNumOfWorkerThreads(Options::SaberThreads);
+    if (numOfThreads > 1 && srcs.size() > 1) {
+        analyzeInParallel(srcs, numOfThreads);
+    } else {
+        SliceWorker worker(this, getPathAllocator());
+        for (const SVFGNode *src : srcs) {
+            reportSlice(worker.solve(src));
+        }
+    }
+
+    finalize();
+}
+
+/*!
+ * Each worker slices with a path condition allocator (and BDD manager) of its
+ * own, so workers never share mutable state. These allocators reuse the
+ * decision variables and program exits found by the shared allocator, so
+ * conditions are numbered as in a sequential run. Sources are handed out in
+ * batches and the slices of a batch are reported in order once all of them
+ * are solved, which bounds the number of live slices.
+ */
+void SrcSnkDDA::analyzeInParallel(const std::vector<const SVFGNode *> &srcs,
+                                  unsigned numOfThreads) {
+    std::vector<std::unique_ptr<PathCondAllocator>> allocators(numOfThreads);
+    std::vector<std::unique_ptr<SliceWorker>> workers(numOfThreads);
+    parallelFor(numOfThreads, numOfThreads, [&](size_t t) {
+        allocators[t] = std::make_unique<PathCondAllocator>(getPathAllocator());
+        allocators[t]->allocate();
+        workers[t] = std::make_unique<SliceWorker>(this, allocators[t].get());
+    });
+
+    const size_t batchSize = 64 * numOfThreads;
+    std::vector<ProgSlice *> slices;
+    for (size_t begin = 0; begin < srcs.size(); begin += batchSize) {
+        size_t end = std::min(begin + batchSize, srcs.size());
+        slices.assign(end - begin, nullptr);
+
+        std::atomic<size_t> next(begin);
+        parallelFor(numOfThreads, numOfThreads, [&](size_t t) {
+            for (size_t i = next++; i < end; i = next++) {
+                slices[i - begin] = workers[t]->solve(srcs[i]);
             }
+        });
 
-            DBOUT(DSaber,
-                  outs() << "Backward process for slice:" << (*iter)->getId()
-                         << " (size = " << getCurSlice()->getBackwardSliceSize()
-                         << ")\n");
+        for (ProgSlice *slice : slices) {
+            reportSlice(slice);
+        }
+    }
+
+    /// the last slice refers to a worker's allocator
+    setCurSlice(nullptr);
+}
 
-            if (Options::DumpSlice)
-                annotateSlice(_curSlice);
+void SrcSnkDDA::reportSlice(ProgSlice *slice) {
+    setCurSlice(slice);
 
-            if (_curSlice->AllPathReachableSolve() == true)
-                _curSlice->setAllReachable();
+    if (Options::DumpSlice && !slice->isReachGlobal())
+        annotateSlice(slice);
 
-            DBOUT(DSaber, outs() << "Guard computation for slice:"
-                                 << (*iter)->getId() << ")\n");
+    reportBug(slice);
+}
+
+/*!
+ * Compute the slice of src and the guards on it
+ */
+ProgSlice *SrcSnkDDA::SliceWorker::solve(const SVFGNode *src) {
+    slice = new ProgSlice(src, pathCondAllocator, dda->getSVFG());
+    clearVisitedMap();
+
+    DBOUT(DGENERAL, outs() << "Analysing slice:" << src->getId() << ")\n");
+    ContextCond cxt;
+    DPIm item(src->getId(), cxt);
+    forwardTraverse(item);
+
+    /// do not consider there is bug when reaching a global SVFGNode
+    /// if we touch a global, then we assume the client uses this memory
+    /// until the program exits.
+    if (slice->isReachGlobal()) {
+        DBOUT(DSaber, outs() << "Forward analysis reaches globals for slice:"
+                             << src->getId() << ")\n");
+    } else {
+        DBOUT(DSaber, outs() << "Forward process for slice:" << src->getId()
+                             << " (size = " << slice->getForwardSliceSize()
+                             << ")\n");
+
+        for (auto sit = slice->sinksBegin(), esit = slice->sinksEnd();
+             sit != esit; ++sit) {
+            ContextCond cxt;
+            DPIm item((*sit)->getId(), cxt);
+            backwardTraverse(item);
         }
 
-        reportBug(getCurSlice());
+        DBOUT(DSaber, outs() << "Backward process for slice:" << src->getId()
+                             << " (size = " << slice->getBackwardSliceSize()
+                             << ")\n");
+
+        if (slice->AllPathReachableSolve() == true)
+            slice->setAllReachable();
+
+        DBOUT(DSaber, outs() << "Guard computation for slice:"
+                             << src->getId() << ")\n");
     }
 
-    finalize();
+    ProgSlice *result = slice;
+    slice = nullptr;
+    return result;
 }
 
 /*!
@@ -166,12 +230,27 @@ bool SrcSnkDDA::isInAWrapper(const SVFGNode *src, CallSiteSet &csIdSet) {
     return false;
 }
 
+/*!
+ * Add a node reached forward to the slice, it is partially reachable once a
+ * sink is reached
+ */
+void SrcSnkDDA::SliceWorker::FWProcessCurNode(const DPIm &item) {
+    const SVFGNode *node = getNode(item.getCurNodeID());
+    if (dda->isSink(node)) {
+        slice->addToSinks(node);
+        slice->addToForwardSlice(node);
+        slice->setPartialReachable();
+    } else
+        slice->addToForwardSlice(node);
+}
+
 /*!
  * Propagate information forward by matching context
  */
-void SrcSnkDDA::FWProcessOutgoingEdge(const DPIm &item, SVFGEdge *edge) {
+void SrcSnkDDA::SliceWorker::FWProcessOutgoingEdge(const DPIm &item,
+                                                   SVFGEdge *edge) {
     DBOUT(DSaber, outs() << "\n##processing source: "
-                         << getCurSlice()->getSource()->getId()
+                         << slice->getSource()->getId()
                          << " forward propagate from (" << edge->getSrcID());
 
     // for indirect SVFGEdge, the propagation should follow the def-use chains
@@ -182,8 +261,8 @@ void SrcSnkDDA::FWProcessOutgoingEdge(const DPIm &item, SVFGEdge *edge) {
     DPIm newItem(dstNode->getId(), item.getContexts());
 
     /// handle globals here
-    if (isGlobalSVFGNode(dstNode) || getCurSlice()->isReachGlobal()) {
-        getCurSlice()->setReachGlobal();
+    if (dda->isGlobalSVFGNode(dstNode) || slice->isReachGlobal()) {
+        slice->setReachGlobal();
         return;
     }
 
@@ -229,11 +308,22 @@ void SrcSnkDDA::FWProcessOutgoingEdge(const DPIm &item, SVFGEdge *edge) {
                              << newItem.getContexts().cxtSize() << ")\n");
 }
 
+/*!
+ * The backward slice is the part of the forward slice reaching a sink
+ */
+void SrcSnkDDA::SliceWorker::BWProcessCurNode(const DPIm &item) {
+    const SVFGNode *node = getNode(item.getCurNodeID());
+    if (slice->inForwardSlice(node)) {
+        slice->addToBackwardSlice(node);
+    }
+}
+
 /*!
  * Propagate information backward without matching context, as forward analysis
  * already did it
  */
-void SrcSnkDDA::BWProcessIncomingEdge(const DPIm &, SVFGEdge *edge) {
+void SrcSnkDDA::SliceWorker::BWProcessIncomingEdge(const DPIm &,
+                                                   SVFGEdge *edge) {
     DBOUT(DSaber, outs() << "backward propagate from (" << edge->getDstID()
                          << " --> " << edge->getSrcID() << ")\n");
     const SVFGNode *srcNode = edge->getSrcNode();
@@ -248,14 +338,12 @@ void SrcSnkDDA::BWProcessIncomingEdge(const DPIm &, SVFGEdge *edge) {
 }
 
 /// Set current slice
-void SrcSnkDDA::setCurSlice(const SVFGNode *src) {
+void SrcSnkDDA::setCurSlice(ProgSlice *slice) {
     if (_curSlice != nullptr) {
         delete _curSlice;
-        _curSlice = nullptr;
-        clearVisitedMap();
     }
 
-    _curSlice = new ProgSlice(src, getPathAllocator(), getSVFG());
+    _curSlice = slice;
 }
 
 void SrcSnkDDA::annotateSlice(ProgSlice *slice) {
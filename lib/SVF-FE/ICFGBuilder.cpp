@@ -35,6 +35,7 @@
 #include "SVF-FE/ICFGBuilder.h"
 #include "Graphs/PAG.h"
 #include "SVF-FE/LLVMUtil.h"
+#include "Util/Options.h"
 
 using namespace SVF;
 using namespace SVFUtil;
@@ -53,6 +54,9 @@ void ICFGBuilder::build() {
         processFunExit(fun);
     }
     connectGlobalToProgEntry();
+
+    if (Options::FreezeGraphs)
+        icfg->freeze();
 }
 
 /*!
@@ -118,6 +118,11 @@ void LLVMModuleSet::loadModules(const std::vector<std::string> &moduleNameVec) {
     cxts = std::make_unique<LLVMContext>();
 
     for (const std::string &moduleName : moduleNameVec) {
+        // A PAG text file standing for the program is not IR
+        if (moduleName == SVFModule::pagFileName()) {
+            continue;
+        }
+
         SMDiagnostic Err;
         std::unique_ptr<Module> mod = parseIRFile(moduleName, Err, *cxts);
         if (mod == nullptr) {
@@ -0,0 +1,486 @@
+//===- ProjectSnapshot.cpp -- Function fingerprints of an SVFProject --------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * ProjectSnapshot.cpp
+ */
+
+#include "SVF-FE/ProjectSnapshot.h"
+#include "Graphs/PAG.h"
+#include "SVF-FE/SVFProject.h"
+
+#include <llvm/IR/IntrinsicInst.h>
+#include <llvm/Support/MD5.h>
+
+#include <fstream>
+#include <sstream>
+
+using namespace SVF;
+using namespace SVFUtil;
+using namespace std;
+
+namespace {
+
+/// Low 64 bits of the MD5 hash of str
+u64_t hashString(const string &str) {
+    llvm::MD5 md5;
+    md5.update(str);
+    llvm::MD5::MD5Result result;
+    md5.final(result);
+    return result.low();
+}
+
+/// Name of the function defining val, "" if val is not local to a function
+string getFunName(const Value *val) {
+    if (const auto *inst = llvm::dyn_cast<Instruction>(val)) {
+        return inst->getFunction()->getName().str();
+    }
+    if (const auto *arg = llvm::dyn_cast<Argument>(val)) {
+        return arg->getParent()->getName().str();
+    }
+    return "";
+}
+
+} // End anonymous namespace
+
+/*
+ * Node keys have the form "<kind> <slot> <function>":
+ *   v/o   value/object of the slot-th argument or instruction of function
+ *   v/o @ name of a global value
+ *   r/a - return/vararg node of function
+ *   s id  special node (black hole, constant object, null/black hole ptr)
+ */
+
+/*!
+ * Fingerprint all function bodies and global variables of proj, and key all
+ * PAG nodes and edges
+ */
+ProjectSnapshot::ProjectSnapshot(SVFProject *proj) {
+    Map<const Value *, string> valueKeys;
+    SVFModule *svfModule = proj->getSVFModule();
+    for (auto it = svfModule->llvmFunBegin(), eit = svfModule->llvmFunEnd();
+         it != eit; ++it) {
+        const Function *fun = *it;
+        if (fun->isDeclaration()) {
+            continue;
+        }
+        funHashes[fun->getName().str()] = hashFunction(*fun, valueKeys);
+    }
+    for (auto it = svfModule->global_begin(), eit = svfModule->global_end();
+         it != eit; ++it) {
+        funHashes["@" + (*it)->getName().str()] = hashGlobal(**it);
+    }
+
+    PAG *pag = proj->getPAG();
+    for (const auto &it : *pag) {
+        NodeID id = it.first;
+        const PAGNode *node = it.second;
+
+        if (pag->isBlkObjOrConstantObj(id) || pag->isBlkPtr(id) ||
+            pag->isNullPtr(id)) {
+            nodeKeys[id] = "s " + to_string(id) + " ";
+        } else if (const auto *gepObj = llvm::dyn_cast<GepObjPN>(node)) {
+            gepObjs[id] = std::make_pair(
+                pag->getBaseObjNode(id), gepObj->getLocationSet().getOffset());
+        } else if (llvm::isa<RetPN>(node)) {
+            nodeKeys[id] = "r - " + node->getValue()->getName().str();
+        } else if (llvm::isa<VarArgPN>(node)) {
+            nodeKeys[id] = "a - " + node->getValue()->getName().str();
+        } else if (llvm::isa<FIObjPN>(node) ||
+                   node->getNodeKind() == PAGNode::ValNode) {
+            // Other nodes (GEP values, dummies) are created while building
+            // the PAG and get no key.
+            if (!node->hasValue()) {
+                continue;
+            }
+
+            string kind = llvm::isa<ObjPN>(node) ? "o " : "v ";
+            const Value *val = node->getValue();
+            if (const auto *gv = llvm::dyn_cast<GlobalValue>(val)) {
+                nodeKeys[id] = kind + "@ " + gv->getName().str();
+            } else {
+                auto kit = valueKeys.find(val);
+                if (kit != valueKeys.end()) {
+                    nodeKeys[id] = kind + kit->second;
+                }
+            }
+        }
+    }
+
+    recordConstraints(pag, valueKeys);
+}
+
+/*!
+ * Structural hash of a function body. Local values are referred to by
+ * their position in the function, so renaming them or changing other
+ * functions does not change the hash. Debug info is ignored.
+ */
+u64_t ProjectSnapshot::hashFunction(
+    const Function &fun, Map<const Value *, string> &valueKeys) const {
+    string funName = fun.getName().str();
+    Map<const Value *, u32_t> slots;
+    for (const Argument &arg : fun.args()) {
+        slots.emplace(&arg, slots.size());
+    }
+    Map<const BasicBlock *, u32_t> blocks;
+    for (const BasicBlock &bb : fun) {
+        blocks.emplace(&bb, blocks.size());
+        for (const Instruction &inst : bb) {
+            if (llvm::isa<llvm::DbgInfoIntrinsic>(&inst)) {
+                continue;
+            }
+            slots.emplace(&inst, slots.size());
+        }
+    }
+
+    for (const auto &it : slots) {
+        valueKeys[it.first] = to_string(it.second) + " " + funName;
+    }
+
+    string body;
+    raw_string_ostream os(body);
+    fun.getFunctionType()->print(os);
+    os << "\n";
+    for (const BasicBlock &bb : fun) {
+        os << "bb" << blocks[&bb] << ":\n";
+        for (const Instruction &inst : bb) {
+            if (llvm::isa<llvm::DbgInfoIntrinsic>(&inst)) {
+                continue;
+            }
+
+            os << inst.getOpcodeName() << " ";
+            inst.getType()->print(os);
+            if (const auto *cmp = llvm::dyn_cast<CmpInst>(&inst)) {
+                os << " p" << cmp->getPredicate();
+            }
+            for (const Value *op : inst.operands()) {
+                os << ", ";
+                auto sit = slots.find(op);
+                if (sit != slots.end()) {
+                    os << "%" << sit->second;
+                } else if (const auto *opBB = llvm::dyn_cast<BasicBlock>(op)) {
+                    os << "bb" << blocks[opBB];
+                } else if (const auto *gv = llvm::dyn_cast<GlobalValue>(op)) {
+                    os << "@" << gv->getName();
+                } else if (llvm::isa<MetadataAsValue>(op)) {
+                    os << "md";
+                } else {
+                    op->print(os);
+                }
+            }
+            os << "\n";
+        }
+    }
+    os.flush();
+
+    return hashString(body);
+}
+
+/*!
+ * Hash of the type, constness and initializer of a global variable. Other
+ * globals are referred to by name in the printed initializer.
+ */
+u64_t ProjectSnapshot::hashGlobal(const GlobalVariable &glob) const {
+    string def;
+    raw_string_ostream os(def);
+    glob.getValueType()->print(os);
+    os << (glob.isConstant() ? " constant" : " global");
+    if (glob.hasInitializer()) {
+        os << " ";
+        glob.getInitializer()->print(os);
+    }
+    os.flush();
+
+    return hashString(def);
+}
+
+/*!
+ * Record every PAG edge as a hash of its kind and the keys of its ends.
+ * Besides the node keys, GEP value nodes are keyed by their value and
+ * offset and GEP objects by their base object and offset. Keys shared by
+ * several nodes are not used.
+ *
+ * Edges with an end without a key cannot be told apart reliably, so the
+ * functions they belong to are recorded instead ("@" for the edges of
+ * global initializers).
+ */
+void ProjectSnapshot::recordConstraints(
+    PAG *pag, const Map<const Value *, string> &valueKeys) {
+    Map<NodeID, string> keys(nodeKeys.begin(), nodeKeys.end());
+    for (const auto &it : *pag) {
+        const auto *gepVal = llvm::dyn_cast<GepValPN>(it.second);
+        if (gepVal == nullptr || !gepVal->hasValue()) {
+            continue;
+        }
+
+        const Value *val = gepVal->getValue();
+        string valKey;
+        if (const auto *gv = llvm::dyn_cast<GlobalValue>(val)) {
+            valKey = "@ " + gv->getName().str();
+        } else {
+            auto kit = valueKeys.find(val);
+            if (kit == valueKeys.end()) {
+                continue;
+            }
+            valKey = kit->second;
+        }
+        keys[it.first] = "g " + to_string(gepVal->getOffset()) + " " + valKey;
+    }
+    for (const auto &it : gepObjs) {
+        auto bit = nodeKeys.find(it.second.first);
+        if (bit != nodeKeys.end()) {
+            keys[it.first] =
+                "G " + to_string(it.second.second) + " " + bit->second;
+        }
+    }
+
+    Map<string, u32_t> keyCounts;
+    for (const auto &it : keys) {
+        ++keyCounts[it.second];
+    }
+    auto getKey = [&](NodeID id) -> string {
+        auto it = keys.find(id);
+        if (it == keys.end() || keyCounts[it->second] > 1) {
+            return "?";
+        }
+        return it->second;
+    };
+
+    for (const auto &it : *pag) {
+        for (const PAGEdge *edge : it.second->getOutEdges()) {
+            string srcKey = getKey(edge->getSrcID());
+            string dstKey = getKey(edge->getDstID());
+            string cons = to_string(edge->getEdgeKind()) + "\n" + srcKey +
+                          "\n" + dstKey;
+            if (const auto *gep = llvm::dyn_cast<NormalGepPE>(edge)) {
+                cons += "\n" + to_string(gep->getOffset());
+            }
+            ++consCounts[hashString(cons)];
+
+            if (srcKey != "?" && dstKey != "?") {
+                continue;
+            }
+
+            Set<string> owners;
+            if (edge->getBB() != nullptr) {
+                owners.insert(edge->getBB()->getParent()->getName().str());
+            }
+            for (const PAGNode *end :
+                 {edge->getSrcNode(), edge->getDstNode()}) {
+                if (end->hasValue() && !getFunName(end->getValue()).empty()) {
+                    owners.insert(getFunName(end->getValue()));
+                }
+            }
+            if (owners.empty()) {
+                bool hasValue = edge->getSrcNode()->hasValue() ||
+                                edge->getDstNode()->hasValue();
+                owners.insert(hasValue ? "@" : "?");
+            }
+            unkeyedConsOwners.insert(owners.begin(), owners.end());
+        }
+    }
+}
+
+string ProjectSnapshot::getKeyFunction(const string &key) {
+    size_t pos = key.find(' ', 2);
+    if (pos == string::npos || key[2] == '@' || key[0] == 's') {
+        return "";
+    }
+    return key.substr(pos + 1);
+}
+
+/*!
+ * Functions which are not in both snapshots with the same fingerprint
+ */
+Set<string> ProjectSnapshot::getChangedFunctions(
+    const ProjectSnapshot &old) const {
+    Set<string> changed;
+    for (const auto &it : funHashes) {
+        auto oit = old.funHashes.find(it.first);
+        if (oit == old.funHashes.end() || oit->second != it.second) {
+            changed.insert(it.first);
+        }
+    }
+    for (const auto &it : old.funHashes) {
+        if (funHashes.find(it.first) == funHashes.end()) {
+            changed.insert(it.first);
+        }
+    }
+    return changed;
+}
+
+/*!
+ * Constraints were removed if an edge key of old is missing, or if the
+ * edges with ends without keys of a changed function or global may differ.
+ * When neither is the case, the constraints of old map to a subset of the
+ * constraints of this snapshot, so the least solution of old maps to a
+ * subset of the least solution of this snapshot.
+ */
+bool ProjectSnapshot::hasRemovedConstraints(
+    const ProjectSnapshot &old, const Set<string> &changedFuns) const {
+    bool globalsChanged = false;
+    for (const string &fun : changedFuns) {
+        globalsChanged |= !fun.empty() && fun[0] == '@';
+    }
+    for (const string &owner : old.unkeyedConsOwners) {
+        if (owner == "?" || (owner == "@" && globalsChanged) ||
+            changedFuns.count(owner)) {
+            return true;
+        }
+    }
+
+    for (const auto &it : old.consCounts) {
+        auto nit = consCounts.find(it.first);
+        if (nit == consCounts.end() || nit->second < it.second) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*!
+ * Match the keyed nodes of old with the nodes of this snapshot
+ */
+void ProjectSnapshot::mapNodes(const ProjectSnapshot &old,
+                               const Set<string> &changedFuns,
+                               Map<NodeID, NodeID> &oldToNew) const {
+    Map<string, NodeID> keyToNode;
+    for (const auto &it : nodeKeys) {
+        keyToNode[it.second] = it.first;
+    }
+
+    for (const auto &it : old.nodeKeys) {
+        if (changedFuns.count(getKeyFunction(it.second))) {
+            continue;
+        }
+
+        auto kit = keyToNode.find(it.second);
+        if (kit != keyToNode.end()) {
+            oldToNew[it.first] = kit->second;
+        }
+    }
+}
+
+/*!
+ * Write the snapshot as text:
+ *   SVFSnapshot <version>
+ *   F <hash> <function>
+ *   N <id> <key>
+ *   G <id> <base> <offset>
+ *   C <edge key hash> <count>
+ *   U <owner of edges with an end without a key>
+ */
+bool ProjectSnapshot::writeToFile(const string &filename) const {
+    error_code err;
+    ToolOutputFile F(filename.c_str(), err, llvm::sys::fs::F_None);
+    if (err) {
+        outs() << "  error opening file for writing!\n";
+        F.os().clear_error();
+        return false;
+    }
+
+    F.os() << "SVFSnapshot " << version << "\n";
+    for (const auto &it : funHashes) {
+        F.os() << "F " << it.second << " " << it.first << "\n";
+    }
+    for (const auto &it : nodeKeys) {
+        F.os() << "N " << it.first << " " << it.second << "\n";
+    }
+    for (const auto &it : gepObjs) {
+        F.os() << "G " << it.first << " " << it.second.first << " "
+               << it.second.second << "\n";
+    }
+    for (const auto &it : consCounts) {
+        F.os() << "C " << it.first << " " << it.second << "\n";
+    }
+    for (const string &owner : unkeyedConsOwners) {
+        F.os() << "U " << owner << "\n";
+    }
+
+    F.os().close();
+    if (F.os().has_error()) {
+        F.os().clear_error();
+        return false;
+    }
+
+    F.keep();
+    return true;
+}
+
+/*!
+ * Read a snapshot written by writeToFile
+ */
+bool ProjectSnapshot::readFromFile(const string &filename) {
+    ifstream F(filename.c_str());
+    if (!F.is_open()) {
+        return false;
+    }
+
+    string magic;
+    u32_t fileVersion = 0;
+    F >> magic >> fileVersion;
+    if (magic != "SVFSnapshot" || fileVersion != version) {
+        return false;
+    }
+
+    string line;
+    getline(F, line);
+    while (getline(F, line)) {
+        if (line.size() < 2) {
+            continue;
+        }
+
+        istringstream ss(line.substr(2));
+        if (line[0] == 'F') {
+            u64_t hash;
+            ss >> hash;
+            ss.get();
+            string name;
+            getline(ss, name);
+            funHashes[name] = hash;
+        } else if (line[0] == 'N') {
+            NodeID id;
+            ss >> id;
+            ss.get();
+            string key;
+            getline(ss, key);
+            nodeKeys[id] = key;
+        } else if (line[0] == 'G') {
+            NodeID id;
+            NodeID base;
+            Size_t offset;
+            ss >> id >> base >> offset;
+            gepObjs[id] = std::make_pair(base, offset);
+        } else if (line[0] == 'C') {
+            u64_t hash;
+            u32_t count;
+            ss >> hash >> count;
+            consCounts[hash] = count;
+        } else if (line[0] == 'U') {
+            unkeyedConsOwners.insert(line.substr(2));
+        } else {
+            return false;
+        }
+    }
+
+    return true;
+}
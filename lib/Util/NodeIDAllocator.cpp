@@ -123,4 +123,11 @@ NodeID NodeIDAllocator::allocateTypeId() { return numTypes++; }
 
 void NodeIDAllocator::endSymbolAllocation() { numSymbols = numNodes; }
 
+void NodeIDAllocator::reserveIds(NodeID id) {
+    // DEBUG places GEP objects past numSymbols, the others at the counters.
+    numObjects = std::max(numObjects, id + 1);
+    numNodes = std::max(numNodes, id + 1);
+    numSymbols = std::max(numSymbols, id + 1);
+}
+
 }; // namespace SVF.
@@ -118,6 +118,18 @@ const llvm::cl::opt<unsigned long long> Options::FlowBudget(
     "flow-bg", llvm::cl::init(10000),
     llvm::cl::desc("Maximum step budget of flow-sensitive traversing"));
 
+// Value-flow based demand-driven solver (DDAVFSolver.h)
+const llvm::cl::opt<unsigned> Options::DDACacheSize(
+    "dda-cache-size", llvm::cl::init(1000000),
+    llvm::cl::desc("Maximum number of dpms whose points-to a demand-driven "
+                   "analysis keeps across queries (0 keeps all)"));
+
+// Generic graph (GenericGraph.h)
+const llvm::cl::opt<bool> Options::FreezeGraphs(
+    "freeze-graphs", llvm::cl::init(false),
+    llvm::cl::desc("Compact the ICFG, SVFG and call graph for traversal once "
+                   "they are built"));
+
 // Offline constraint graph (OfflineConsG.cpp)
 const llvm::cl::opt<bool> Options::OCGDotGraph(
     "dump-ocg", llvm::cl::init(false),
@@ -145,6 +157,12 @@ const llvm::cl::opt<std::string> Options::SelfCycle(
     "keep-self-cycle", llvm::cl::value_desc("keep self cycle"),
     llvm::cl::desc("How to handle self cycle edges: all, context, none"));
 
+const llvm::cl::opt<unsigned> Options::SVFGOPTThreads(
+    "svfg-opt-threads", llvm::cl::init(1),
+    llvm::cl::desc("Number of threads collecting the edges which bypass "
+                   "removed parameter nodes of the optimised SVFG "
+                   "(0 uses all hardware threads)"));
+
 // Sparse value-flow graph (VFG.cpp)
 const llvm::cl::opt<bool>
     Options::DumpVFG("dump-vfg", llvm::cl::init(false),
@@ -181,6 +199,11 @@ const llvm::cl::opt<unsigned> Options::StatBudget(
     "stat-limit", llvm::cl::init(20),
     llvm::cl::desc("Iteration budget for On-the-fly statistics"));
 
+const llvm::cl::opt<std::string> Options::StatExport(
+    "stat-export", llvm::cl::init(""),
+    llvm::cl::desc("Export statistics and phase times to a file (CSV if it "
+                   "ends in .csv, JSON otherwise)"));
+
 const llvm::cl::opt<bool>
     Options::PAGDotGraph("dump-pag", llvm::cl::init(false),
                          llvm::cl::desc("Dump dot graph of PAG"));
@@ -226,6 +249,16 @@ const llvm::cl::opt<bool> Options::INCDFPTData(
     "inc-data", llvm::cl::init(true),
     llvm::cl::desc("Enable incremental DFPTData for flow-sensitive analysis"));
 
+const llvm::cl::opt<BVDataPTAImpl::PTBackingType> Options::PtDataBacking(
+    "ptd", llvm::cl::init(BVDataPTAImpl::PTBackingType::Mutable),
+    llvm::cl::desc("Overarching points-to data structure"),
+    llvm::cl::values(
+        clEnumValN(BVDataPTAImpl::PTBackingType::Mutable, "mutable",
+                   "give each variable its own points-to set (default)"),
+        clEnumValN(BVDataPTAImpl::PTBackingType::Persistent, "persistent",
+                   "intern points-to sets so identical sets are stored once "
+                   "and share memoised set operations")));
+
 // Memory region (MemRegion.cpp)
 const llvm::cl::opt<bool> Options::IgnoreDeadFun(
     "mssa-ignore-dead-fun", llvm::cl::init(false),
@@ -256,6 +289,27 @@ llvm::cl::opt<bool> Options::OPTSVFG(
     "opt-svfg", llvm::cl::init(true),
     llvm::cl::desc("unoptimized SVFG with formal-in and actual-out"));
 
+const llvm::cl::opt<unsigned> Options::MSSAThreads(
+    "mssa-threads", llvm::cl::init(1),
+    llvm::cl::desc("Number of threads building the Memory SSA of functions "
+                   "(0 uses all hardware threads)"));
+
+const llvm::cl::opt<bool> Options::LazySVFG(
+    "lazy-svfg", llvm::cl::init(false),
+    llvm::cl::desc("Build the indirect value-flow of a function only when a "
+                   "demand-driven analysis reaches it"));
+
+const llvm::cl::opt<unsigned> Options::LazySVFGCacheSize(
+    "lazy-svfg-cache", llvm::cl::init(0),
+    llvm::cl::desc("Maximum number of functions whose indirect value-flow a "
+                   "lazy SVFG keeps across queries (0 keeps all)"));
+
+const llvm::cl::opt<std::string> Options::SVFGCacheDir(
+    "svfg-cache-dir", llvm::cl::init(""), llvm::cl::value_desc("directory"),
+    llvm::cl::desc("Reuse the Andersen results and SVFGs stored in this "
+                   "directory by earlier runs on the same program and "
+                   "options, and store them there otherwise"));
+
 // FSMPTA.cpp
 const llvm::cl::opt<bool> Options::UsePCG(
     "pcg-td-edge", llvm::cl::init(false),
@@ -339,6 +393,11 @@ const llvm::cl::opt<unsigned>
     Options::CxtLimit("cxt-limit", llvm::cl::init(3),
                       llvm::cl::desc("Source-Sink Analysis Contexts Limit"));
 
+const llvm::cl::opt<unsigned> Options::SaberThreads(
+    "saber-threads", llvm::cl::init(1),
+    llvm::cl::desc("Number of threads for slicing sources in Saber checkers "
+                   "(0 uses all hardware threads, 1 slices sequentially)"));
+
 // CHG.cpp
 const llvm::cl::opt<bool>
     Options::DumpCHA("dump-cha", llvm::cl::init(false),
@@ -406,6 +465,22 @@ const llvm::cl::opt<std::string> Options::ReadAnder(
     "read-ander", llvm::cl::init(""),
     llvm::cl::desc("Read Andersen's analysis results from a file"));
 
+const llvm::cl::opt<BVDataPTAImpl::PTFileFormat> Options::PtsFileFormat(
+    "ander-file-format", llvm::cl::init(BVDataPTAImpl::PTFileFormat::Text),
+    llvm::cl::desc("Format of the files written by -write-ander (both are "
+                   "recognised by -read-ander)"),
+    llvm::cl::values(
+        clEnumValN(BVDataPTAImpl::PTFileFormat::Text, "text",
+                   "one line per points-to set (default)"),
+        clEnumValN(BVDataPTAImpl::PTFileFormat::Binary, "binary",
+                   "indexed binary file which is loaded lazily")));
+
+const llvm::cl::opt<std::string> Options::AnderSnapshot(
+    "ander-snapshot", llvm::cl::init(""),
+    llvm::cl::desc("Snapshot file for incremental Andersen's analysis: "
+                   "results of a previous run are reused for unchanged "
+                   "functions, and this run's snapshot is written back"));
+
 const llvm::cl::opt<bool>
     Options::PtsDiff("diff", llvm::cl::init(true),
                      llvm::cl::desc("Disable diff pts propagation"));
@@ -414,12 +489,82 @@ const llvm::cl::opt<bool>
     Options::MergePWC("merge-pwc", llvm::cl::init(true),
                       llvm::cl::desc("Enable PWC in graph solving"));
 
+const llvm::cl::opt<bool> Options::IncrementalSCC(
+    "incremental-scc", llvm::cl::init(false),
+    llvm::cl::desc("Only revisit the part of the constraint graph reachable "
+                   "from new copy/gep edges when detecting SCCs"));
+
+const llvm::cl::opt<unsigned> Options::SCCThreads(
+    "scc-threads", llvm::cl::init(1),
+    llvm::cl::desc("Number of threads for detecting SCCs in the constraint "
+                   "graph (0 uses all hardware threads, 1 detects "
+                   "sequentially)"));
+
+const llvm::cl::opt<bool> Options::SteensPrePass(
+    "steens-prepass", llvm::cl::init(false),
+    llvm::cl::desc("Run Steensgaard's analysis before Andersen's to remove "
+                   "constraints of pointers which point to nothing and to "
+                   "answer alias queries it proves no-alias"));
+
+const llvm::cl::opt<bool> Options::OfflineSubst(
+    "offline-var-subst", llvm::cl::init(false),
+    llvm::cl::desc("Merge pointer-equivalent constraint nodes found by "
+                   "offline variable substitution (HVN/HU) before solving"));
+
+const llvm::cl::opt<NodeWorkList::Order> Options::AnderWorkList(
+    "ander-worklist", llvm::cl::init(NodeWorkList::Order::FIFO),
+    llvm::cl::desc("Order of the worklist of Andersen's analysis"),
+    llvm::cl::values(
+        clEnumValN(NodeWorkList::Order::FIFO, "fifo",
+                   "first in first out (default)"),
+        clEnumValN(NodeWorkList::Order::LRF, "lrf", "least recently fired"),
+        clEnumValN(NodeWorkList::Order::TOPO, "topo",
+                   "two phases in topological order of the SCCs"),
+        clEnumValN(NodeWorkList::Order::PRIO, "prio",
+                   "priority queue on topological order of the SCCs")));
+
+// AndersenWaveDiff.cpp
+const llvm::cl::opt<unsigned> Options::AnderThreads(
+    "ander-threads", llvm::cl::init(1),
+    llvm::cl::desc("Number of threads for wave propagation in Andersen's "
+                   "analysis (0 uses all hardware threads, 1 solves "
+                   "sequentially)"));
+
+// AndersenSFR.cpp
+const llvm::cl::opt<unsigned> Options::SFRMaxFieldExpand(
+    "sfr-max-expand", llvm::cl::init(0),
+    llvm::cl::desc("Collapse objects which a stride expansion would give more "
+                   "fields than this in SFR (0 for no limit)"));
+
 // FlowSensitive.cpp
 const llvm::cl::opt<bool> Options::CTirAliasEval(
     "ctir-alias-eval", llvm::cl::init(false),
     llvm::cl::desc(
         "Prints alias evaluation of ctir instructions in FS analyses"));
 
+const llvm::cl::opt<unsigned> Options::FSThreads(
+    "fs-threads", llvm::cl::init(1),
+    llvm::cl::desc("Number of threads for solving flow-sensitive analysis "
+                   "(0 uses all hardware threads, 1 solves sequentially)"));
+
+const llvm::cl::opt<NodeWorkList::Order> Options::FSWorkList(
+    "fs-worklist", llvm::cl::init(NodeWorkList::Order::FIFO),
+    llvm::cl::desc("Order of the worklist of flow-sensitive analysis"),
+    llvm::cl::values(
+        clEnumValN(NodeWorkList::Order::FIFO, "fifo",
+                   "first in first out (default)"),
+        clEnumValN(NodeWorkList::Order::LRF, "lrf", "least recently fired"),
+        clEnumValN(NodeWorkList::Order::TOPO, "topo",
+                   "two phases in topological order of the SCCs"),
+        clEnumValN(NodeWorkList::Order::PRIO, "prio",
+                   "priority queue on topological order of the SCCs")));
+
+// VersionedFlowSensitive.cpp
+const llvm::cl::opt<unsigned> Options::VFSLabelThreads(
+    "vfs-label-threads", llvm::cl::init(1),
+    llvm::cl::desc("Number of threads for meld labeling objects in versioned "
+                   "flow-sensitive analysis (0 uses all hardware threads)"));
+
 // FlowSensitiveTBHC.cpp
 /// Whether we allow reuse for TBHC.
 const llvm::cl::opt<bool> Options::TBHCStoreReuse(
@@ -31,10 +31,136 @@
 #include "Graphs/PAG.h"
 #include "Graphs/PTACallGraph.h"
 #include "MemoryModel/PointerAnalysisImpl.h"
+#include <cmath>
+#include <fstream>
 #include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <time.h>
 
 using namespace SVF;
 
+namespace {
+
+/// Phases of the process, and the path of the innermost phase open on each
+/// thread
+//@{
+std::mutex phaseMutex;
+PhaseTimer::PhaseTimeMap phaseTimes;
+thread_local std::string currentPhase;
+//@}
+
+/// A printStat call to be exported: its values, formatted, by name
+struct StatSection {
+    std::string analysis;
+    std::string name;
+    OrderedMap<std::string, std::string> values;
+};
+
+std::vector<StatSection> exportedSections;
+
+std::string getPhasePath(const std::string &parent, const std::string &name) {
+    return parent.empty() ? name : parent + "/" + name;
+}
+
+/// Integers as they are, other numbers with three decimals; "" if not finite
+std::string formatValue(double value) {
+    if (!std::isfinite(value)) {
+        return "";
+    }
+
+    std::ostringstream os;
+    if (value == std::floor(value) && std::fabs(value) < 1e15) {
+        os << (long long)value;
+    } else {
+        os << std::fixed << std::setprecision(3) << value;
+    }
+    return os.str();
+}
+
+std::string jsonString(const std::string &str) {
+    std::string escaped = "\"";
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if ((unsigned char)c < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            escaped += buf;
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped + "\"";
+}
+
+std::string jsonValue(const std::string &value) {
+    return value.empty() ? "null" : value;
+}
+
+std::string csvField(const std::string &str) {
+    if (str.find_first_of(",\"\n") == std::string::npos) {
+        return str;
+    }
+
+    std::string quoted = "\"";
+    for (char c : str) {
+        if (c == '"') {
+            quoted += '"';
+        }
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+} // End anonymous namespace
+
+PhaseTimer::PhaseTimer(const std::string &name)
+    : parent(currentPhase), wallStart(PTAStat::getWallClk()),
+      cpuStart(PTAStat::getCPUClk()) {
+    currentPhase = getPhasePath(parent, name);
+}
+
+PhaseTimer::~PhaseTimer() {
+    double wallTime = PTAStat::getWallClk() - wallStart;
+    double cpuTime = PTAStat::getCPUClk() - cpuStart;
+    u32_t vmrss = 0;
+    u32_t vmsize = 0;
+    SVFUtil::getMemoryUsageKB(&vmrss, &vmsize);
+
+    {
+        std::lock_guard<std::mutex> guard(phaseMutex);
+        PhaseTime &phase = phaseTimes[currentPhase];
+        phase.wallTime += wallTime;
+        phase.cpuTime += cpuTime;
+        phase.count++;
+        phase.maxRSS = std::max(phase.maxRSS, vmrss);
+    }
+    currentPhase = parent;
+}
+
+void PhaseTimer::addTime(const std::string &name, double wallTime,
+                         u32_t count) {
+    std::lock_guard<std::mutex> guard(phaseMutex);
+    PhaseTime &phase = phaseTimes[getPhasePath(currentPhase, name)];
+    phase.wallTime += wallTime;
+    phase.count += count;
+}
+
+PhaseTimer::PhaseTimeMap PhaseTimer::getPhaseTimes() {
+    std::lock_guard<std::mutex> guard(phaseMutex);
+    return phaseTimes;
+}
+
+double PTAStat::getCPUClk() {
+    struct timespec ts;
+    if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts) != 0) {
+        return CLOCK_IN_MS();
+    }
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
 const char *PTAStat::TotalAnalysisTime = "TotalTime"; ///< PAG value nodes
 const char *PTAStat::SCCDetectionTime =
     "SCCDetectTime"; ///< Total SCC detection time
@@ -302,12 +428,15 @@ void PTAStat::callgraphStat() {
 
 void PTAStat::printStat(string statname) {
 
-    PAG *pag = pta->getPAG();
-    SymbolTableInfo *symInfo = pag->getSymbolTableInfo();
+    // Statistics without an analysis (MTAStat) have no module name
+    if (pta != nullptr) {
+        PAG *pag = pta->getPAG();
+        SymbolTableInfo *symInfo = pag->getSymbolTableInfo();
 
-    StringRef fullName(symInfo->getModule()->getModuleIdentifier());
-    StringRef name = fullName.split('/').second;
-    moduleName = name.split('.').first.str();
+        StringRef fullName(symInfo->getModule()->getModuleIdentifier());
+        StringRef name = fullName.split('/').second;
+        moduleName = name.split('.').first.str();
+    }
 
     std::cout << "\n*********" << statname << "***************\n";
     std::cout << "################ (program : " << moduleName
@@ -331,6 +460,11 @@ void PTAStat::printStat(string statname) {
     std::cout << "#######################################################"
               << std::endl;
     std::cout.flush();
+
+    if (!Options::StatExport.empty()) {
+        exportStat(statname);
+    }
+
     generalNumMap.clear();
     PTNumStatMap.clear();
     timeStatMap.clear();
@@ -374,3 +508,84 @@ void PTAStat::branchStat() {
     generalNumMap["BBWith2Succ"] = numOfBB_2Succ;
     generalNumMap["BBWith3Succ"] = numOfBB_3Succ;
 }
+
+void PTAStat::exportStat(const std::string &statname) {
+    StatSection section;
+    section.analysis = pta != nullptr ? pta->PTAName() : "";
+    section.name = statname;
+    for (auto &it : generalNumMap) {
+        section.values[it.first] = formatValue(it.second);
+    }
+    for (auto &it : timeStatMap) {
+        section.values[it.first] = formatValue(it.second);
+    }
+    for (auto &it : PTNumStatMap) {
+        section.values[it.first] = formatValue(it.second);
+    }
+    exportedSections.push_back(std::move(section));
+
+    const std::string &filename = Options::StatExport;
+    std::ofstream out(filename);
+    if (!out.is_open()) {
+        SVFUtil::writeWrnMsg("cannot write statistics to " + filename);
+        return;
+    }
+
+    PhaseTimer::PhaseTimeMap phases = PhaseTimer::getPhaseTimes();
+    std::string peakRSS = formatValue(SVFUtil::getPeakMemoryUsageKB());
+    bool csv = filename.size() >= 4 &&
+               filename.compare(filename.size() - 4, 4, ".csv") == 0;
+    if (csv) {
+        out << "kind,section,name,value\n";
+        out << "module,," << csvField(moduleName) << ",\n";
+        out << "memory,,PeakRSSKB," << peakRSS << "\n";
+        for (const StatSection &sec : exportedSections) {
+            std::string name = csvField(sec.analysis + "/" + sec.name);
+            for (const auto &it : sec.values) {
+                out << "stat," << name << "," << csvField(it.first) << ","
+                    << it.second << "\n";
+            }
+        }
+        for (const auto &it : phases) {
+            std::string path = csvField(it.first);
+            const PhaseTime &phase = it.second;
+            out << "phase," << path << ",Count," << phase.count << "\n";
+            out << "phase," << path << ",WallMs,"
+                << formatValue(phase.wallTime) << "\n";
+            out << "phase," << path << ",CPUMs,"
+                << formatValue(phase.cpuTime) << "\n";
+            out << "phase," << path << ",MaxRSSKB," << phase.maxRSS << "\n";
+        }
+        return;
+    }
+
+    out << "{\n  \"module\": " << jsonString(moduleName) << ",\n";
+    out << "  \"peakRSSKB\": " << jsonValue(peakRSS) << ",\n";
+    out << "  \"sections\": [";
+    for (u32_t i = 0; i < exportedSections.size(); ++i) {
+        const StatSection &sec = exportedSections[i];
+        out << (i == 0 ? "\n" : ",\n");
+        out << "    {\"analysis\": " << jsonString(sec.analysis)
+            << ", \"name\": " << jsonString(sec.name) << ", \"stats\": {";
+        bool first = true;
+        for (const auto &it : sec.values) {
+            out << (first ? "" : ", ") << jsonString(it.first) << ": "
+                << jsonValue(it.second);
+            first = false;
+        }
+        out << "}}";
+    }
+    out << "\n  ],\n  \"phases\": [";
+    bool first = true;
+    for (const auto &it : phases) {
+        const PhaseTime &phase = it.second;
+        out << (first ? "\n" : ",\n");
+        out << "    {\"path\": " << jsonString(it.first)
+            << ", \"count\": " << phase.count
+            << ", \"wallMs\": " << jsonValue(formatValue(phase.wallTime))
+            << ", \"cpuMs\": " << jsonValue(formatValue(phase.cpuTime))
+            << ", \"maxRSSKB\": " << phase.maxRSS << "}";
+        first = false;
+    }
+    out << "\n  ]\n}\n";
+}
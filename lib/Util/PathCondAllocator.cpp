@@ -38,7 +38,7 @@ using namespace SVFUtil;
 
 u64_t DPItem::maximumBudget = ULONG_MAX - 1;
 u32_t ContextCond::maximumCxtLen = 0;
-u32_t ContextCond::maximumCxt = 0;
+std::atomic<u32_t> ContextCond::maximumCxt(0);
 u32_t VFPathCond::maximumPathLen = 0;
 u32_t VFPathCond::maximumPath = 0;
 
@@ -51,6 +51,16 @@ BddCondManager *PathCondAllocator::bddCondMgr = nullptr;
 void PathCondAllocator::allocate() {
     DBOUT(DGENERAL, outs() << pasMsg("path condition allocation starts\n"));
 
+    // Only the conditions of the shared decision variables are created again,
+    // in this allocator's BDD manager.
+    if (sharedAllocator != nullptr) {
+        for (const auto &it : sharedAllocator->bbCondVars) {
+            allocateBranchConds(it.first, it.second);
+        }
+        DBOUT(DGENERAL, outs() << pasMsg("path condition allocation ends\n"));
+        return;
+    }
+
     for (const auto *func : *svfMod) {
         if (!SVFUtil::isExtCall(func)) {
             // Allocate conditions for a program.
@@ -85,38 +95,52 @@ void PathCondAllocator::allocateForBB(const BasicBlock &bb) {
         // allocate log2(num_succ) decision variables
         double num = log(succ_number) / log(2);
         u32_t bit_num = (u32_t)ceil(num);
-        u32_t succ_index = 0;
-        std::vector<Condition *> condVec;
+        std::vector<u32_t> &vars = bbCondVars[&bb];
         for (u32_t i = 0; i < bit_num; i++) {
-            condVec.push_back(newCond(bb.getTerminator()));
+            vars.push_back(totalCondNum++);
         }
+        allocateBranchConds(&bb, vars);
+    }
+}
 
-        // iterate each successor
-        for (succ_const_iterator succ_it = succ_begin(&bb);
-             succ_it != succ_end(&bb); succ_it++, succ_index++) {
-
-            const BasicBlock *succ = *succ_it;
+/*!
+ * Create the conditions of the decision variables of a basic block with more
+ * than one successor, and the condition of each of its branches.
+ */
+void PathCondAllocator::allocateBranchConds(const BasicBlock *bb,
+                                            const std::vector<u32_t> &vars) {
+    u32_t bit_num = vars.size();
+    std::vector<Condition *> condVec;
+    for (u32_t var : vars) {
+        condVec.push_back(newCond(var, bb->getTerminator()));
+    }
 
-            Condition *path_cond = getTrueCond();
-
-            /// TODO: handle BranchInst and SwitchInst individually here!!
-
-            // for each successor decide its bit representation
-            // decide whether each bit of succ_index is 1 or 0, if (three
-            // successor) succ_index is 000 then use C1^C2^C3 if 001 use
-            // C1^C2^negC3
-            for (u32_t j = 0; j < bit_num; j++) {
-                // test each bit of this successor's index (binary
-                // representation)
-                u32_t tool = 0x01 << j;
-                if (tool & succ_index) {
-                    path_cond = condAnd(path_cond, condVec.at(j));
-                } else {
-                    path_cond = condAnd(path_cond, (condNeg(condVec.at(j))));
-                }
+    u32_t succ_index = 0;
+    // iterate each successor
+    for (succ_const_iterator succ_it = succ_begin(bb);
+         succ_it != succ_end(bb); succ_it++, succ_index++) {
+
+        const BasicBlock *succ = *succ_it;
+
+        Condition *path_cond = getTrueCond();
+
+        /// TODO: handle BranchInst and SwitchInst individually here!!
+
+        // for each successor decide its bit representation
+        // decide whether each bit of succ_index is 1 or 0, if (three
+        // successor) succ_index is 000 then use C1^C2^C3 if 001 use
+        // C1^C2^negC3
+        for (u32_t j = 0; j < bit_num; j++) {
+            // test each bit of this successor's index (binary
+            // representation)
+            u32_t tool = 0x01 << j;
+            if (tool & succ_index) {
+                path_cond = condAnd(path_cond, condVec.at(j));
+            } else {
+                path_cond = condAnd(path_cond, (condNeg(condVec.at(j))));
             }
-            setBranchCond(&bb, succ, path_cond);
         }
+        setBranchCond(bb, succ, path_cond);
     }
 }
 
@@ -354,8 +378,11 @@ void PathCondAllocator::collectBBCallingProgExit(const BasicBlock &bb) {
  */
 bool PathCondAllocator::isBBCallsProgExit(const BasicBlock *bb) {
     const Function *fun = bb->getParent();
-    auto it = funToExitBBsMap.find(fun);
-    if (it != funToExitBBsMap.end()) {
+    const FunToExitBBsMap &exitBBs = sharedAllocator != nullptr
+                                         ? sharedAllocator->funToExitBBsMap
+                                         : funToExitBBsMap;
+    auto it = exitBBs.find(fun);
+    if (it != exitBBs.end()) {
         PostDominatorTree *pdt = getPostDT(fun);
         for (const auto *bit : it->second) {
             if (pdt->dominates(bit, bb))
@@ -384,7 +411,7 @@ PathCondAllocator::Condition *PathCondAllocator::getPHIComplementCond(
         return condNeg(cond);
     }
 
-    return trueCond();
+    return getTrueCond();
 }
 
 /*!
@@ -479,8 +506,13 @@ PathCondAllocator::ComputeIntraVFGGuard(const BasicBlock *srcBB,
  * Release memory
  */
 void PathCondAllocator::destroy() {
-    delete bddCondMgr;
-    bddCondMgr = nullptr;
+    if (ownsCondMgr) {
+        delete condMgr;
+    } else {
+        delete bddCondMgr;
+        bddCondMgr = nullptr;
+    }
+    condMgr = nullptr;
 }
 
 /*!
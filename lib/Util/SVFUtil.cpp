@@ -157,6 +157,22 @@ bool SVFUtil::getMemoryUsageKB(u32_t *vmrss_kb, u32_t *vmsize_kb) {
     return (found_vmrss && found_vmsize);
 }
 
+/*!
+ * Get peak memory usage
+ */
+u32_t SVFUtil::getPeakMemoryUsageKB() {
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    // Bytes on macOS, KB elsewhere
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
 /*!
  * Increase stack size
  */
@@ -28,7 +28,9 @@
  */
 
 #include "WPA/Andersen.h"
+#include "MSSA/SVFGCache.h"
 #include "SVF-FE/LLVMUtil.h"
+#include "SVF-FE/ProjectSnapshot.h"
 #include "Util/Options.h"
 
 using namespace SVF;
@@ -60,8 +62,13 @@ void AndersenBase::initialize() {
     /// Build PAG
     PointerAnalysis::initialize();
     /// Build Constraint Graph
-    consCG = new ConstraintGraph(getPAG());
+    {
+        PhaseTimer timer("ConstraintGraph");
+        consCG = new ConstraintGraph(getPAG());
+    }
     setGraph(consCG);
+    getSCCDetector()->setNumOfThreads(Options::SCCThreads);
+    worklist.setOrder(Options::AnderWorkList);
     /// Create statistic class
     stat = new AndersenStat(this);
     if (Options::ConsCGDotGraph)
@@ -86,42 +93,212 @@ void AndersenBase::finalize() {
  * Andersen analysis
  */
 void AndersenBase::analyze() {
+    PhaseTimer timer("Andersen");
+
     /// Initialization for the Solver
     initialize();
 
     bool readResultsFromFile = false;
+    bool readResultsFromCache = false;
+    /// Results seeded from a snapshot may be less precise, so are not cached
+    SVFGCache cache(getSVFProject(), getAnalysisTy());
+    bool useCache = cache.isEnabled() && Options::ReadAnder.empty() &&
+                    Options::AnderSnapshot.empty();
     if (!Options::ReadAnder.empty())
         readResultsFromFile = this->readFromFile(Options::ReadAnder);
+    else if (useCache && llvm::sys::fs::exists(cache.getPtsFile()))
+        readResultsFromFile = readResultsFromCache =
+            this->readFromFile(cache.getPtsFile());
 
     if (!readResultsFromFile) {
+        u32_t numOfFIObjs = getNumOfFieldInsensitiveObjs();
+
+        if (!Options::AnderSnapshot.empty())
+            seedFromSnapshot(Options::AnderSnapshot);
+
         // Start solving constraints
         DBOUT(DGENERAL, outs()
                             << SVFUtil::pasMsg("Start Solving Constraints\n"));
 
-        initWorklist();
-        do {
-            numOfIteration++;
-            if (0 == numOfIteration % iterationForPrintStat)
-                printStat();
+        {
+            PhaseTimer solveTimer("Solve");
+            // These are timed per node, too often for a PhaseTimer each; add
+            // what this run adds to their totals.
+            const std::pair<const char *, double *> solvePhases[] = {
+                {"SCCDetect", &timeOfSCCDetection},
+                {"SCCMerge", &timeOfSCCMerges},
+                {"Collapse", &timeOfCollapse},
+                {"LoadStore", &timeOfProcessLoadStore},
+                {"CopyGep", &timeOfProcessCopyGep},
+                {"UpdateCallGraph", &timeOfUpdateCallGraph}};
+            std::vector<double> solvePhaseStart;
+            for (const auto &phase : solvePhases) {
+                solvePhaseStart.push_back(*phase.second);
+            }
+
+            initWorklist();
+            do {
+                numOfIteration++;
+                if (0 == numOfIteration % iterationForPrintStat)
+                    printStat();
 
-            reanalyze = false;
+                reanalyze = false;
 
-            solveWorklist();
+                solveWorklist();
 
-            if (updateCallGraph(getIndirectCallsites()))
-                reanalyze = true;
+                if (updateCallGraph(getIndirectCallsites()))
+                    reanalyze = true;
 
-        } while (reanalyze);
+            } while (reanalyze);
+
+            for (u32_t i = 0; i < solvePhaseStart.size(); ++i) {
+                double time = *solvePhases[i].second - solvePhaseStart[i];
+                PhaseTimer::addTime(solvePhases[i].first, time * TIMEINTERVAL);
+            }
+        }
 
         DBOUT(DGENERAL, outs()
                             << SVFUtil::pasMsg("Finish Solving Constraints\n"));
 
+        /// Objects collapsed while solving are not in the points-to file, so
+        /// results with any are not cached
+        if (getNumOfFieldInsensitiveObjs() != numOfFIObjs)
+            useCache = false;
+
         // Finalize the analysis
         finalize();
+
+        if (useCache) {
+            SVFGCache::writeAtomically(
+                cache.getPtsFile(), [this](const std::string &filename) {
+                    return writeToBinaryFile(filename);
+                });
+        }
+    } else if (readResultsFromCache) {
+        finalize();
     }
 
     if (!Options::WriteAnder.empty())
         this->writeToFile(Options::WriteAnder);
+
+    // Results read from a file need not be those of this program.
+    if (!Options::AnderSnapshot.empty() && !readResultsFromFile)
+        writeSnapshot(Options::AnderSnapshot);
+}
+
+/*!
+ * Each object has one field-insensitive node, whatever its fields
+ */
+u32_t AndersenBase::getNumOfFieldInsensitiveObjs() {
+    u32_t num = 0;
+    for (auto &it : *getPAG()) {
+        if (const auto *obj = llvm::dyn_cast<FIObjPN>(it.second)) {
+            if (obj->getMemObj()->isFieldInsensitive())
+                num++;
+        }
+    }
+    return num;
+}
+
+/*!
+ * Seed points-to sets from the snapshot of a previous run.
+ * Points-to facts of nodes outside the changed functions are carried over
+ * (translated to this run's node IDs), and solving then only adds the facts
+ * which are new. This is only done if no constraint of the previous run was
+ * removed: the seeded facts are then part of the least solution of this
+ * run's constraints, so the result is the same as that of solving from
+ * scratch, and can be written to the next snapshot.
+ */
+u32_t AndersenBase::seedFromSnapshot(const std::string &filename) {
+    outs() << "Seeding points-to sets from snapshot '" << filename << "'...";
+
+    ProjectSnapshot oldSnapshot;
+    std::unique_ptr<PointsToFile> oldPts;
+    if (!oldSnapshot.readFromFile(filename) ||
+        (oldPts = PointsToFile::open(filename + ".pts")) == nullptr) {
+        outs() << "  no usable snapshot, solving from scratch\n";
+        return 0;
+    }
+
+    ProjectSnapshot newSnapshot(getSVFProject());
+    Set<std::string> changedFuns = newSnapshot.getChangedFunctions(oldSnapshot);
+    if (newSnapshot.hasRemovedConstraints(oldSnapshot, changedFuns)) {
+        outs() << "  " << changedFuns.size()
+               << " changed functions removed constraints, solving from "
+                  "scratch\n";
+        return 0;
+    }
+
+    Map<NodeID, NodeID> oldToNew;
+    newSnapshot.mapNodes(oldSnapshot, changedFuns, oldToNew);
+
+    // GEP objects are recreated from their (translated) base objects.
+    const ProjectSnapshot::GepObjMap &oldGepObjs = oldSnapshot.getGepObjs();
+    auto translate = [&](NodeID oldId, NodeID &newId) {
+        auto it = oldToNew.find(oldId);
+        if (it != oldToNew.end()) {
+            newId = it->second;
+            return true;
+        }
+
+        auto git = oldGepObjs.find(oldId);
+        if (git == oldGepObjs.end()) {
+            return false;
+        }
+        auto bit = oldToNew.find(git->second.first);
+        if (bit == oldToNew.end()) {
+            return false;
+        }
+
+        newId = consCG->getGepObjNode(bit->second,
+                                      LocationSet(git->second.second));
+        oldToNew[oldId] = newId;
+        return true;
+    };
+
+    u32_t numOfSeeded = 0;
+    for (u32_t i = 0, e = oldPts->getNumOfPts(); i < e; ++i) {
+        NodeID oldNode = oldPts->getPtsNode(i);
+        NodeID node;
+        if (!translate(oldNode, node)) {
+            continue;
+        }
+
+        PointsTo oldNodePts;
+        if (!oldPts->readPts(oldNode, oldNodePts)) {
+            continue;
+        }
+        PointsTo pts;
+        for (NodeID oldObj : oldNodePts) {
+            NodeID obj;
+            if (translate(oldObj, obj)) {
+                pts.set(obj);
+            }
+        }
+
+        if (!pts.empty() && unionPts(node, pts)) {
+            pushIntoWorklist(node);
+            ++numOfSeeded;
+        }
+    }
+
+    outs() << "  " << changedFuns.size() << " changed functions, "
+           << numOfSeeded << " points-to sets seeded\n";
+    return numOfSeeded;
+}
+
+/*!
+ * Write the function fingerprints and node keys of this run to filename,
+ * and the points-to sets to filename.pts.
+ */
+void AndersenBase::writeSnapshot(const std::string &filename) {
+    outs() << "Storing snapshot to '" << filename << "'...";
+
+    ProjectSnapshot snapshot(getSVFProject());
+    if (snapshot.writeToFile(filename) &&
+        writeToBinaryFile(filename + ".pts")) {
+        outs() << "\n";
+    }
 }
 
 /*!
@@ -132,10 +309,98 @@ void Andersen::initialize() {
     setDiffOpt(Options::PtsDiff);
     setPWCOpt(Options::MergePWC);
     AndersenBase::initialize();
+    if (Options::SteensPrePass) {
+        steensPrePass = new SteensgaardSolver(consCG, getSVFModule());
+        steensPrePass->solve();
+        NodeBS emptyNodes;
+        for (const auto &it : *consCG) {
+            if (!steensPrePass->mayPointToObjs(it.first))
+                emptyNodes.set(it.first);
+        }
+        DBOUT(DGENERAL, outs() << SVFUtil::pasMsg("Steensgaard pre-analysis: ")
+                               << steensPrePass->getNumOfECs() << " classes\n");
+        removeEmptyPtsConstraints(emptyNodes);
+    }
+    /// Type filtering and strides are per node, so these analyses cannot
+    /// merge nodes whose points-to sets only match before filtering.
+    if (Options::OfflineSubst && getAnalysisTy() != AndersenSFR_WPA &&
+        getAnalysisTy() != AndersenWaveDiffWithType_WPA) {
+        substituteOffline();
+    }
     /// Initialize worklist
     processAllAddr();
 }
 
+/*!
+ * Merge the nodes offline variable substitution finds to be pointer
+ * equivalent before solving
+ */
+void Andersen::substituteOffline() {
+    OfflineVarSubst ovs(consCG, getSVFModule());
+    ovs.solve();
+    removeEmptyPtsConstraints(ovs.getEmptyNodes());
+
+    u32_t numOfMerged = 0;
+    for (const NodePair &merge : ovs.getMerges()) {
+        NodeID sub = sccRepNode(merge.first);
+        NodeID rep = sccRepNode(merge.second);
+        if (sub != rep) {
+            mergeNodeToRep(sub, rep);
+            numOfMerged++;
+        }
+    }
+
+    DBOUT(DGENERAL, outs() << SVFUtil::pasMsg("Offline substitution: ")
+                           << ovs.getNumOfLabels() << " labels, merged "
+                           << numOfMerged << " nodes\n");
+}
+
+/*!
+ * Nodes whose points-to sets stay empty whatever Andersen's analysis does
+ * are pointer equivalent. Copy/gep edges from them, loads and stores
+ * through them and loads and stores of their values carry nothing, so
+ * they are removed before solving rather than merging all these nodes
+ * into one.
+ */
+void Andersen::removeEmptyPtsConstraints(const NodeBS &emptyNodes) {
+    auto isEmpty = [&emptyNodes](NodeID id) { return emptyNodes.test(id); };
+
+    std::vector<ConstraintEdge *> directEdges;
+    for (ConstraintEdge *edge : consCG->getDirectCGEdges()) {
+        if (isEmpty(edge->getSrcID()))
+            directEdges.push_back(edge);
+    }
+    std::vector<LoadCGEdge *> loads;
+    for (ConstraintEdge *edge : consCG->getLoadCGEdges()) {
+        if (isEmpty(edge->getSrcID()) || isEmpty(edge->getDstID()))
+            loads.push_back(llvm::cast<LoadCGEdge>(edge));
+    }
+    std::vector<StoreCGEdge *> stores;
+    for (ConstraintEdge *edge : consCG->getStoreCGEdges()) {
+        if (isEmpty(edge->getSrcID()) || isEmpty(edge->getDstID()))
+            stores.push_back(llvm::cast<StoreCGEdge>(edge));
+    }
+
+    for (ConstraintEdge *edge : directEdges)
+        consCG->removeDirectEdge(edge);
+    for (LoadCGEdge *load : loads)
+        consCG->removeLoadEdge(load);
+    for (StoreCGEdge *store : stores)
+        consCG->removeStoreEdge(store);
+
+    DBOUT(DGENERAL, outs() << SVFUtil::pasMsg("Empty points-to sets: ")
+                           << emptyNodes.count() << " nodes, removed "
+                           << directEdges.size() << " copy/gep, "
+                           << loads.size() << " load and " << stores.size()
+                           << " store edges\n");
+}
+
+AliasResult Andersen::alias(NodeID node1, NodeID node2) {
+    if (steensPrePass != nullptr && !steensPrePass->mayAlias(node1, node2))
+        return llvm::NoAlias;
+    return BVDataPTAImpl::alias(node1, node2);
+}
+
 /*!
  * Finalize analysis
  */
@@ -493,7 +758,12 @@ NodeStack &Andersen::SCCDetect() {
     numOfSCCDetection++;
 
     double sccStart = stat->getClk();
-    WPAConstraintSolver::SCCDetect();
+    if (Options::IncrementalSCC) {
+        getSCCDetector()->findIncremental(consCG->getNewDirectEdgeSrcs());
+        rankNodesTopologically();
+    } else {
+        WPAConstraintSolver::SCCDetect();
+    }
     double sccEnd = stat->getClk();
 
     timeOfSCCDetection += (sccEnd - sccStart) / TIMEINTERVAL;
@@ -501,6 +771,8 @@ NodeStack &Andersen::SCCDetect() {
     double mergeStart = stat->getClk();
 
     mergeSccCycle();
+    // Edges moved onto the reps by the merge do not change the SCCs.
+    consCG->clearNewDirectEdgeSrcs();
 
     double mergeEnd = stat->getClk();
 
@@ -28,6 +28,7 @@
  */
 
 #include "WPA/AndersenSFR.h"
+#include "Util/Options.h"
 
 using namespace SVF;
 using namespace SVFUtil;
@@ -44,6 +45,9 @@ void AndersenSFR::initialize() {
     if (!csc) {
         csc = new CSC(_graph, scc);
     }
+    if (!strideCache) {
+        strideCache = new StrideCache(consCG);
+    }
 
     // detect and collapse cycles that only comprise copy edges
     getSCCDetector()->find();
@@ -105,7 +109,9 @@ bool AndersenSFR::processGepPts(PointsTo &pts, const GepCGEdge *edge) {
 }
 
 /*!
- *
+ * Expand each initial object by the strides of the cycle, with the fields
+ * of each expansion memoised by strideCache. An object which would expand
+ * to more than -sfr-max-expand fields is collapsed instead.
  */
 void AndersenSFR::fieldExpand(NodeSet &initials, Size_t offset, NodeBS &strides,
                               PointsTo &expandPts) {
@@ -117,46 +123,27 @@ void AndersenSFR::fieldExpand(NodeSet &initials, Size_t offset, NodeBS &strides,
 
         if (consCG->isBlkObjOrConstantObj(init)) {
             expandPts.set(init);
-        } else {
-            PAGNode *initPN = getPAG()->getGNode(init);
-            const MemObj *obj = getPAG()->getBaseObj(init);
-            const Size_t maxLimit = obj->getMaxFieldOffsetLimit();
-            Size_t initOffset;
-            if (auto *gepNode = llvm::dyn_cast<GepObjPN>(initPN)) {
-                initOffset = gepNode->getLocationSet().getOffset();
-            } else if (llvm::isa<FIObjPN>(initPN) ||
-                       llvm::isa<DummyObjPN>(initPN)) {
-                initOffset = 0;
-            } else {
-                assert(false && "Not an object node!!");
-            }
+            continue;
+        }
 
-            Set<Size_t> offsets;
-            offsets.insert(offset);
-
-            // calculate offsets
-            bool loopFlag = true;
-            while (loopFlag) {
-                loopFlag = false;
-                for (auto _f : offsets) {
-                    for (auto _s : strides) {
-                        Size_t _f1 = _f + _s;
-                        loopFlag = (offsets.find(_f1) == offsets.end()) &&
-                                   (initOffset + _f1 < maxLimit);
-                        if (loopFlag) {
-                            offsets.insert(_f1);
-                        }
-                    }
-                }
-            }
+        // All fields of a field-insensitive object are the object.
+        if (isFieldInsensitive(init)) {
+            expandPts.set(consCG->getFIObjNode(init));
+            continue;
+        }
 
-            // get gep objs
-            for (Size_t _f : offsets) {
-                NodeID gepId = consCG->getGepObjNode(init, LocationSet(_f));
-                initials.erase(gepId); // gep id in initials should be removed
-                                       // to avoid redundant derivation
-                expandPts.set(gepId);
-            }
+        const PointsTo *fields = strideCache->getFields(
+            init, offset, strides, Options::SFRMaxFieldExpand);
+        if (fields == nullptr) {
+            consCG->addNodeToBeCollapsed(init);
+            expandPts.set(consCG->getFIObjNode(init));
+            continue;
+        }
+
+        for (NodeID gepId : *fields) {
+            initials.erase(gepId); // gep id in initials should be removed
+                                   // to avoid redundant derivation
+            expandPts.set(gepId);
         }
     }
 }
@@ -275,6 +275,8 @@ void AndersenStat::performStat() {
     u32_t totalTopLevPointers = 0;
     u32_t totalPtsSize = 0;
     u32_t totalTopLevPtsSize = 0;
+    // Points-to sets are lists of elements of 128 bits
+    u64_t totalPtsElements = 0;
     for (auto iter = pta->getPAG()->begin(), eiter = pta->getPAG()->end();
          iter != eiter; ++iter) {
         NodeID node = iter->first;
@@ -283,6 +285,14 @@ void AndersenStat::performStat() {
         totalPointers++;
         totalPtsSize += size;
 
+        NodeID lastElement = UINT_MAX;
+        for (NodeID o : pts) {
+            if (o / 128 != lastElement) {
+                lastElement = o / 128;
+                totalPtsElements++;
+            }
+        }
+
         if (pta->getPAG()->isValidTopLevelPtr(pta->getPAG()->getGNode(node))) {
             totalTopLevPointers++;
             totalTopLevPtsSize += size;
@@ -331,6 +341,11 @@ void AndersenStat::performStat() {
     ;
 
     PTNumStatMap[MaxPointsToSetSize] = _MaxPtsSize;
+    // Each element holds its index and bits, plus the list's two links
+    PTNumStatMap["PtsMemKB"] =
+        totalPtsElements *
+        (sizeof(llvm::SparseBitVectorElement<>) + 2 * sizeof(void *)) /
+        1024;
 
     PTNumStatMap[NumOfIterations] = pta->numOfIteration;
 
@@ -28,15 +28,51 @@
  *      Author: yesen
  */
 
+#include "Util/Options.h"
+#include "Util/Parallel.h"
 #include "WPA/Andersen.h"
 
 using namespace SVF;
 using namespace SVFUtil;
 
+/*!
+ * Initialize analysis
+ */
+void AndersenWaveDiff::initialize() {
+    Andersen::initialize();
+
+    numOfThreads = getNumOfWorkerThreads(Options::AnderThreads);
+    if (numOfThreads > 1 && !canSolveInParallel()) {
+        writeWrnMsg("parallel wave propagation is not supported for " +
+                    PTAName() + ", solving sequentially");
+        numOfThreads = 1;
+    }
+}
+
+/*!
+ * The parallel solver processes nodes in a different order than the
+ * sequential one. The resulting points-to sets are the same as long as
+ * GEP object IDs do not depend on the order they are created in (which
+ * holds for the default node allocation strategy), and the points-to data
+ * is not shared between nodes (persistent backings are not thread-safe).
+ * Subclasses customise individual steps of the solver, so they always
+ * solve sequentially.
+ */
+bool AndersenWaveDiff::canSolveInParallel() const {
+    return getAnalysisTy() == AndersenWaveDiff_WPA &&
+           Options::NodeAllocStrat == NodeIDAllocator::Strategy::DEBUG &&
+           Options::PtDataBacking == BVDataPTAImpl::PTBackingType::Mutable;
+}
+
 /*!
  * solve worklist
  */
 void AndersenWaveDiff::solveWorklist() {
+    if (numOfThreads > 1) {
+        solveWorklistInParallel();
+        return;
+    }
+
     // Initialize the nodeStack via a whole SCC detection
     // Nodes in nodeStack are in topological order by default.
     NodeStack &nodeStack = SCCDetect();
@@ -51,23 +87,7 @@ void AndersenWaveDiff::solveWorklist() {
         collapseFields();
     }
 
-    // This modification is to make WAVE feasible to handle PWC analysis
-    if (!mergePWC()) {
-        NodeStack tmpWorklist;
-        while (!isWorklistEmpty()) {
-            NodeID nodeId = popFromWorklist();
-            collapsePWCNode(nodeId);
-            // process nodes in nodeStack
-            processNode(nodeId);
-            collapseFields();
-            tmpWorklist.push(nodeId);
-        }
-        while (!tmpWorklist.empty()) {
-            NodeID nodeId = tmpWorklist.top();
-            tmpWorklist.pop();
-            pushIntoWorklist(nodeId);
-        }
-    }
+    processPWCWorklist();
 
     // New nodes will be inserted into workList during processing.
     while (!isWorklistEmpty()) {
@@ -77,6 +97,217 @@ void AndersenWaveDiff::solveWorklist() {
     }
 }
 
+/*!
+ * This modification is to make WAVE feasible to handle PWC analysis
+ */
+void AndersenWaveDiff::processPWCWorklist() {
+    if (mergePWC())
+        return;
+
+    NodeStack tmpWorklist;
+    while (!isWorklistEmpty()) {
+        NodeID nodeId = popFromWorklist();
+        collapsePWCNode(nodeId);
+        // process nodes in nodeStack
+        processNode(nodeId);
+        collapseFields();
+        tmpWorklist.push(nodeId);
+    }
+    while (!tmpWorklist.empty()) {
+        NodeID nodeId = tmpWorklist.top();
+        tmpWorklist.pop();
+        pushIntoWorklist(nodeId);
+    }
+}
+
+/*!
+ * Level-synchronous wave propagation.
+ * Nodes of the SCC DAG with the same longest distance from a root have no
+ * direct edges between each other, so the points-to sets flowing into the
+ * nodes of one level can be computed independently. Threads only read
+ * points-to sets while merging them; every update of the points-to data
+ * and of the constraint graph is committed by this thread in a fixed
+ * order, so the result does not depend on the number of threads.
+ */
+void AndersenWaveDiff::solveWorklistInParallel() {
+    NodeStack &nodeStack = SCCDetect();
+
+    std::vector<NodeVector> levels;
+    computeTopoLevels(nodeStack, levels);
+
+    for (const NodeVector &level : levels) {
+        propagateLevel(level);
+    }
+
+    processPWCWorklist();
+
+    postProcessWorklist();
+}
+
+/*!
+ * Pop all nodes from nodeStack (which is in topological order) and bucket
+ * them by level. A node's level is one more than the highest level of its
+ * direct predecessors which come before it in nodeStack.
+ */
+void AndersenWaveDiff::computeTopoLevels(NodeStack &nodeStack,
+                                         std::vector<NodeVector> &levels) {
+    Map<NodeID, u32_t> nodeToLevel;
+    while (!nodeStack.empty()) {
+        NodeID nodeId = nodeStack.top();
+        nodeStack.pop();
+
+        u32_t level = 0;
+        ConstraintNode *node = consCG->getConstraintNode(nodeId);
+        for (const ConstraintEdge *edge : node->getDirectInEdges()) {
+            auto it = nodeToLevel.find(edge->getSrcID());
+            if (it != nodeToLevel.end() && it->second >= level) {
+                level = it->second + 1;
+            }
+        }
+
+        nodeToLevel[nodeId] = level;
+        if (levels.size() <= level) {
+            levels.resize(level + 1);
+        }
+        levels[level].push_back(nodeId);
+    }
+}
+
+/*!
+ * Propagate the diff points-to sets of all nodes in level.
+ * Copy edges are grouped by destination and the incoming diff points-to
+ * sets of every destination are merged in parallel before being committed.
+ * Gep edges may create new objects, so they are handled sequentially.
+ */
+void AndersenWaveDiff::propagateLevel(const NodeVector &level) {
+    for (NodeID nodeId : level) {
+        collapsePWCNode(nodeId);
+    }
+    collapseFields();
+
+    double propStart = stat->getClk();
+
+    // Collect the diff points-to sets flowing along copy edges. Only rep
+    // nodes are handled, as in processNode.
+    NodeVector dsts;
+    Map<NodeID, u32_t> dstToIdx;
+    std::vector<std::vector<const PointsTo *>> incoming;
+    NodeVector srcs;
+    for (NodeID nodeId : level) {
+        if (sccRepNode(nodeId) != nodeId)
+            continue;
+
+        computeDiffPts(nodeId);
+        const PointsTo &diffPts = getDiffPts(nodeId);
+        if (diffPts.empty())
+            continue;
+
+        srcs.push_back(nodeId);
+        ConstraintNode *node = consCG->getConstraintNode(nodeId);
+        for (ConstraintEdge *edge : node->getCopyOutEdges()) {
+            if (!llvm::isa<CopyCGEdge>(edge))
+                continue;
+
+            numOfProcessedCopy++;
+            NodeID dst = sccRepNode(edge->getDstID());
+            auto inserted = dstToIdx.emplace(dst, dsts.size());
+            if (inserted.second) {
+                dsts.push_back(dst);
+                incoming.emplace_back();
+            }
+            incoming[inserted.first->second].push_back(&diffPts);
+        }
+    }
+
+    std::vector<PointsTo> merged(dsts.size());
+    parallelFor(dsts.size(), numOfThreads, [&](size_t i) {
+        for (const PointsTo *pts : incoming[i]) {
+            merged[i] |= *pts;
+        }
+    });
+
+    for (size_t i = 0; i < dsts.size(); ++i) {
+        if (unionPts(dsts[i], merged[i]))
+            pushIntoWorklist(dsts[i]);
+    }
+
+    for (NodeID nodeId : srcs) {
+        ConstraintNode *node = consCG->getConstraintNode(nodeId);
+        for (ConstraintEdge *edge : node->getGepOutEdges())
+            if (auto *gepEdge = llvm::dyn_cast<GepCGEdge>(edge))
+                processGep(nodeId, gepEdge);
+    }
+
+    double propEnd = stat->getClk();
+    timeOfProcessCopyGep += (propEnd - propStart) / TIMEINTERVAL;
+
+    collapseFields();
+}
+
+/*!
+ * Handle the loads and stores of all nodes in the worklist.
+ * The candidate copy edges of every node are enumerated in parallel, in
+ * the same order as postProcessNode would, and then added to the
+ * constraint graph sequentially.
+ */
+void AndersenWaveDiff::postProcessWorklist() {
+    double insertStart = stat->getClk();
+
+    NodeVector nodes;
+    std::vector<const PointsTo *> nodePts;
+    while (!isWorklistEmpty()) {
+        NodeID nodeId = popFromWorklist();
+        nodes.push_back(nodeId);
+        nodePts.push_back(&getPts(nodeId));
+    }
+
+    // A load src --load--> dst yields o --copy--> dst, a store
+    // src --store--> dst yields src --copy--> o, for every o in pts(node).
+    using CopyCandidates = std::vector<std::pair<NodeID, NodeID>>;
+    std::vector<CopyCandidates> loadCopies(nodes.size());
+    std::vector<CopyCandidates> storeCopies(nodes.size());
+    parallelFor(nodes.size(), numOfThreads, [&](size_t i) {
+        ConstraintNode *node = consCG->getConstraintNode(nodes[i]);
+        const PointsTo &pts = *nodePts[i];
+        for (auto it = node->outgoingLoadsBegin(),
+                  eit = node->outgoingLoadsEnd();
+             it != eit; ++it) {
+            for (NodeID o : pts)
+                loadCopies[i].emplace_back(o, (*it)->getDstID());
+        }
+        for (auto it = node->incomingStoresBegin(),
+                  eit = node->incomingStoresEnd();
+             it != eit; ++it) {
+            for (NodeID o : pts)
+                storeCopies[i].emplace_back((*it)->getSrcID(), o);
+        }
+    });
+
+    // Same filtering as processLoad/processStore.
+    auto isPointerObj = [this](NodeID o) {
+        return !getPAG()->isConstantObj(o) && !isNonPointerObj(o);
+    };
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        for (const std::pair<NodeID, NodeID> &copy : loadCopies[i]) {
+            if (!isPointerObj(copy.first))
+                continue;
+            numOfProcessedLoad++;
+            if (addCopyEdge(copy.first, copy.second))
+                reanalyze = true;
+        }
+        for (const std::pair<NodeID, NodeID> &copy : storeCopies[i]) {
+            if (!isPointerObj(copy.second))
+                continue;
+            numOfProcessedStore++;
+            if (addCopyEdge(copy.first, copy.second))
+                reanalyze = true;
+        }
+    }
+
+    double insertEnd = stat->getClk();
+    timeOfProcessLoadStore += (insertEnd - insertStart) / TIMEINTERVAL;
+}
+
 /*!
  * Process edge PAGNode
  */
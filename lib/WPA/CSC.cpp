@@ -128,3 +128,78 @@ void CSC::visit(NodeID nodeId, Size_t _w) {
     _S.pop(); // after checking all the edges of the top node of _S, remove the
               // node
 }
+
+u32_t StrideCache::getStrideSetId(const NodeBS &strides) {
+    auto it = strideSetIds.find(strides);
+    if (it != strideSetIds.end()) {
+        return it->second;
+    }
+
+    u32_t id = strideSetIds.size();
+    strideSetIds[strides] = id;
+    return id;
+}
+
+/*!
+ * Offsets offset + k * s, breadth first, while initOffset plus the offset
+ * is below maxLimit (offset itself is always there)
+ */
+const std::vector<Size_t> &
+StrideCache::getOffsets(Size_t initOffset, Size_t offset, u32_t strideSetId,
+                        const NodeBS &strides, Size_t maxLimit) {
+    OffsetsKey key = std::make_tuple(initOffset, offset, strideSetId, maxLimit);
+    auto it = offsetsCache.find(key);
+    if (it != offsetsCache.end()) {
+        return it->second;
+    }
+
+    std::vector<Size_t> &offsets = offsetsCache[key];
+    Set<Size_t> found;
+    offsets.push_back(offset);
+    found.insert(offset);
+    for (u32_t i = 0; i < offsets.size(); ++i) {
+        for (NodeID stride : strides) {
+            Size_t next = offsets[i] + stride;
+            if (initOffset + next < maxLimit && found.insert(next).second) {
+                offsets.push_back(next);
+            }
+        }
+    }
+    return offsets;
+}
+
+const PointsTo *StrideCache::getFields(NodeID obj, Size_t offset,
+                                       const NodeBS &strides,
+                                       u32_t maxFields) {
+    u32_t strideSetId = getStrideSetId(strides);
+    FieldsKey key = std::make_tuple(obj, offset, strideSetId);
+    auto it = fieldsCache.find(key);
+    if (it != fieldsCache.end()) {
+        numOfHits++;
+        return &it->second;
+    }
+
+    PAG *pag = _consG->getPAG();
+    PAGNode *objPN = pag->getGNode(obj);
+    Size_t initOffset = 0;
+    if (auto *gepNode = llvm::dyn_cast<GepObjPN>(objPN)) {
+        initOffset = gepNode->getLocationSet().getOffset();
+    } else {
+        assert((llvm::isa<FIObjPN>(objPN) || llvm::isa<DummyObjPN>(objPN)) &&
+               "Not an object node!!");
+    }
+    Size_t maxLimit = pag->getBaseObj(obj)->getMaxFieldOffsetLimit();
+
+    const std::vector<Size_t> &offsets =
+        getOffsets(initOffset, offset, strideSetId, strides, maxLimit);
+    if (maxFields != 0 && offsets.size() > maxFields) {
+        return nullptr;
+    }
+
+    numOfMisses++;
+    PointsTo &fields = fieldsCache[key];
+    for (Size_t f : offsets) {
+        fields.set(_consG->getGepObjNode(obj, LocationSet(f)));
+    }
+    return &fields;
+}
@@ -30,6 +30,7 @@
 #include "WPA/FlowSensitive.h"
 #include "SVF-FE/DCHG.h"
 #include "Util/Options.h"
+#include "Util/Parallel.h"
 #include "Util/SVFModule.h"
 #include "Util/TypeBasedHeapCloning.h"
 #include "WPA/Andersen.h"
@@ -47,16 +48,28 @@ void FlowSensitive::initialize() {
     ander = AndersenWaveDiff::createAndersenWaveDiff(getSVFProject());
 
     // When evaluating ctir aliases, we want the whole SVFG.
-    if (Options::OPTSVFG)
-        svfg = Options::CTirAliasEval ? svfgBuilder.buildFullSVFG(ander)
-                                      : svfgBuilder.buildPTROnlySVFG(ander);
-    else
-        svfg = svfgBuilder.buildPTROnlySVFGWithoutOPT(ander);
+    {
+        PhaseTimer timer("SVFG");
+        if (Options::OPTSVFG)
+            svfg = Options::CTirAliasEval
+                       ? svfgBuilder.buildFullSVFG(ander)
+                       : svfgBuilder.buildPTROnlySVFG(ander);
+        else
+            svfg = svfgBuilder.buildPTROnlySVFGWithoutOPT(ander);
+    }
 
     setGraph(svfg);
+    worklist.setOrder(Options::FSWorkList);
 
     // AndersenWaveDiff::releaseAndersenWaveDiff();
     stat = new FlowSensitiveStat(this);
+
+    numOfThreads = getNumOfWorkerThreads(Options::FSThreads);
+    if (numOfThreads > 1 && !canSolveInParallel()) {
+        writeWrnMsg("parallel solving is not supported for " + PTAName() +
+                    ", solving sequentially");
+        numOfThreads = 1;
+    }
 }
 
 FlowSensitive::~FlowSensitive() {
@@ -74,6 +87,8 @@ FlowSensitive::~FlowSensitive() {
  * Start analysis
  */
 void FlowSensitive::analyze() {
+    PhaseTimer timer(PTAName());
+
     /// Initialization for the Solver
     initialize();
 
@@ -81,17 +96,34 @@ void FlowSensitive::analyze() {
     /// Start solving constraints
     DBOUT(DGENERAL, outs() << SVFUtil::pasMsg("Start Solving Constraints\n"));
 
-    do {
-        numOfIteration++;
-
-        if (0 == numOfIteration % OnTheFlyIterBudgetForStat)
-            dumpStat();
-
-        callGraphSCC->find();
-
-        initWorklist();
-        solveWorklist();
-    } while (updateCallGraph(getIndirectCallsites()));
+    {
+        PhaseTimer solveTimer("Solve");
+        do {
+            numOfIteration++;
+
+            if (0 == numOfIteration % OnTheFlyIterBudgetForStat)
+                dumpStat();
+
+            callGraphSCC->find();
+
+            // Call graph updates add SVFG edges, which unfreezes the SVFG.
+            if (Options::FreezeGraphs)
+                svfg->freeze();
+
+            initWorklist();
+            solveWorklist();
+        } while (updateCallGraph(getIndirectCallsites()));
+
+        // Timed per node, too often for a PhaseTimer each
+        PhaseTimer::addTime("SCCDetect", sccTime * TIMEINTERVAL);
+        PhaseTimer::addTime("LoadStore",
+                            (loadTime + storeTime) * TIMEINTERVAL);
+        PhaseTimer::addTime("Propagation", propagationTime * TIMEINTERVAL);
+        PhaseTimer::addTime("UpdateCallGraph",
+                            updateCallGraphTime * TIMEINTERVAL);
+        if (parallelTime > 0)
+            PhaseTimer::addTime("Parallel", parallelTime * TIMEINTERVAL);
+    }
 
     DBOUT(DGENERAL, outs() << SVFUtil::pasMsg("Finish Solving Constraints\n"));
 
@@ -151,6 +183,223 @@ void FlowSensitive::processNode(NodeID nodeId) {
     clearAllDFOutVarFlag(node);
 }
 
+/*!
+ * Solve worklist
+ */
+void FlowSensitive::solveWorklist() {
+    if (numOfThreads > 1) {
+        solveWorklistInParallel();
+        return;
+    }
+
+    WPASVFGFSSolver::solveWorklist();
+}
+
+/*!
+ * The parallel solver relies on the data-flow points-to sets of each SVFG
+ * node being stored separately (persistent backings share them between
+ * nodes), and on GEP object IDs not depending on the order objects are
+ * created in (which holds for the default node allocation strategy).
+ * Subclasses customise how nodes are processed, so they always solve
+ * sequentially.
+ */
+bool FlowSensitive::canSolveInParallel() const {
+    return getAnalysisTy() == FSSPARSE_WPA &&
+           Options::NodeAllocStrat == NodeIDAllocator::Strategy::DEBUG &&
+           Options::PtDataBacking == BVDataPTAImpl::PTBackingType::Mutable;
+}
+
+/*!
+ * Parallel solving.
+ *
+ * The worklist is solved in rounds. Each round takes all nodes in the
+ * worklist and selects those which are not adjacent in the SVFG to each
+ * other and do not define the same top-level pointer; the others are left
+ * for the next round. As SVFG edges link the definition of a variable to
+ * its uses, the selected nodes can be processed concurrently: processing a
+ * node only updates its own IN/OUT sets and the pointer it defines, while it
+ * reads pointers defined by its predecessors. Propagating along the
+ * indirect edges of the selected nodes then only updates the IN sets of
+ * their successors, which are split between threads by successor.
+ *
+ * Rounds with few nodes are solved one node at a time, in worklist order.
+ * Call graph updates happen between calls to solveWorklist, sequentially.
+ */
+void FlowSensitive::solveWorklistInParallel() {
+    // Create the points-to sets of all top-level pointers up front so that
+    // looking them up never inserts into the points-to map concurrently.
+    for (const auto &it : *getPAG()) {
+        if (!llvm::isa<ObjPN>(it.second))
+            getPts(it.first);
+    }
+
+    // A round has to be large enough to be worth starting threads for.
+    const size_t minParallelNodes = 16 * numOfThreads;
+
+    NodeVector frontier;
+    NodeVector selected;
+    while (!isWorklistEmpty()) {
+        frontier.clear();
+        while (!isWorklistEmpty())
+            frontier.push_back(popFromWorklist());
+
+        if (frontier.size() < minParallelNodes) {
+            for (NodeID id : frontier)
+                processNode(id);
+            continue;
+        }
+
+        selected.clear();
+        selectIndependentNodes(frontier, selected);
+        solveIndependentNodes(selected);
+    }
+}
+
+/// The top-level pointer defined by a node, if any
+static bool getDefinedPtr(const SVFGNode *node, NodeID &ptr) {
+    if (llvm::isa<AddrSVFGNode>(node) || llvm::isa<CopySVFGNode>(node) ||
+        llvm::isa<GepSVFGNode>(node) || llvm::isa<LoadSVFGNode>(node)) {
+        ptr = llvm::cast<StmtSVFGNode>(node)->getPAGDstNodeID();
+        return true;
+    }
+    if (const auto *phi = llvm::dyn_cast<PHISVFGNode>(node)) {
+        ptr = phi->getRes()->getId();
+        return true;
+    }
+    return false;
+}
+
+/*!
+ * Greedily select nodes of frontier, in order, which are neither adjacent to
+ * nor define the same pointer as an already selected node
+ */
+void FlowSensitive::selectIndependentNodes(const NodeVector &frontier,
+                                           NodeVector &selected) {
+    NodeBS adjacent;
+    NodeBS definedPtrs;
+    for (NodeID id : frontier) {
+        const SVFGNode *node = svfg->getGNode(id);
+        NodeID ptr = 0;
+        bool definesPtr = getDefinedPtr(node, ptr);
+        if (adjacent.test(id) || (definesPtr && definedPtrs.test(ptr))) {
+            pushIntoWorklist(id);
+            continue;
+        }
+
+        selected.push_back(id);
+        if (definesPtr)
+            definedPtrs.set(ptr);
+        for (const SVFGEdge *edge : node->getInEdges())
+            adjacent.set(edge->getSrcID());
+        for (const SVFGEdge *edge : node->getOutEdges())
+            adjacent.set(edge->getDstID());
+    }
+}
+
+/*!
+ * Process the selected nodes and propagate from those which changed
+ */
+void FlowSensitive::solveIndependentNodes(const NodeVector &selected) {
+    MutDFPTDataTy *dfPTData = getMutDFPTDataTy();
+    std::vector<SVFGNode *> nodes(selected.size());
+    std::vector<char> changed(selected.size(), false);
+
+    // GEP nodes may create objects, which is done sequentially.
+    for (size_t i = 0; i < selected.size(); ++i) {
+        nodes[i] = svfg->getGNode(selected[i]);
+        if (llvm::isa<GepSVFGNode>(nodes[i])) {
+            changed[i] = processSVFGNode(nodes[i]);
+        } else if (llvm::isa<LoadSVFGNode>(nodes[i])) {
+            dfPTData->initDFInSet(selected[i]);
+        } else if (llvm::isa<StoreSVFGNode>(nodes[i])) {
+            dfPTData->initDFInSet(selected[i]);
+            dfPTData->initDFOutSet(selected[i]);
+        }
+    }
+
+    // The per-node timers would add up the time of every thread, so only
+    // the whole phase is timed.
+    double start = stat->getClk();
+    inParallelPhase = true;
+    parallelFor(nodes.size(), numOfThreads, [&](size_t i) {
+        if (!llvm::isa<GepSVFGNode>(nodes[i]))
+            changed[i] = processSVFGNode(nodes[i]);
+    });
+    inParallelPhase = false;
+    parallelTime += (stat->getClk() - start) / TIMEINTERVAL;
+
+    // Sort the out edges of the changed nodes. Propagation from actual
+    // parameters and formal returns updates pointers which may be read by
+    // other propagations, and a self-cycle reads the IN set it updates, so
+    // these are done sequentially.
+    Map<NodeID, u32_t> dstToIndex;
+    NodeVector dsts;
+    std::vector<std::vector<SVFGEdge *>> incoming;
+    std::vector<SVFGEdge *> sequentialEdges;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (!changed[i])
+            continue;
+
+        for (SVFGEdge *edge : nodes[i]->getOutEdges()) {
+            if (llvm::isa<ActualParmSVFGNode>(nodes[i]) ||
+                llvm::isa<FormalRetSVFGNode>(nodes[i]) ||
+                edge->getDstID() == selected[i]) {
+                sequentialEdges.push_back(edge);
+                continue;
+            }
+
+            auto it = dstToIndex.emplace(edge->getDstID(), dsts.size());
+            if (it.second) {
+                dsts.push_back(edge->getDstID());
+                incoming.emplace_back();
+            }
+            incoming[it.first->second].push_back(edge);
+            if (llvm::isa<IndirectSVFGEdge>(edge))
+                dfPTData->initDFInSet(edge->getDstID());
+        }
+    }
+
+    std::vector<char> dstChanged(dsts.size(), false);
+    start = stat->getClk();
+    inParallelPhase = true;
+    parallelFor(dsts.size(), numOfThreads, [&](size_t i) {
+        for (SVFGEdge *edge : incoming[i]) {
+            if (propFromSrcToDst(edge))
+                dstChanged[i] = true;
+        }
+    });
+    inParallelPhase = false;
+    parallelTime += (stat->getClk() - start) / TIMEINTERVAL;
+
+    for (size_t i = 0; i < dsts.size(); ++i) {
+        if (dstChanged[i])
+            pushIntoWorklist(dsts[i]);
+    }
+    for (SVFGEdge *edge : sequentialEdges) {
+        if (propFromSrcToDst(edge))
+            pushIntoWorklist(edge->getDstID());
+    }
+
+    for (const SVFGNode *node : nodes)
+        clearAllDFOutVarFlag(node);
+}
+
+/*!
+ * Propagate to the successors of a node, going through the compacted
+ * edges of the SVFG if it is frozen
+ */
+void FlowSensitive::propagate(SVFGNode **v) {
+    if (!svfg->isFrozen()) {
+        WPASVFGFSSolver::propagate(v);
+        return;
+    }
+
+    for (SVFGEdge *edge : svfg->getFrozenOutEdges((*v)->getId())) {
+        if (propFromSrcToDst(edge))
+            pushIntoWorklist(edge->getDstID());
+    }
+}
+
 /*!
  * Process each SVFG node
  */
@@ -202,7 +451,8 @@ bool FlowSensitive::processSVFGNode(SVFGNode *node) {
         assert(false && "unexpected kind of SVFG nodes");
 
     double end = stat->getClk();
-    processTime += (end - start) / TIMEINTERVAL;
+    if (!inParallelPhase)
+        processTime += (end - start) / TIMEINTERVAL;
 
     return changed;
 }
@@ -227,7 +477,8 @@ bool FlowSensitive::propFromSrcToDst(SVFGEdge *edge) {
         assert(false && "new kind of svfg edge?");
 
     double end = stat->getClk();
-    propagationTime += (end - start) / TIMEINTERVAL;
+    if (!inParallelPhase)
+        propagationTime += (end - start) / TIMEINTERVAL;
     return changed;
 }
 
@@ -255,7 +506,8 @@ bool FlowSensitive::propAlongDirectEdge(const DirectSVFGEdge *edge) {
     }
 
     double end = stat->getClk();
-    directPropaTime += (end - start) / TIMEINTERVAL;
+    if (!inParallelPhase)
+        directPropaTime += (end - start) / TIMEINTERVAL;
     return changed;
 }
 
@@ -321,7 +573,8 @@ bool FlowSensitive::propAlongIndirectEdge(const IndirectSVFGEdge *edge) {
     }
 
     double end = stat->getClk();
-    indirectPropaTime += (end - start) / TIMEINTERVAL;
+    if (!inParallelPhase)
+        indirectPropaTime += (end - start) / TIMEINTERVAL;
     return changed;
 }
 
@@ -353,7 +606,8 @@ bool FlowSensitive::processAddr(const AddrSVFGNode *addr) {
         srcID = getFIObjNode(srcID);
     bool changed = addPts(addr->getPAGDstNodeID(), srcID);
     double end = stat->getClk();
-    addrTime += (end - start) / TIMEINTERVAL;
+    if (!inParallelPhase)
+        addrTime += (end - start) / TIMEINTERVAL;
     return changed;
 }
 
@@ -364,7 +618,8 @@ bool FlowSensitive::processCopy(const CopySVFGNode *copy) {
     double start = stat->getClk();
     bool changed = unionPts(copy->getPAGDstNodeID(), copy->getPAGSrcNodeID());
     double end = stat->getClk();
-    copyTime += (end - start) / TIMEINTERVAL;
+    if (!inParallelPhase)
+        copyTime += (end - start) / TIMEINTERVAL;
     return changed;
 }
 
@@ -383,7 +638,8 @@ bool FlowSensitive::processPhi(const PHISVFGNode *phi) {
     }
 
     double end = stat->getClk();
-    phiTime += (end - start) / TIMEINTERVAL;
+    if (!inParallelPhase)
+        phiTime += (end - start) / TIMEINTERVAL;
     return changed;
 }
 
@@ -463,7 +719,8 @@ bool FlowSensitive::processLoad(const LoadSVFGNode *load) {
     }
 
     double end = stat->getClk();
-    loadTime += (end - start) / TIMEINTERVAL;
+    if (!inParallelPhase)
+        loadTime += (end - start) / TIMEINTERVAL;
     return changed;
 }
 
@@ -500,24 +757,31 @@ bool FlowSensitive::processStore(const StoreSVFGNode *store) {
     }
 
     double end = stat->getClk();
-    storeTime += (end - start) / TIMEINTERVAL;
+    if (!inParallelPhase)
+        storeTime += (end - start) / TIMEINTERVAL;
 
     double updateStart = stat->getClk();
     // also merge the DFInSet to DFOutSet.
     /// check if this is a strong updates store
     NodeID singleton;
     bool isSU = isStrongUpdate(store, singleton);
+    {
+        std::lock_guard<std::mutex> guard(svfgHasSULock);
+        if (isSU)
+            svfgHasSU.set(store->getId());
+        else
+            svfgHasSU.reset(store->getId());
+    }
     if (isSU) {
-        svfgHasSU.set(store->getId());
         if (strongUpdateOutFromIn(store, singleton))
             changed = true;
     } else {
-        svfgHasSU.reset(store->getId());
         if (weakUpdateOutFromIn(store))
             changed = true;
     }
     double updateEnd = stat->getClk();
-    updateTime += (updateEnd - updateStart) / TIMEINTERVAL;
+    if (!inParallelPhase)
+        updateTime += (updateEnd - updateStart) / TIMEINTERVAL;
 
     return changed;
 }
@@ -149,6 +149,7 @@ void FlowSensitiveStat::performStat() {
     timeStatMap["StoreTime"] = fspta->storeTime;
     timeStatMap["UpdateCGTime"] = fspta->updateCallGraphTime;
     timeStatMap["PhiTime"] = fspta->phiTime;
+    timeStatMap["ParallelTime"] = fspta->parallelTime;
 
     PTNumStatMap[TotalNumOfPointers] =
         pag->getValueNodeNum() + pag->getFieldValNodeNum();
@@ -268,6 +269,9 @@ void FlowSensitiveStat::performStat() {
             : ((double)fspta->numOfNodesInSCC / fspta->numOfSCC);
 
     std::cout << "\n****Flow-Sensitive Pointer Analysis Statistics****\n";
+    if (fspta->parallelTime > 0)
+        std::cout << "Process/propagation times leave out the nodes solved "
+                     "concurrently, in ParallelTime\n";
     PTAStat::printStat();
 }
 
@@ -0,0 +1,325 @@
+//===- OfflineVarSubst.cpp -- Offline variable substitution -----------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * OfflineVarSubst.cpp
+ */
+
+#include "WPA/OfflineVarSubst.h"
+#include "SVF-FE/LLVMUtil.h"
+
+using namespace SVF;
+using namespace SVFUtil;
+
+void OfflineVarSubst::solve() {
+    NodeID numOfNodes = 0;
+    for (const auto &it : *consCG) {
+        numOfNodes = std::max(numOfNodes, it.first + 1);
+    }
+    labels.assign(numOfNodes, 0);
+    indirect.assign(numOfNodes, false);
+    mergeable.assign(numOfNodes, true);
+    // Label 0 is the empty set.
+    labelSets.assign(1, AtomSet());
+    setToLabel[AtomSet()] = 0;
+
+    markIndirectNodes();
+
+    std::vector<NodeID> members;
+    std::vector<u32_t> offsets;
+    findSCCs(members, offsets);
+    std::vector<u32_t> sccOf(numOfNodes, UINT_MAX);
+    for (u32_t scc = 0; scc + 1 < offsets.size(); ++scc) {
+        labelSCC(&members[offsets[scc]], offsets[scc + 1] - offsets[scc],
+                 sccOf, scc);
+    }
+
+    // Merge each node into the first node with its label.
+    Map<u32_t, NodeID> repOfLabel;
+    for (const auto &it : *consCG) {
+        NodeID id = it.first;
+        u32_t label = labels[id];
+        if (label == 0) {
+            if (!indirect[id]) {
+                emptyNodes.set(id);
+            }
+            continue;
+        }
+        if (!mergeable[id]) {
+            continue;
+        }
+
+        auto res = repOfLabel.insert(std::make_pair(label, id));
+        if (!res.second) {
+            merges.push_back(std::make_pair(id, res.first->second));
+        }
+    }
+}
+
+/*!
+ * Objects get what is stored into them, and Andersen's analysis connects
+ * the parameters of address-taken functions and the returns of indirect
+ * callsites on the fly
+ */
+void OfflineVarSubst::markIndirectNodes() {
+    PAG *pag = consCG->getPAG();
+    auto mark = [this](NodeID id) {
+        if (id < indirect.size()) {
+            indirect[id] = true;
+        }
+    };
+
+    for (const auto &it : *consCG) {
+        NodeID id = it.first;
+        const auto *objPN = llvm::dyn_cast<ObjPN>(pag->getGNode(id));
+        if (objPN == nullptr) {
+            continue;
+        }
+
+        mark(id);
+        mergeable[id] = false;
+        const MemObj *obj = pag->getObject(objPN);
+        if (!obj->isFunction()) {
+            continue;
+        }
+
+        const auto *fun = llvm::cast<Function>(obj->getRefVal());
+        const SVFFunction *callee =
+            getDefFunForMultipleModule(svfMod->getLLVMModSet(), fun);
+        if (callee == nullptr) {
+            continue;
+        }
+        if (pag->hasFunArgsList(callee)) {
+            for (const PAGNode *arg : pag->getFunArgsList(callee)) {
+                mark(arg->getId());
+            }
+        }
+        if (callee->isVarArg()) {
+            mark(pag->getVarargNode(callee));
+        }
+    }
+
+    for (const auto &it : pag->getIndirectCallsites()) {
+        const RetBlockNode *retBlockNode = it.first->getRetBlockNode();
+        if (pag->callsiteHasRet(retBlockNode)) {
+            mark(pag->getCallSiteRet(retBlockNode)->getId());
+        }
+    }
+}
+
+/*!
+ * Tarjan's algorithm with an explicit stack. It finishes SCCs in reverse
+ * topological order, which is reversed into members and offsets: SCC i
+ * is members[offsets[i]] to members[offsets[i + 1] - 1].
+ */
+void OfflineVarSubst::findSCCs(std::vector<NodeID> &members,
+                               std::vector<u32_t> &offsets) const {
+    using EdgeIter = ConstraintEdge::ConstraintEdgeSetTy::const_iterator;
+    struct Frame {
+        NodeID v;
+        EdgeIter it;
+        EdgeIter end;
+        bool loads; ///< Visiting the load edges after the direct ones
+    };
+
+    u32_t numOfNodes = labels.size();
+    std::vector<u32_t> index(numOfNodes, UINT_MAX);
+    std::vector<u32_t> low(numOfNodes, 0);
+    std::vector<bool> onStack(numOfNodes, false);
+    std::vector<NodeID> stack;
+    std::vector<Frame> dfs;
+    std::vector<NodeID> finished;
+    std::vector<u32_t> ends;
+    u32_t nextIndex = 0;
+
+    auto enter = [&](NodeID v) {
+        index[v] = low[v] = nextIndex++;
+        stack.push_back(v);
+        onStack[v] = true;
+        const auto &edges = consCG->getConstraintNode(v)->getDirectOutEdges();
+        dfs.push_back(Frame{v, edges.begin(), edges.end(), false});
+    };
+
+    for (const auto &it : *consCG) {
+        if (index[it.first] != UINT_MAX) {
+            continue;
+        }
+
+        enter(it.first);
+        while (!dfs.empty()) {
+            Frame &frame = dfs.back();
+            NodeID v = frame.v;
+            if (frame.it != frame.end) {
+                NodeID w = (*frame.it)->getDstID();
+                ++frame.it;
+                if (index[w] == UINT_MAX) {
+                    enter(w);
+                } else if (onStack[w]) {
+                    low[v] = std::min(low[v], index[w]);
+                }
+                continue;
+            }
+
+            if (!frame.loads) {
+                const auto &loads =
+                    consCG->getConstraintNode(v)->getLoadOutEdges();
+                frame.it = loads.begin();
+                frame.end = loads.end();
+                frame.loads = true;
+                continue;
+            }
+
+            dfs.pop_back();
+            if (!dfs.empty()) {
+                NodeID u = dfs.back().v;
+                low[u] = std::min(low[u], low[v]);
+            }
+            if (low[v] != index[v]) {
+                continue;
+            }
+
+            NodeID w;
+            do {
+                w = stack.back();
+                stack.pop_back();
+                onStack[w] = false;
+                finished.push_back(w);
+            } while (w != v);
+            ends.push_back(finished.size());
+        }
+    }
+
+    members.reserve(finished.size());
+    offsets.reserve(ends.size() + 1);
+    offsets.push_back(0);
+    for (u32_t i = ends.size(); i-- > 0;) {
+        u32_t begin = i == 0 ? 0 : ends[i - 1];
+        members.insert(members.end(), finished.begin() + begin,
+                       finished.begin() + ends[i]);
+        offsets.push_back(members.size());
+    }
+}
+
+/*!
+ * Copy edges from other SCCs pass on their labels' atoms, gep edges the
+ * fields of these atoms, load edges the targets of their source's label
+ * and address edges their objects. An SCC which has an indirect node or
+ * computes its own points-to set with a gep or load edge inside it gets a
+ * new label instead, and the latter is not merged with anything.
+ */
+void OfflineVarSubst::labelSCC(const NodeID *members, u32_t size,
+                               std::vector<u32_t> &sccOf, u32_t scc) {
+    for (u32_t i = 0; i < size; ++i) {
+        sccOf[members[i]] = scc;
+    }
+
+    bool fresh = false;
+    bool selfDependent = false;
+    std::vector<u32_t> predLabels;
+    AtomSet atoms;
+    for (u32_t i = 0; i < size; ++i) {
+        NodeID id = members[i];
+        fresh = fresh || indirect[id];
+        ConstraintNode *node = consCG->getConstraintNode(id);
+
+        for (ConstraintEdge *edge : node->getDirectInEdges()) {
+            NodeID src = edge->getSrcID();
+            if (sccOf[src] == scc) {
+                selfDependent = selfDependent || !llvm::isa<CopyCGEdge>(edge);
+                continue;
+            }
+
+            u32_t label = labels[src];
+            if (llvm::isa<CopyCGEdge>(edge)) {
+                predLabels.push_back(label);
+            } else if (const auto *gep =
+                           llvm::dyn_cast<NormalGepCGEdge>(edge)) {
+                const LocationSet &ls = gep->getLocationSet();
+                for (u32_t atom : labelSets[label]) {
+                    atoms.push_back(
+                        getAtom(gepAtoms, std::make_pair(atom, ls)));
+                }
+            } else {
+                for (u32_t atom : labelSets[label]) {
+                    atoms.push_back(getAtom(variantGepAtoms, atom));
+                }
+            }
+        }
+
+        for (ConstraintEdge *edge : node->getLoadInEdges()) {
+            NodeID src = edge->getSrcID();
+            if (sccOf[src] == scc) {
+                selfDependent = true;
+            } else if (labels[src] != 0) {
+                atoms.push_back(getAtom(refAtoms, labels[src]));
+            }
+        }
+
+        for (ConstraintEdge *edge : node->getAddrInEdges()) {
+            atoms.push_back(getAtom(addrAtoms, edge->getSrcID()));
+        }
+    }
+
+    u32_t label;
+    if (fresh || selfDependent) {
+        label = newLabel();
+    } else {
+        std::sort(predLabels.begin(), predLabels.end());
+        predLabels.erase(std::unique(predLabels.begin(), predLabels.end()),
+                         predLabels.end());
+        if (atoms.empty() && predLabels.size() <= 1) {
+            label = predLabels.empty() ? 0 : predLabels.front();
+        } else {
+            for (u32_t pred : predLabels) {
+                const AtomSet &predAtoms = labelSets[pred];
+                atoms.insert(atoms.end(), predAtoms.begin(), predAtoms.end());
+            }
+            label = getLabelOfSet(atoms);
+        }
+    }
+
+    for (u32_t i = 0; i < size; ++i) {
+        labels[members[i]] = label;
+        if (selfDependent) {
+            mergeable[members[i]] = false;
+        }
+    }
+}
+
+u32_t OfflineVarSubst::getLabelOfSet(AtomSet &atoms) {
+    std::sort(atoms.begin(), atoms.end());
+    atoms.erase(std::unique(atoms.begin(), atoms.end()), atoms.end());
+    auto it = setToLabel.find(atoms);
+    if (it != setToLabel.end()) {
+        return it->second;
+    }
+
+    u32_t label = labelSets.size();
+    labelSets.push_back(atoms);
+    setToLabel.insert(std::make_pair(std::move(atoms), label));
+    return label;
+}
+
+u32_t OfflineVarSubst::newLabel() {
+    AtomSet atoms(1, numOfAtoms++);
+    return getLabelOfSet(atoms);
+}
@@ -7,6 +7,8 @@
 
 #include "WPA/Steensgaard.h"
 
+#include <numeric>
+
 using namespace SVF;
 using namespace SVFUtil;
 
@@ -17,71 +19,42 @@ Steensgaard *Steensgaard::steens = nullptr;
  */
 
 void Steensgaard::solveWorklist() {
+    if (solver != nullptr) {
+        return;
+    }
 
-    processAllAddr();
-
-    // Keep solving until workList is empty.
-    while (!isWorklistEmpty()) {
-        NodeID nodeId = popFromWorklist();
-        ConstraintNode *node = consCG->getConstraintNode(nodeId);
+    solver = new SteensgaardSolver(consCG, getSVFModule());
+    solver->solve();
 
-        /// foreach o \in pts(p)
-        for (NodeID o : getPts(nodeId)) {
+    Map<NodeID, PointsTo> objsOfEC;
+    for (NodeID o : solver->getObjs()) {
+        objsOfEC[solver->getEC(o)].set(o);
+    }
 
-            /// *p = q : EC(o) == EC(q)
-            for (ConstraintEdge *edge : node->getStoreInEdges()) {
-                ecUnion(edge->getSrcID(), o);
-            }
-            // r = *p : EC(r) == EC(o)
-            for (ConstraintEdge *edge : node->getLoadOutEdges()) {
-                ecUnion(o, edge->getDstID());
-            }
+    // The first node of each class identifies it and holds the objects of
+    // the class its nodes point to.
+    Map<NodeID, NodeID> nodeOfEC;
+    for (const auto &it : *consCG) {
+        NodeID id = it.first;
+        if (id >= nodeToEC.size()) {
+            NodeID size = nodeToEC.size();
+            nodeToEC.resize(id + 1);
+            std::iota(nodeToEC.begin() + size, nodeToEC.end(), size);
         }
 
-        /// q = p : EC(q) == EC(p)
-        for (ConstraintEdge *edge : node->getCopyOutEdges()) {
-            ecUnion(edge->getSrcID(), edge->getDstID());
-        }
-        /// q = &p->f : EC(q) == EC(p)
-        for (ConstraintEdge *edge : node->getGepOutEdges()) {
-            ecUnion(edge->getSrcID(), edge->getDstID());
+        auto res = nodeOfEC.insert(std::make_pair(solver->getEC(id), id));
+        nodeToEC[id] = res.first->second;
+        if (res.second) {
+            auto oit = objsOfEC.find(solver->getPointeeEC(id));
+            if (oit != objsOfEC.end()) {
+                unionPts(id, oit->second);
+            }
         }
     }
 }
 
-void Steensgaard::setEC(NodeID node, NodeID rep) {
-    rep = getEC(rep);
-    Set<NodeID> &subNodes = getSubNodes(node);
-    for (NodeID sub : subNodes) {
-        nodeToECMap[sub] = rep;
-        addSubNode(rep, sub);
-    }
-    subNodes.clear();
-}
-
-/// merge node into equiv class and merge node's pts into ec's pts
-void Steensgaard::ecUnion(NodeID node, NodeID ec) {
-    if (unionPts(ec, node))
-        pushIntoWorklist(ec);
-    setEC(node, ec);
-}
-
-/*!
- * Process address edges
- */
-void Steensgaard::processAllAddr() {
-    for (auto nodeIt : *consCG) {
-        ConstraintNode *cgNode = nodeIt.second;
-        for (auto it = cgNode->incomingAddrsBegin(),
-                  eit = cgNode->incomingAddrsEnd();
-             it != eit; ++it) {
-            numOfProcessedAddr++;
-
-            const AddrCGEdge *addr = llvm::cast<AddrCGEdge>(*it);
-            NodeID dst = addr->getDstID();
-            NodeID src = addr->getSrcID();
-            if (addPts(dst, src))
-                pushIntoWorklist(dst);
-        }
-    }
+bool Steensgaard::updateCallGraph(const CallSiteToFunPtrMap &callsites) {
+    CallEdgeMap newEdges;
+    onTheFlyCallGraphSolve(callsites, newEdges);
+    return false;
 }
@@ -0,0 +1,244 @@
+//===- SteensgaardSolver.cpp -- Unification-based constraint solver ---------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013->  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * SteensgaardSolver.cpp
+ */
+
+#include "WPA/SteensgaardSolver.h"
+#include "SVF-FE/LLVMUtil.h"
+
+#include <numeric>
+
+using namespace SVF;
+using namespace SVFUtil;
+
+/*!
+ * Solve the address, copy/gep, load and store constraints, and then the
+ * constraints of the indirect calls resolved with them
+ */
+void SteensgaardSolver::solve() {
+    PAG *pag = consCG->getPAG();
+    for (const auto &it : *pag) {
+        numOfNodes = std::max(numOfNodes, it.first + 1);
+    }
+    for (const auto &it : *consCG) {
+        numOfNodes = std::max(numOfNodes, it.first + 1);
+    }
+    parent.resize(numOfNodes);
+    std::iota(parent.begin(), parent.end(), 0);
+    rank.assign(numOfNodes, 0);
+    pointee.assign(numOfNodes, UINT_MAX);
+    hasObjs.assign(numOfNodes, false);
+
+    // The fields of an object are the object
+    for (const auto &it : *consCG) {
+        NodeID id = it.first;
+        const auto *objPN = llvm::dyn_cast<ObjPN>(pag->getGNode(id));
+        if (objPN == nullptr) {
+            continue;
+        }
+
+        objs.set(id);
+        NodeID base = pag->getBaseObjNode(id);
+        if (base != id && isSolved(base)) {
+            join(id, base);
+        }
+        hasObjs[getEC(id)] = true;
+
+        const MemObj *obj = pag->getObject(objPN);
+        if (obj->isFunction()) {
+            const auto *fun = llvm::cast<Function>(obj->getRefVal());
+            const SVFFunction *callee =
+                getDefFunForMultipleModule(svfMod->getLLVMModSet(), fun);
+            funObjs.push_back(std::make_pair(id, callee));
+        }
+    }
+
+    /// p = &o : o in EC(*p)
+    for (ConstraintEdge *edge : consCG->getAddrCGEdges()) {
+        join(getOrAddPointeeEC(edge->getDstID()), edge->getSrcID());
+    }
+    /// q = p, q = &p->f : EC(*q) == EC(*p)
+    for (ConstraintEdge *edge : consCG->getDirectCGEdges()) {
+        assign(edge->getDstID(), edge->getSrcID());
+    }
+    /// r = *p : EC(*r) == EC(**p)
+    for (ConstraintEdge *edge : consCG->getLoadCGEdges()) {
+        NodeID p = getOrAddPointeeEC(edge->getSrcID());
+        join(getOrAddPointeeEC(edge->getDstID()), getOrAddPointeeEC(p));
+    }
+    /// *p = q : EC(**p) == EC(*q)
+    for (ConstraintEdge *edge : consCG->getStoreCGEdges()) {
+        NodeID p = getOrAddPointeeEC(edge->getDstID());
+        join(getOrAddPointeeEC(p), getOrAddPointeeEC(edge->getSrcID()));
+    }
+
+    while (resolveIndCalls()) {
+    }
+}
+
+NodeID SteensgaardSolver::newEC() {
+    NodeID ec = parent.size();
+    parent.push_back(ec);
+    rank.push_back(0);
+    pointee.push_back(UINT_MAX);
+    hasObjs.push_back(false);
+    return ec;
+}
+
+/*!
+ * Union by rank. Unifying two classes unifies the classes they point to,
+ * which is done with a worklist rather than recursion.
+ */
+void SteensgaardSolver::join(NodeID id1, NodeID id2) {
+    std::vector<std::pair<NodeID, NodeID>> worklist;
+    worklist.push_back(std::make_pair(id1, id2));
+    while (!worklist.empty()) {
+        NodeID ec1 = getEC(worklist.back().first);
+        NodeID ec2 = getEC(worklist.back().second);
+        worklist.pop_back();
+        if (ec1 == ec2) {
+            continue;
+        }
+
+        if (rank[ec1] < rank[ec2]) {
+            std::swap(ec1, ec2);
+        }
+        parent[ec2] = ec1;
+        if (rank[ec1] == rank[ec2]) {
+            rank[ec1]++;
+        }
+        hasObjs[ec1] = hasObjs[ec1] || hasObjs[ec2];
+
+        if (pointee[ec1] == UINT_MAX) {
+            pointee[ec1] = pointee[ec2];
+        } else if (pointee[ec2] != UINT_MAX) {
+            worklist.push_back(std::make_pair(pointee[ec1], pointee[ec2]));
+        }
+    }
+}
+
+bool SteensgaardSolver::resolveIndCalls() {
+    Map<NodeID, std::vector<const SVFFunction *>> funsOfEC;
+    for (const auto &funObj : funObjs) {
+        funsOfEC[getEC(funObj.first)].push_back(funObj.second);
+    }
+
+    bool resolved = false;
+    for (const auto &it : consCG->getPAG()->getIndirectCallsites()) {
+        NodeID ec = getPointeeEC(it.second);
+        auto fit = funsOfEC.find(ec);
+        if (ec == UINT_MAX || fit == funsOfEC.end()) {
+            continue;
+        }
+
+        for (const SVFFunction *callee : fit->second) {
+            if (callee != nullptr && callees[it.first].insert(callee).second) {
+                connectCaller2Callee(it.first, callee);
+                resolved = true;
+            }
+        }
+    }
+    return resolved;
+}
+
+/*!
+ * As Andersen::connectCaller2CalleeParams, but also for non-pointer
+ * arguments, which only makes the classes coarser
+ */
+void SteensgaardSolver::connectCaller2Callee(const CallBlockNode *cs,
+                                             const SVFFunction *callee) {
+    PAG *pag = consCG->getPAG();
+    const RetBlockNode *retBlockNode = cs->getRetBlockNode();
+    if (pag->callsiteHasRet(retBlockNode)) {
+        NodeID csRet = pag->getCallSiteRet(retBlockNode)->getId();
+        // Andersen gives the callsite a dummy heap object.
+        if (isHeapAllocExtFunViaRet(callee)) {
+            hasObjs[getOrAddPointeeEC(csRet)] = true;
+        }
+        if (pag->funHasRet(callee)) {
+            assign(csRet, pag->getFunRet(callee)->getId());
+        }
+    }
+
+    if (!pag->hasCallSiteArgsMap(cs) || !pag->hasFunArgsList(callee)) {
+        return;
+    }
+
+    const PAG::PAGNodeList &csArgList = pag->getCallSiteArgsList(cs);
+    const PAG::PAGNodeList &funArgList = pag->getFunArgsList(callee);
+    auto csArgIt = csArgList.begin();
+    auto csArgEit = csArgList.end();
+    for (auto funArgIt = funArgList.begin(), funArgEit = funArgList.end();
+         funArgIt != funArgEit && csArgIt != csArgEit;
+         ++funArgIt, ++csArgIt) {
+        assign((*funArgIt)->getId(), (*csArgIt)->getId());
+    }
+
+    // Any remaining actual args must be varargs.
+    if (callee->isVarArg()) {
+        NodeID vaF = pag->getVarargNode(callee);
+        for (; csArgIt != csArgEit; ++csArgIt) {
+            assign(vaF, (*csArgIt)->getId());
+        }
+    }
+}
+
+bool SteensgaardSolver::mayPointToObjs(NodeID id) {
+    if (!isSolved(id)) {
+        return true;
+    }
+    NodeID ec = getPointeeEC(id);
+    return ec != UINT_MAX && hasObjs[ec];
+}
+
+/*!
+ * Whether BVDataPTAImpl::alias may find the points-to sets of id1 and id2
+ * to alias
+ */
+bool SteensgaardSolver::mayAlias(NodeID id1, NodeID id2) {
+    if (!isSolved(id1) || !isSolved(id2)) {
+        return true;
+    }
+
+    NodeID ec1 = getPointeeEC(id1);
+    NodeID ec2 = getPointeeEC(id2);
+    NodeID blackHole = consCG->getBlackHoleNode();
+    if (isSolved(blackHole)) {
+        NodeID blackHoleEC = getEC(blackHole);
+        if (ec1 == blackHoleEC || ec2 == blackHoleEC) {
+            return true;
+        }
+    }
+    return ec1 != UINT_MAX && ec1 == ec2 && hasObjs[ec1];
+}
+
+u32_t SteensgaardSolver::getNumOfECs() {
+    NodeBS ecs;
+    for (const auto &it : *consCG) {
+        if (isSolved(it.first)) {
+            ecs.set(getEC(it.first));
+        }
+    }
+    return ecs.count();
+}
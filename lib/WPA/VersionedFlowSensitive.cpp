@@ -9,6 +9,8 @@
  */
 
 #include "WPA/VersionedFlowSensitive.h"
+#include "Util/Options.h"
+#include "Util/Parallel.h"
 #include "WPA/Andersen.h"
 #include <iostream>
 
@@ -38,6 +40,7 @@ void VersionedFlowSensitive::initialize() {
     stat = new VersionedFlowSensitiveStat(this);
 
     vPtD = getVersionedPTDataTy();
+    numOfLabelThreads = getNumOfWorkerThreads(Options::VFSLabelThreads);
 
     prelabel();
     meldLabel();
@@ -52,8 +55,53 @@ void VersionedFlowSensitive::finalize() {
     // dumpReliances();
 }
 
+/*!
+ * Prelabeling and meld labeling are done per object: the versions of o only
+ * depend on the stores which may write o and on the indirect edges which
+ * carry o. This collects both for every object.
+ */
 void VersionedFlowSensitive::prelabel(void) {
     double start = stat->getClk(true);
+
+    NodeID numOfNodes = 0;
+    for (auto &it : *svfg) {
+        numOfNodes = std::max(numOfNodes, it.first + 1);
+    }
+    deltaNodes.assign(numOfNodes, false);
+    storeNodes.assign(numOfNodes, false);
+    loadNodes.assign(numOfNodes, false);
+
+    // Index the objects in order, so that consume and yield can be built
+    // sorted by object.
+    NodeBS objs;
+    for (auto &it : *svfg) {
+        NodeID l = it.first;
+        const SVFGNode *sn = it.second;
+        deltaNodes[l] = delta(l);
+        loadNodes[l] = llvm::isa<LoadSVFGNode>(sn);
+        if (const auto *stn = llvm::dyn_cast<StoreSVFGNode>(sn)) {
+            storeNodes[l] = true;
+            for (NodeID o : ander->getPts(stn->getPAGDstNodeID())) {
+                objs.set(o);
+            }
+        }
+
+        for (const SVFGEdge *e : sn->getOutEdges()) {
+            if (const auto *ie = llvm::dyn_cast<IndirectSVFGEdge>(e)) {
+                for (NodeID o : ie->getPointsTo()) {
+                    objs.set(o);
+                }
+            }
+        }
+    }
+
+    objToIdx.assign(objs.empty() ? 0 : objs.find_last() + 1, UINT_MAX);
+    for (NodeID o : objs) {
+        objToIdx[o] = objLabels.size();
+        objLabels.emplace_back();
+        objLabels.back().obj = o;
+    }
+
     for (auto &it : *svfg) {
         NodeID l = it.first;
         const SVFGNode *sn = it.second;
@@ -61,35 +109,28 @@ void VersionedFlowSensitive::prelabel(void) {
         if (const auto *stn = llvm::dyn_cast<StoreSVFGNode>(sn)) {
             // l: *p = q.
             // If p points to o (Andersen's), l yields a new version for o.
-            NodeID p = stn->getPAGDstNodeID();
-            for (NodeID o : ander->getPts(p)) {
-                meldYield[l][o] = newMeldVersion(o);
+            const PointsTo &ppt = ander->getPts(stn->getPAGDstNodeID());
+            for (NodeID o : ppt) {
+                objLabels[objToIdx[o]].stores.push_back(l);
             }
 
-            vWorklist.push(l);
-
-            if (ander->getPts(p).count() != 0) {
+            if (ppt.count() != 0) {
                 ++numPrelabeledNodes;
             }
-        } else if (delta(l)) {
-            // If l may change at runtime (new incoming edges), it's unknown
-            // whether a new consume version is required (we only consider what
-            // the node may yield), so we give it one just in case. This is
-            // sound but imprecise.
-            for (const SVFGEdge *e : sn->getOutEdges()) {
-                const auto *ie = llvm::dyn_cast<IndirectSVFGEdge>(e);
-                if (!ie)
-                    continue;
-                for (NodeID o : ie->getPointsTo()) {
-                    meldConsume[l][o] = newMeldVersion(o);
-                }
+        }
 
-                // Push into worklist because its consume == its yield.
-                vWorklist.push(l);
+        for (const SVFGEdge *e : sn->getOutEdges()) {
+            const auto *ie = llvm::dyn_cast<IndirectSVFGEdge>(e);
+            if (!ie)
+                continue;
 
-                if (ie->getPointsTo().count() != 0) {
-                    ++numPrelabeledNodes;
-                }
+            NodeID lp = ie->getDstNode()->getId();
+            for (NodeID o : ie->getPointsTo()) {
+                objLabels[objToIdx[o]].edges.push_back(std::make_pair(l, lp));
+            }
+
+            if (deltaNodes[l] && ie->getPointsTo().count() != 0) {
+                ++numPrelabeledNodes;
             }
         }
     }
@@ -101,51 +142,103 @@ void VersionedFlowSensitive::prelabel(void) {
 void VersionedFlowSensitive::meldLabel(void) {
     double start = stat->getClk(true);
 
-    while (!vWorklist.empty()) {
-        NodeID l = vWorklist.pop();
-        const SVFGNode *sl = svfg->getGNode(l);
+    parallelFor(objLabels.size(), numOfLabelThreads,
+                [this](size_t i) { meldLabelObj(objLabels[i]); });
+    for (const ObjMeldLabels &labels : objLabels) {
+        numPrelabelVersions += labels.numPrelabelVersions;
+    }
 
-        // Propagate l's y to lp's c for all l --o--> lp.
-        for (const SVFGEdge *e : sl->getOutEdges()) {
-            const auto *ie = llvm::dyn_cast<IndirectSVFGEdge>(e);
-            if (!ie)
-                continue;
+    double end = stat->getClk(true);
+    meldLabelingTime = (end - start) / TIMEINTERVAL;
+}
 
-            NodeID lp = ie->getDstNode()->getId();
+/*!
+ * Give stores a new y(o) and delta nodes a new c(o), then propagate l's y(o)
+ * to lp's c(o) for all l --o--> lp until nothing changes. Only reads shared
+ * state, so objects can be labeled concurrently.
+ */
+void VersionedFlowSensitive::meldLabelObj(ObjMeldLabels &labels) const {
+    std::vector<NodePair> &edges = labels.edges;
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    std::vector<NodeID> &nodes = labels.nodes;
+    nodes = labels.stores;
+    for (const NodePair &edge : edges) {
+        nodes.push_back(edge.first);
+        nodes.push_back(edge.second);
+    }
+    std::sort(nodes.begin(), nodes.end());
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+    auto idx = [&nodes](NodeID l) {
+        return std::lower_bound(nodes.begin(), nodes.end(), l) - nodes.begin();
+    };
+
+    // Out edges of each node, which are contiguous as edges are sorted.
+    std::vector<u32_t> firstEdge(nodes.size() + 1, 0);
+    for (const NodePair &edge : edges) {
+        firstEdge[idx(edge.first) + 1]++;
+    }
+    for (u32_t i = 0; i < nodes.size(); ++i) {
+        firstEdge[i + 1] += firstEdge[i];
+    }
+
+    std::vector<MeldVersion> &meldConsume = labels.meldConsume;
+    std::vector<MeldVersion> &meldYield = labels.meldYield;
+    meldConsume.assign(nodes.size(), MeldVersion());
+    meldYield.assign(nodes.size(), MeldVersion());
+
+    // Nodes are added when the version they yield is changed.
+    NodeWorkList worklist;
+    u32_t numOfMeldVersions = 0;
+    for (NodeID l : labels.stores) {
+        meldYield[idx(l)].set(++numOfMeldVersions);
+        worklist.push(idx(l));
+    }
+    for (const NodePair &edge : edges) {
+        // If l may change at runtime (new incoming edges), it's unknown
+        // whether a new consume version is required (we only consider what
+        // the node may yield), so we give it one just in case. This is
+        // sound but imprecise.
+        u32_t i = idx(edge.first);
+        if (deltaNodes[edge.first] && meldConsume[i].empty()) {
+            meldConsume[i].set(++numOfMeldVersions);
+            // Push into worklist because its consume == its yield.
+            worklist.push(i);
+        }
+    }
+    labels.numPrelabelVersions = numOfMeldVersions;
+
+    while (!worklist.empty()) {
+        u32_t i = worklist.pop();
+        NodeID l = nodes[i];
+        // For stores, yield != consume, otherwise they are the same.
+        const MeldVersion &myl = storeNodes[l] ? meldYield[i] : meldConsume[i];
+        if (myl.empty())
+            continue;
+
+        for (u32_t e = firstEdge[i]; e < firstEdge[i + 1]; ++e) {
+            NodeID lp = edges[e].second;
             // Delta nodes had c set already and they are permanent.
-            if (delta(lp))
+            if (deltaNodes[lp])
                 continue;
 
-            bool lpIsStore = llvm::isa<StoreSVFGNode>(svfg->getGNode(lp));
+            bool lpIsStore = storeNodes[lp];
             // Consume and yield are the same for non-stores, so ignore them.
             if (l == lp && !lpIsStore)
                 continue;
 
-            // For stores, yield != consume, otherwise they are the same.
-            ObjToMeldVersionMap &myl =
-                llvm::isa<StoreSVFGNode>(sl) ? meldYield[l] : meldConsume[l];
-            ObjToMeldVersionMap &mclp = meldConsume[lp];
-            bool yieldChanged = false;
-            for (NodeID o : ie->getPointsTo()) {
-                if (myl.find(o) == myl.end())
-                    continue;
-                // Yield == consume for non-stores, so when consume is updated,
-                // so is yield. For stores, yield was already set, and it's
-                // static.
-                yieldChanged =
-                    (meld(mclp[o], myl[o]) && !lpIsStore) || yieldChanged;
-            }
-
-            if (yieldChanged)
-                vWorklist.push(lp);
+            // Yield == consume for non-stores, so when consume is updated,
+            // so is yield. For stores, yield was already set, and it's
+            // static.
+            u32_t j = idx(lp);
+            if (meld(meldConsume[j], myl) && !lpIsStore)
+                worklist.push(j);
         }
     }
-
-    double end = stat->getClk(true);
-    meldLabelingTime = (end - start) / TIMEINTERVAL;
 }
 
-bool VersionedFlowSensitive::meld(MeldVersion &mv1, MeldVersion &mv2) {
+bool VersionedFlowSensitive::meld(MeldVersion &mv1, const MeldVersion &mv2) {
     // Meld operator is union of bit vectors.
     return mv1 |= mv2;
 }
@@ -153,66 +246,60 @@ bool VersionedFlowSensitive::meld(MeldVersion &mv1, MeldVersion &mv2) {
 void VersionedFlowSensitive::mapMeldVersions(void) {
     double start = stat->getClk(true);
 
-    // We want to uniquely map MeldVersions (SparseBitVectors) to a Version
-    // (unsigned integer). mvv keeps track, and curVersion is used to generate
-    // new Versions.
-    Map<MeldVersion, Version> mvv;
-    Version curVersion = 1;
-
-    // meldConsume -> consume.
-    for (LocMeldVersionMap::value_type &lomv : meldConsume) {
-        NodeID l = lomv.first;
-        bool isStore = llvm::isa<StoreSVFGNode>(svfg->getGNode(l));
-        ObjToVersionMap &consumel = consume[l];
-        ObjToVersionMap &yieldl = yield[l];
-        for (ObjToMeldVersionMap::value_type &omv : lomv.second) {
-            NodeID o = omv.first;
-            MeldVersion &mv = omv.second;
-
+    // We want to uniquely map the MeldVersions (SparseBitVectors) of each
+    // object to a Version (unsigned integer) of the object.
+    parallelFor(objLabels.size(), numOfLabelThreads, [this](size_t o) {
+        ObjMeldLabels &labels = objLabels[o];
+        Map<MeldVersion, Version> mvv;
+        auto getVersion = [&mvv, &labels](const MeldVersion &mv) {
             auto foundVersion = mvv.find(mv);
-            // If a mapping for foudnVersion exists, use it, otherwise create a
-            // new Version, keep track of it, and use that.
-            Version v = foundVersion == mvv.end() ? mvv[mv] = ++curVersion
-                                                  : foundVersion->second;
-            consumel[o] = v;
+            // If a mapping for foundVersion exists, use it, otherwise create
+            // a new Version, keep track of it, and use that.
+            return foundVersion == mvv.end()
+                       ? mvv[mv] = ++labels.numOfVersions
+                       : foundVersion->second;
+        };
+
+        labels.consume.assign(labels.nodes.size(), invalidVersion);
+        labels.yield.assign(labels.nodes.size(), invalidVersion);
+        for (u32_t i = 0; i < labels.nodes.size(); ++i) {
+            if (!labels.meldConsume[i].empty()) {
+                labels.consume[i] = getVersion(labels.meldConsume[i]);
+            }
             // At non-stores, consume == yield.
-            if (!isStore) {
-                yieldl[o] = v;
+            if (!storeNodes[labels.nodes[i]]) {
+                labels.yield[i] = labels.consume[i];
+            } else if (!labels.meldYield[i].empty()) {
+                labels.yield[i] = getVersion(labels.meldYield[i]);
             }
         }
-    }
-
-    // meldYield -> yield.
-    for (LocMeldVersionMap::value_type &lomv : meldYield) {
-        NodeID l = lomv.first;
-        ObjToVersionMap &yieldl = yield[l];
-        for (ObjToMeldVersionMap::value_type &omv : lomv.second) {
-            NodeID o = omv.first;
-            MeldVersion &mv = omv.second;
-
-            auto foundVersion = mvv.find(mv);
-            Version v = foundVersion == mvv.end() ? mvv[mv] = ++curVersion
-                                                  : foundVersion->second;
-            yieldl[o] = v;
-        }
-    }
 
-    // No longer necessary.
-    meldConsume.clear();
-    meldYield.clear();
+        // No longer necessary.
+        labels.meldConsume = std::vector<MeldVersion>();
+        labels.meldYield = std::vector<MeldVersion>();
+    });
+
+    auto forEachVersion = [this](bool isConsume) {
+        return [this, isConsume](const auto &add) {
+            for (const ObjMeldLabels &labels : objLabels) {
+                const std::vector<Version> &versions =
+                    isConsume ? labels.consume : labels.yield;
+                for (u32_t i = 0; i < labels.nodes.size(); ++i) {
+                    if (versions[i] != invalidVersion) {
+                        add(labels.nodes[i], labels.obj, versions[i]);
+                    }
+                }
+            }
+        };
+    };
+    consume.build(deltaNodes.size(), forEachVersion(true));
+    yield.build(deltaNodes.size(), forEachVersion(false));
 
     double end = stat->getClk(true);
     meldMappingTime += (end - start) / TIMEINTERVAL;
 }
 
-bool VersionedFlowSensitive::delta(NodeID l) {
-    // Whether a node is a delta node or not. Decent boon to performance.
-    static Map<NodeID, bool> deltaCache;
-
-    auto isDelta = deltaCache.find(l);
-    if (isDelta != deltaCache.end())
-        return isDelta->second;
-
+bool VersionedFlowSensitive::delta(NodeID l) const {
     const SVFGNode *s = svfg->getGNode(l);
     // Cases:
     //  * Function entry: can get new incoming indirect edges through ind.
@@ -224,73 +311,63 @@ bool VersionedFlowSensitive::delta(NodeID l) {
         PTACallGraphEdge::CallInstSet callsites;
         /// use pre-analysis call graph to approximate all potential callsites
         ander->getPTACallGraph()->getIndCallSitesInvokingCallee(fn, callsites);
-
-        deltaCache[l] = !callsites.empty();
         return !callsites.empty();
     } else if (const CallBlockNode *cbn = svfg->isCallSiteRetSVFGNode(s)) {
-        deltaCache[l] = cbn->isIndirectCall();
         return cbn->isIndirectCall();
     }
 
     return false;
 }
 
-VersionedFlowSensitive::MeldVersion
-VersionedFlowSensitive::newMeldVersion(NodeID o) {
-    ++numPrelabelVersions;
-    MeldVersion nv;
-    nv.set(++meldVersions[o]);
-    return nv;
-}
-
 bool VersionedFlowSensitive::hasVersion(NodeID l, NodeID o,
                                         enum VersionType v) const {
-    // Choose which map we are checking.
-    const LocVersionMap &m = v == CONSUME ? consume : yield;
-    const auto ml = m.find(l);
-    if (ml == m.end())
-        return false;
-    return ml->second.find(o) != ml->second.end();
+    // Choose which table we are checking.
+    return (v == CONSUME ? consume : yield).find(l, o) != nullptr;
 }
 
 void VersionedFlowSensitive::determineReliance(void) {
     double start = stat->getClk(true);
-    for (auto &it : *svfg) {
-        NodeID l = it.first;
-        const SVFGNode *sn = it.second;
-        for (const SVFGEdge *e : sn->getOutEdges()) {
-            const auto *ie = llvm::dyn_cast<IndirectSVFGEdge>(e);
-            if (!ie)
-                continue;
 
-            ObjToVersionMap &yieldl = yield[l];
-            for (NodeID o : ie->getPointsTo()) {
-                // Given l --o--> lp, c(o) at lp relies on y(o) at l.
-                NodeID lp = ie->getDstNode()->getId();
-
-                if (!hasVersion(l, o, YIELD))
-                    continue;
-                Version &y = yieldl[o];
-
-                if (!hasVersion(lp, o, CONSUME))
-                    continue;
-                Version &cp = consume[lp][o];
-                if (cp != y) {
-                    versionReliance[o][y].insert(cp);
-                }
+    objVersions.resize(objLabels.size());
+    parallelFor(objLabels.size(), numOfLabelThreads, [this](size_t o) {
+        const ObjMeldLabels &labels = objLabels[o];
+        ObjVersions &versions = objVersions[o];
+        versions.obj = labels.obj;
+        versions.versionReliance.resize(labels.numOfVersions + 1);
+        versions.stmtReliance.resize(labels.numOfVersions + 1);
+
+        const std::vector<NodeID> &nodes = labels.nodes;
+        auto idx = [&nodes](NodeID l) {
+            return std::lower_bound(nodes.begin(), nodes.end(), l) -
+                   nodes.begin();
+        };
+        for (const NodePair &edge : labels.edges) {
+            // Given l --o--> lp, c(o) at lp relies on y(o) at l.
+            Version y = labels.yield[idx(edge.first)];
+            Version cp = labels.consume[idx(edge.second)];
+            if (y != invalidVersion && cp != invalidVersion && cp != y) {
+                versions.versionReliance[y].push_back(cp);
             }
         }
+        for (std::vector<Version> &reliant : versions.versionReliance) {
+            std::sort(reliant.begin(), reliant.end());
+            reliant.erase(std::unique(reliant.begin(), reliant.end()),
+                          reliant.end());
+        }
 
         // When an object/version points-to set changes, these nodes need to
         // know.
-        if (llvm::isa<LoadSVFGNode>(sn) || llvm::isa<StoreSVFGNode>(sn)) {
-            for (ObjToVersionMap::value_type &ov : consume[l]) {
-                NodeID o = ov.first;
-                Version &v = ov.second;
-                stmtReliance[o][v].set(l);
+        for (u32_t i = 0; i < nodes.size(); ++i) {
+            Version v = labels.consume[i];
+            if (v != invalidVersion &&
+                (loadNodes[nodes[i]] || storeNodes[nodes[i]])) {
+                versions.stmtReliance[v].set(nodes[i]);
             }
         }
-    }
+    });
+
+    // No longer necessary.
+    objLabels = std::vector<ObjMeldLabels>();
 
     double end = stat->getClk(true);
     relianceTime = (end - start) / TIMEINTERVAL;
@@ -300,17 +377,16 @@ void VersionedFlowSensitive::propagateVersion(NodeID o, Version v,
                                               bool recurse) {
     double start = stat->getClk();
 
-    auto relyingVersions = versionReliance[o].find(v);
-    if (relyingVersions != versionReliance[o].end()) {
-        for (Version r : relyingVersions->second) {
-            if (vPtD->unionPts(atKey(o, r), atKey(o, v))) {
-                propagateVersion(o, r, true);
-            }
+    ObjVersions *versions = getObjVersions(o);
+    assert(versions && "VFS::propagateVersion: object without versions!");
+    for (Version r : versions->versionReliance[v]) {
+        if (vPtD->unionPts(atKey(o, r), atKey(o, v))) {
+            propagateVersion(o, r, true);
         }
     }
 
     // Notify nodes which rely on o/v that it changed.
-    for (NodeID s : stmtReliance[o][v]) {
+    for (NodeID s : versions->stmtReliance[v]) {
         pushIntoWorklist(s);
     }
 
@@ -346,12 +422,18 @@ void VersionedFlowSensitive::updateConnectedNodes(
             for (NodeID o : ept) {
                 if (!hasVersion(src, o, YIELD))
                     continue;
-                Version &srcY = yield[src][o];
+                Version srcY = getVersion(src, o, YIELD);
                 if (!hasVersion(dst, o, CONSUME))
                     continue;
-                Version &dstC = consume[dst][o];
-
-                versionReliance[o][srcY].insert(dstC);
+                Version dstC = getVersion(dst, o, CONSUME);
+
+                std::vector<Version> &reliant =
+                    getObjVersions(o)->versionReliance[srcY];
+                auto it =
+                    std::lower_bound(reliant.begin(), reliant.end(), dstC);
+                if (it == reliant.end() || *it != dstC) {
+                    reliant.insert(it, dstC);
+                }
                 propagateVersion(o, srcY);
             }
 
@@ -377,8 +459,8 @@ bool VersionedFlowSensitive::processLoad(const LoadSVFGNode *load) {
         if (pag->isConstantObj(o) || pag->isNonPointerObj(o))
             continue;
 
-        if (hasVersion(l, o, CONSUME) &&
-            vPtD->unionPts(p, atKey(o, consume[l][o]))) {
+        const Version *c = consume.find(l, o);
+        if (c != nullptr && vPtD->unionPts(p, atKey(o, *c))) {
             changed = true;
         }
 
@@ -387,8 +469,8 @@ bool VersionedFlowSensitive::processLoad(const LoadSVFGNode *load) {
             /// nodes' points-to sets and pass them to p.
             const NodeBS &fields = getAllFieldsObjNode(o);
             for (NodeID of : fields) {
-                if (hasVersion(l, of, CONSUME) &&
-                    vPtD->unionPts(p, atKey(of, consume[l][of]))) {
+                const Version *cf = consume.find(l, of);
+                if (cf != nullptr && vPtD->unionPts(p, atKey(of, *cf))) {
                     changed = true;
                 }
             }
@@ -423,8 +505,8 @@ bool VersionedFlowSensitive::processStore(const StoreSVFGNode *store) {
             if (pag->isConstantObj(o) || pag->isNonPointerObj(o))
                 continue;
 
-            if (hasVersion(l, o, YIELD) &&
-                vPtD->unionPts(atKey(o, yield[l][o]), q)) {
+            const Version *y = yield.find(l, o);
+            if (y != nullptr && vPtD->unionPts(atKey(o, *y), q)) {
                 changed = true;
                 changedObjects.set(o);
             }
@@ -445,9 +527,7 @@ bool VersionedFlowSensitive::processStore(const StoreSVFGNode *store) {
 
     // For all objects, perform pts(o:y) = pts(o:y) U pts(o:c) at loc,
     // except when a strong update is taking place.
-    ObjToVersionMap &yieldL = yield[l];
-    ObjToVersionMap &consumeL = consume[l];
-    for (ObjToVersionMap::value_type &oc : consumeL) {
+    for (const ObjVersion &oc : consume.at(l)) {
         NodeID o = oc.first;
         Version c = oc.second;
 
@@ -455,10 +535,10 @@ bool VersionedFlowSensitive::processStore(const StoreSVFGNode *store) {
         if (isSU && o == singleton)
             continue;
 
-        if (!hasVersion(l, o, YIELD))
+        const Version *y = yield.find(l, o);
+        if (y == nullptr)
             continue;
-        Version y = yieldL[o];
-        if (vPtD->unionPts(atKey(o, y), atKey(o, c))) {
+        if (vPtD->unionPts(atKey(o, *y), atKey(o, c))) {
             changed = true;
             changedObjects.set(o);
         }
@@ -471,12 +551,11 @@ bool VersionedFlowSensitive::processStore(const StoreSVFGNode *store) {
     // inconsequential *except* for time taken for propagateVersion, which will
     // time itself.
     if (!changedObjects.empty()) {
-        ObjToVersionMap &yieldl = yield[l];
         for (NodeID o : changedObjects) {
             // Definitely has a yielded version (came from prelabelling) as
             // these are the changed objects which must've been pointed to in
             // Andersen's too.
-            propagateVersion(o, yieldl[o]);
+            propagateVersion(o, getVersion(l, o, YIELD));
         }
     }
 
@@ -485,15 +564,16 @@ bool VersionedFlowSensitive::processStore(const StoreSVFGNode *store) {
 
 void VersionedFlowSensitive::dumpReliances(void) const {
     SVFUtil::outs() << "# Version reliances\n";
-    for (const auto &ovrv : versionReliance) {
-        NodeID o = ovrv.first;
-        SVFUtil::outs() << "  Object " << o << "\n";
-        for (const auto &vrv : ovrv.second) {
-            Version v = vrv.first;
+    for (const ObjVersions &versions : objVersions) {
+        SVFUtil::outs() << "  Object " << versions.obj << "\n";
+        for (Version v = 0; v < versions.versionReliance.size(); ++v) {
+            const std::vector<Version> &reliant = versions.versionReliance[v];
+            if (reliant.empty())
+                continue;
             SVFUtil::outs() << "    Version " << v << " is a reliance for: ";
 
             bool first = true;
-            for (Version rv : vrv.second) {
+            for (Version rv : reliant) {
                 if (!first) {
                     SVFUtil::outs() << ", ";
                 }
@@ -507,16 +587,16 @@ void VersionedFlowSensitive::dumpReliances(void) const {
     }
 
     SVFUtil::outs() << "# Statement reliances\n";
-    for (const auto &ovss : stmtReliance) {
-        NodeID o = ovss.first;
-        SVFUtil::outs() << "  Object " << o << "\n";
+    for (const ObjVersions &versions : objVersions) {
+        SVFUtil::outs() << "  Object " << versions.obj << "\n";
 
-        for (const auto &vss : ovss.second) {
-            Version v = vss.first;
+        for (Version v = 0; v < versions.stmtReliance.size(); ++v) {
+            const NodeBS &ss = versions.stmtReliance[v];
+            if (ss.empty())
+                continue;
             SVFUtil::outs()
                 << "    Version " << v << " is a reliance for statements: ";
 
-            const NodeBS &ss = vss.second;
             bool first = true;
             for (NodeID s : ss) {
                 if (!first) {
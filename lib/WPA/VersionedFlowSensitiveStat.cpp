@@ -157,19 +157,12 @@ void VersionedFlowSensitiveStat::performStat() {
 
 void VersionedFlowSensitiveStat::versionStat(void) {
     Map<NodeID, Set<Version>> versions;
-    for (VersionedFlowSensitive::LocVersionMap::value_type &lov :
-         vfspta->consume) {
-        for (VersionedFlowSensitive::ObjToVersionMap::value_type &ov :
-             lov.second) {
-            versions[ov.first].insert(ov.second);
-        }
-    }
-
-    for (VersionedFlowSensitive::LocVersionMap::value_type &lov :
-         vfspta->yield) {
-        for (VersionedFlowSensitive::ObjToVersionMap::value_type &ov :
-             lov.second) {
-            versions[ov.first].insert(ov.second);
+    for (const VersionedFlowSensitive::LocVersionTable *table :
+         {&vfspta->consume, &vfspta->yield}) {
+        for (NodeID l = 0; l < table->getNumOfNodes(); ++l) {
+            for (const VersionedFlowSensitive::ObjVersion &ov : table->at(l)) {
+                versions[ov.first].insert(ov.second);
+            }
         }
     }
 
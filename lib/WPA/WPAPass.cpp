@@ -146,6 +146,8 @@ void WPAPass::runPointerAnalysis(SVFProject *proj, u32_t kind) {
         SVFGBuilder memSSA(true);
         assert(llvm::isa<AndersenBase>(_pta) &&
                "supports only andersen/steensgaard for pre-computed SVFG");
+        /// mod-ref queries need the memory SSA, which is not cached
+        memSSA.setCacheable(false);
         SVFG *svfg = memSSA.buildFullSVFGWithoutOPT((BVDataPTAImpl *)_pta);
         /// support mod-ref queries only for -ander
         if (Options::PASelected.isSet(PointerAnalysis::AndersenWaveDiff_WPA))
@@ -0,0 +1,27 @@
+#include <cstdlib>
+
+void consume(int *p) { *p = 1; }
+
+int *make(int n) { return (int *)malloc(sizeof(int) * n); }
+
+int main(int argc, char **argv) {
+    int *never = (int *)malloc(sizeof(int));
+    consume(never);
+
+    int *partial = make(argc);
+    if (argc > 1)
+        free(partial);
+
+    int *always = make(2);
+    if (argc > 2)
+        consume(always);
+    free(always);
+
+    for (int i = 0; i < argc; ++i) {
+        int *loop = (int *)malloc(sizeof(int));
+        if (i % 2)
+            free(loop);
+    }
+
+    return 0;
+}
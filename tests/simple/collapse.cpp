@@ -0,0 +1,9 @@
+struct T {
+    int f0, f1;
+};
+
+int main(int argc, char **argv) {
+    T t;
+    int *p = &t.f0 + argc;
+    return *p;
+}
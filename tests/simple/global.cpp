@@ -0,0 +1,7 @@
+int x;
+int *gp = &x;
+
+int main() {
+    *gp = 1;
+    return x;
+}
@@ -0,0 +1,7 @@
+struct S {
+    int f0, f1, f2, f3, f4, f5, f6, f7;
+};
+
+S s;
+
+int main() { return s.f3; }
@@ -0,0 +1,413 @@
+//===- svf-bench.cpp -- Pointer analysis benchmarks ------------------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013-2017>  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===-----------------------------------------------------------------------===//
+
+/*
+ // Pointer analysis benchmarks
+ //
+ // Runs each selected solver on each input (bitcode files given on the
+ // command line or listed in -bench-corpus, and PAG text files given with
+ // -bench-pag) and prints one CSV row per run. Every run is a child process
+ // so that runs do not share the analyses' global state, a crash or time
+ // out only fails its own row, and the peak memory is the run's own.
+ //
+ // Columns (stable; new ones are only appended):
+ //   input, solver, run, status (ok, failed, crash or timeout),
+ //   wall_ms, user_ms, sys_ms (whole child), pag_ms (project and PAG),
+ //   solve_ms (analysis), iterations, peak_rss_kb, pointers (top-level
+ //   pointers, or queries for DDA), total_pts, avg_pts, max_pts
+ //
+ // Options of the analyses (e.g. -ander-threads) apply to every run.
+ */
+
+#include "DDA/ContextDDA.h"
+#include "DDA/DDAClient.h"
+#include "DDA/FlowDDA.h"
+#include "MemoryModel/PTAStat.h"
+#include "SABER/LeakChecker.h"
+#include "SVF-FE/LLVMUtil.h"
+#include "WPA/Andersen.h"
+#include "WPA/AndersenSFR.h"
+#include "WPA/FlowSensitive.h"
+#include "WPA/Steensgaard.h"
+#include "WPA/VersionedFlowSensitive.h"
+
+#include <algorithm>
+#include <fcntl.h>
+#include <fstream>
+#include <iomanip>
+#include <signal.h>
+#include <sstream>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace llvm;
+using namespace std;
+using namespace SVF;
+
+static llvm::cl::list<std::string>
+    BenchSolvers("bench-solvers", llvm::cl::CommaSeparated,
+                 llvm::cl::desc("Solvers to run (default: all): nander, "
+                                "lander, hander, hlander, sander, sfrander, "
+                                "wander, steens, fspta, vfspta, dfs, cxt, "
+                                "leak"));
+
+static llvm::cl::opt<std::string>
+    BenchCorpus("bench-corpus", llvm::cl::init(""),
+                llvm::cl::desc("File listing bitcode files, one per line"));
+
+static llvm::cl::list<std::string> BenchPAGs(
+    "bench-pag", llvm::cl::CommaSeparated,
+    llvm::cl::desc("PAG text files (the format of PAGBuilderFromFile)"));
+
+static llvm::cl::opt<unsigned>
+    BenchRuns("bench-runs", llvm::cl::init(1),
+              llvm::cl::desc("Number of runs of each solver on each input"));
+
+static llvm::cl::opt<unsigned>
+    BenchTimeout("bench-timeout", llvm::cl::init(0),
+                 llvm::cl::desc("Seconds after which a run is killed "
+                                "(0 for no limit)"));
+
+static llvm::cl::opt<std::string>
+    BenchOut("bench-out", llvm::cl::init(""),
+             llvm::cl::desc("Write the CSV to a file instead of stdout"));
+
+static llvm::cl::opt<bool>
+    BenchVerbose("bench-verbose", llvm::cl::init(false),
+                 llvm::cl::desc("Keep the output of the analyses"));
+
+namespace {
+
+/// Values of a run's columns by name
+using Metrics = std::map<std::string, std::string>;
+
+struct BenchInput {
+    std::string file;
+    bool isPAG; ///< PAG text file rather than bitcode
+};
+
+struct Solver {
+    const char *name;
+    bool needsIR; ///< Needs the IR (memory SSA, SVFG, ...), not only a PAG
+    void (*run)(SVFProject *proj, Metrics &metrics);
+};
+
+const char *const columns[] = {
+    "input",      "solver",      "run",      "status",    "wall_ms",
+    "user_ms",    "sys_ms",      "pag_ms",   "solve_ms",  "iterations",
+    "peak_rss_kb", "pointers",   "total_pts", "avg_pts",  "max_pts"};
+
+/// A CSV field, quoted if it has to be
+std::string csvField(const std::string &str) {
+    if (str.find_first_of(",\"\n") == std::string::npos) {
+        return str;
+    }
+
+    std::string quoted = "\"";
+    for (char c : str) {
+        if (c == '"') {
+            quoted += '"';
+        }
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+std::string formatMs(double ms) {
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(3) << ms;
+    return os.str();
+}
+
+/// Points-to statistics of a set of pointers
+template <typename NodeRange>
+void ptsStat(PointerAnalysis *pta, const NodeRange &ptrs, Metrics &metrics) {
+    u64_t numOfPtrs = 0;
+    u64_t totalPts = 0;
+    u32_t maxPts = 0;
+    for (NodeID ptr : ptrs) {
+        u32_t size = pta->getPts(ptr).count();
+        numOfPtrs++;
+        totalPts += size;
+        maxPts = std::max(maxPts, size);
+    }
+    metrics["pointers"] = std::to_string(numOfPtrs);
+    metrics["total_pts"] = std::to_string(totalPts);
+    metrics["avg_pts"] =
+        formatMs(numOfPtrs == 0 ? 0.0 : (double)totalPts / numOfPtrs);
+    metrics["max_pts"] = std::to_string(maxPts);
+}
+
+template <typename PTA> void runWPA(SVFProject *proj, Metrics &metrics) {
+    PTA pta(proj);
+    pta.analyze();
+
+    PAG *pag = pta.getPAG();
+    std::vector<NodeID> ptrs;
+    for (const auto &it : *pag) {
+        if (pag->isValidTopLevelPtr(it.second)) {
+            ptrs.push_back(it.first);
+        }
+    }
+    metrics["iterations"] = std::to_string(pta.numOfIteration);
+    ptsStat(&pta, ptrs, metrics);
+}
+
+template <typename DDA> void runDDA(SVFProject *proj, Metrics &metrics) {
+    DDAClient client(proj->getSVFModule());
+    client.initialise(proj->getSVFModule());
+    DDA dda(proj, &client);
+    dda.initialize();
+    client.answerQueries(&dda);
+    dda.finalize();
+    ptsStat(&dda, client.getCandidateQueries(), metrics);
+}
+
+void runLeakChecker(SVFProject *proj, Metrics &) {
+    LeakChecker saber(proj);
+    saber.runOnModule(proj->getSVFModule());
+}
+
+const Solver solvers[] = {
+    {"nander", false, runWPA<Andersen>},
+    {"lander", false, runWPA<AndersenLCD>},
+    {"hander", false, runWPA<AndersenHCD>},
+    {"hlander", false, runWPA<AndersenHLCD>},
+    {"sander", false, runWPA<AndersenSCD>},
+    {"sfrander", false, runWPA<AndersenSFR>},
+    {"wander", false, runWPA<AndersenWaveDiff>},
+    {"steens", false, runWPA<Steensgaard>},
+    {"fspta", true, runWPA<FlowSensitive>},
+    {"vfspta", true, runWPA<VersionedFlowSensitive>},
+    {"dfs", true, runDDA<FlowDDA>},
+    {"cxt", true, runDDA<ContextDDA>},
+    {"leak", true, runLeakChecker},
+};
+
+/// Run a solver on an input and write its metrics, a "name value" line
+/// each, to fd. Only called in a child process.
+void runChild(const BenchInput &input, const Solver &solver, int fd) {
+    Metrics metrics;
+    double start = PTAStat::getWallClk();
+    if (input.isPAG) {
+        SVFModule::setPagFromTXT(input.file);
+    }
+    std::string file = input.file;
+    SVFProject proj(file);
+    proj.getPAG();
+    double pagEnd = PTAStat::getWallClk();
+    metrics["pag_ms"] = formatMs(pagEnd - start);
+
+    solver.run(&proj, metrics);
+    metrics["solve_ms"] = formatMs(PTAStat::getWallClk() - pagEnd);
+
+    std::ostringstream os;
+    for (const auto &it : metrics) {
+        os << it.first << " " << it.second << "\n";
+    }
+    std::string out = os.str();
+    const char *buf = out.data();
+    size_t left = out.size();
+    while (left > 0) {
+        ssize_t written = write(fd, buf, left);
+        if (written <= 0) {
+            break;
+        }
+        buf += written;
+        left -= written;
+    }
+}
+
+/// Run a solver on an input in a child process
+Metrics runOnce(const BenchInput &input, const Solver &solver) {
+    Metrics metrics;
+    int fds[2];
+    if (pipe(fds) != 0) {
+        metrics["status"] = "failed";
+        return metrics;
+    }
+
+    std::cout.flush();
+    SVFUtil::outs().flush();
+    double start = PTAStat::getWallClk();
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        if (!BenchVerbose) {
+            int devNull = open("/dev/null", O_WRONLY);
+            dup2(devNull, STDOUT_FILENO);
+            dup2(devNull, STDERR_FILENO);
+        }
+        if (BenchTimeout > 0) {
+            alarm(BenchTimeout);
+        }
+        runChild(input, solver, fds[1]);
+        close(fds[1]);
+        _exit(0);
+    }
+    close(fds[1]);
+    if (pid < 0) {
+        close(fds[0]);
+        metrics["status"] = "failed";
+        return metrics;
+    }
+
+    std::string out;
+    char buf[4096];
+    ssize_t len;
+    while ((len = read(fds[0], buf, sizeof(buf))) > 0) {
+        out.append(buf, len);
+    }
+    close(fds[0]);
+
+    int status = 0;
+    struct rusage usage;
+    wait4(pid, &status, 0, &usage);
+    double end = PTAStat::getWallClk();
+
+    std::istringstream is(out);
+    std::string name;
+    std::string value;
+    while (is >> name >> value) {
+        metrics[name] = value;
+    }
+
+    if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+        metrics["status"] = "ok";
+    } else if (WIFSIGNALED(status) && WTERMSIG(status) == SIGALRM) {
+        metrics["status"] = "timeout";
+    } else if (WIFSIGNALED(status)) {
+        metrics["status"] = "crash";
+    } else {
+        metrics["status"] = "failed";
+    }
+    metrics["wall_ms"] = formatMs(end - start);
+    metrics["user_ms"] = formatMs(usage.ru_utime.tv_sec * 1000.0 +
+                                  usage.ru_utime.tv_usec / 1000.0);
+    metrics["sys_ms"] = formatMs(usage.ru_stime.tv_sec * 1000.0 +
+                                 usage.ru_stime.tv_usec / 1000.0);
+#ifdef __APPLE__
+    metrics["peak_rss_kb"] = std::to_string(usage.ru_maxrss / 1024);
+#else
+    metrics["peak_rss_kb"] = std::to_string(usage.ru_maxrss);
+#endif
+    return metrics;
+}
+
+} // End anonymous namespace
+
+int main(int argc, char **argv) {
+
+    int arg_num = 0;
+    char **arg_value = new char *[argc];
+    std::vector<std::string> moduleNameVec;
+    SVFUtil::processArguments(argc, argv, arg_num, arg_value, moduleNameVec);
+    cl::ParseCommandLineOptions(arg_num, arg_value,
+                                "Pointer Analysis Benchmarks\n");
+
+    delete[] arg_value;
+
+    std::vector<BenchInput> inputs;
+    for (const std::string &file : moduleNameVec) {
+        inputs.push_back({file, false});
+    }
+    if (!BenchCorpus.empty()) {
+        std::ifstream corpus(BenchCorpus);
+        if (!corpus.is_open()) {
+            SVFUtil::errs() << "cannot open corpus " << BenchCorpus << "\n";
+            exit(-1);
+        }
+        std::string line;
+        while (std::getline(corpus, line)) {
+            if (!line.empty() && line[0] != '#') {
+                inputs.push_back({line, false});
+            }
+        }
+    }
+    for (const std::string &file : BenchPAGs) {
+        inputs.push_back({file, true});
+    }
+    if (inputs.empty()) {
+        outs() << "Please provide llvm IR files or PAG text files\n";
+        exit(-1);
+    }
+
+    // A solver named more than once is still run once.
+    for (const std::string &name : BenchSolvers) {
+        if (std::none_of(std::begin(solvers), std::end(solvers),
+                         [&](const Solver &solver) {
+                             return solver.name == name;
+                         })) {
+            outs() << "Unknown solver '" << name << "' in -bench-solvers\n";
+            exit(-1);
+        }
+    }
+
+    std::vector<const Solver *> selected;
+    for (const Solver &solver : solvers) {
+        if (BenchSolvers.empty() ||
+            std::find(BenchSolvers.begin(), BenchSolvers.end(),
+                      solver.name) != BenchSolvers.end()) {
+            selected.push_back(&solver);
+        }
+    }
+
+    std::ofstream file;
+    if (!BenchOut.empty()) {
+        file.open(BenchOut);
+        if (!file.is_open()) {
+            SVFUtil::errs() << "cannot write " << BenchOut << "\n";
+            exit(-1);
+        }
+    }
+    std::ostream &out = BenchOut.empty() ? std::cout : file;
+
+    for (u32_t i = 0; i < sizeof(columns) / sizeof(columns[0]); ++i) {
+        out << (i == 0 ? "" : ",") << columns[i];
+    }
+    out << "\n";
+
+    for (const BenchInput &input : inputs) {
+        for (const Solver *solver : selected) {
+            // A PAG text file has no IR to build an SVFG from.
+            if (input.isPAG && solver->needsIR) {
+                continue;
+            }
+
+            for (u32_t run = 0; run < BenchRuns; ++run) {
+                Metrics metrics = runOnce(input, *solver);
+                metrics["input"] = input.file;
+                metrics["solver"] = solver->name;
+                metrics["run"] = std::to_string(run);
+                for (u32_t i = 0; i < sizeof(columns) / sizeof(columns[0]);
+                     ++i) {
+                    out << (i == 0 ? "" : ",")
+                        << csvField(metrics[columns[i]]);
+                }
+                out << std::endl;
+            }
+        }
+    }
+
+    return 0;
+}
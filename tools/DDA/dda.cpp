@@ -7,7 +7,12 @@
 //#include "AliasUtil/AliasAnalysisCounter.h"
 //#include "MemoryModel/ComTypeModel.h"
 #include "DDA/DDAPass.h"
+#include "Graphs/SVFGOPT.h"
 #include "SVF-FE/LLVMUtil.h"
+#include "Util/Serialization.h"
+
+// Registers the graph classes of the SVFG cache (-svfg-cache-dir)
+#include "Util/boost_classes_export.h"
 
 using namespace llvm;
 using namespace SVF;
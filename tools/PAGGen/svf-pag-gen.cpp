@@ -0,0 +1,418 @@
+//===- svf-pag-gen.cpp -- Synthetic PAG generator ---------------------------//
+//
+//                     SVF: Static Value-Flow Analysis
+//
+// Copyright (C) <2013-2017>  <Yulei Sui>
+//
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===-----------------------------------------------------------------------===//
+
+/*
+ // Synthetic PAG generator
+ //
+ // Writes a PAG in the text format of PAGBuilderFromFile, to be loaded with
+ // -graph-txt=<file> or benchmarked with svf-bench -bench-pag=<file>.
+ //
+ // The program has global pointers and objects and a number of functions,
+ // each with formal parameters, a return node, local pointers and local
+ // objects. Every object has its address taken by a pointer of its scope.
+ // Each local pointer gets -gen-density copy, load, store and gep edges on
+ // average from pointers before it in its function, or from a global with
+ // probability -gen-global-ratio; with probability -gen-cycle-ratio a copy
+ // comes from a later pointer instead, which makes cycles. Gep chains are at
+ // most -gen-field-depth deep.
+ //
+ // Each function has -gen-fanout call sites. Callees are skewed towards the
+ // first functions, like the hubs of real call graphs. A direct call passes
+ // each parameter with a call edge and the result with a ret edge. The text
+ // format has no call sites, so an indirect call (-gen-indirect-ratio of the
+ // calls) is modelled by what its resolution leads to: the functions are
+ // grouped into classes of address-taken functions, and calls of a class
+ // store their arguments into, and load their results from, objects shared
+ // by all functions of the class.
+ //
+ // The output only depends on the options (not on the platform), and is
+ // written as it is generated, so its size is not limited by memory.
+ */
+
+#include "SVF-FE/LLVMUtil.h"
+
+#include <fstream>
+#include <random>
+
+using namespace llvm;
+using namespace std;
+using namespace SVF;
+
+static llvm::cl::opt<std::string>
+    OutputFilename("o", llvm::cl::init("pag.txt"),
+                   llvm::cl::desc("Output PAG text file"));
+
+static llvm::cl::opt<unsigned long long>
+    GenNodes("gen-nodes", llvm::cl::init(100000),
+             llvm::cl::desc("Number of nodes (approximately)"));
+
+static llvm::cl::opt<unsigned>
+    GenFunctions("gen-functions", llvm::cl::init(0),
+                 llvm::cl::desc("Number of functions (0: one per 50 nodes)"));
+
+static llvm::cl::opt<unsigned>
+    GenParams("gen-params", llvm::cl::init(2),
+              llvm::cl::desc("Formal parameters of each function"));
+
+static llvm::cl::opt<double>
+    GenObjRatio("gen-obj-ratio", llvm::cl::init(0.25),
+                llvm::cl::desc("Fraction of the nodes which are objects"));
+
+static llvm::cl::opt<double> GenDensity(
+    "gen-density", llvm::cl::init(1.5),
+    llvm::cl::desc("Copy, load, store and gep edges per local pointer"));
+
+static llvm::cl::opt<double>
+    GenGlobalRatio("gen-global-ratio", llvm::cl::init(0.05),
+                   llvm::cl::desc("Fraction of the nodes which are globals, "
+                                  "and of the edges which use them"));
+
+static llvm::cl::opt<unsigned>
+    GenFanout("gen-fanout", llvm::cl::init(4),
+              llvm::cl::desc("Call sites of each function"));
+
+static llvm::cl::opt<double>
+    GenIndirectRatio("gen-indirect-ratio", llvm::cl::init(0.1),
+                     llvm::cl::desc("Fraction of the calls which are "
+                                    "indirect"));
+
+static llvm::cl::opt<unsigned> GenIndirectClasses(
+    "gen-indirect-classes", llvm::cl::init(0),
+    llvm::cl::desc("Classes of indirect call targets (0: one per 100 "
+                   "functions)"));
+
+static llvm::cl::opt<unsigned>
+    GenFieldDepth("gen-field-depth", llvm::cl::init(2),
+                  llvm::cl::desc("Maximum length of gep chains"));
+
+static llvm::cl::opt<unsigned>
+    GenMaxOffset("gen-max-offset", llvm::cl::init(8),
+                 llvm::cl::desc("Gep offsets are below this"));
+
+static llvm::cl::opt<double> GenCycleRatio(
+    "gen-cycle-ratio", llvm::cl::init(0.05),
+    llvm::cl::desc("Fraction of the copy edges which go backwards"));
+
+static llvm::cl::opt<unsigned long long>
+    GenSeed("gen-seed", llvm::cl::init(1), llvm::cl::desc("Random seed"));
+
+namespace {
+
+/// The first ID after the special nodes
+const NodeID firstNodeId = 4;
+
+enum EdgeKind { Addr, Copy, Load, Store, Gep, Call, Ret, NumOfEdgeKinds };
+
+const char *edgeKindNames[NumOfEdgeKinds] = {"addr", "copy", "load", "store",
+                                             "gep",  "call", "ret"};
+
+/// Node ID ranges of the program
+struct Layout {
+    NodeID globalPtrs;
+    NodeID numOfGlobalPtrs;
+    NodeID globalObjs;
+    NodeID numOfGlobalObjs;
+    /// Per class: argument pointer, argument object, result pointer and
+    /// result object
+    NodeID dispatch;
+    u32_t numOfClasses;
+    NodeID functions;
+    u32_t numOfFunctions;
+    /// Per function: parameters, return, local pointers, local objects
+    NodeID funSize;
+    NodeID numOfLocalPtrs;
+    NodeID numOfLocalObjs;
+
+    inline NodeID funBase(u32_t f) const { return functions + f * funSize; }
+    inline NodeID param(u32_t f, u32_t i) const { return funBase(f) + i; }
+    inline NodeID ret(u32_t f) const { return funBase(f) + GenParams; }
+    /// Local pointers are numbered after the parameters and the return
+    inline NodeID localPtr(u32_t f, NodeID i) const {
+        return funBase(f) + GenParams + 1 + i;
+    }
+    inline NodeID localObj(u32_t f, NodeID i) const {
+        return funBase(f) + GenParams + 1 + numOfLocalPtrs + i;
+    }
+    inline NodeID end() const { return funBase(numOfFunctions); }
+};
+
+class PAGGenerator {
+  public:
+    PAGGenerator(std::ostream &out, const Layout &layout)
+        : out(out), layout(layout), rng(GenSeed) {}
+
+    void generate();
+
+    inline u64_t getNumOfEdges(EdgeKind kind) const {
+        return numOfEdges[kind];
+    }
+
+  private:
+    std::ostream &out;
+    const Layout &layout;
+    std::mt19937_64 rng;
+    u64_t numOfEdges[NumOfEdgeKinds] = {};
+    /// Gep depth of the local pointers of the current function
+    std::vector<u32_t> depth;
+
+    /// Random numbers. Only the raw output of the engine is used, which is
+    /// the same everywhere, unlike std's distributions.
+    //@{
+    inline u64_t below(u64_t n) { return rng() % n; }
+    inline double uniform() { return (rng() >> 11) / 9007199254740992.0; }
+    inline bool chance(double p) { return uniform() < p; }
+    //@}
+
+    void edge(NodeID src, EdgeKind kind, NodeID dst, u32_t offset = 0) {
+        out << src << " " << edgeKindNames[kind] << " " << dst << " "
+            << offset << "\n";
+        numOfEdges[kind]++;
+    }
+
+    inline NodeID globalPtr() {
+        return layout.globalPtrs + below(layout.numOfGlobalPtrs);
+    }
+
+    /// A pointer of f which comes before its i-th local pointer (a
+    /// parameter or an earlier local), or a global
+    NodeID earlierPtr(u32_t f, NodeID i);
+
+    void generateNodes();
+    void generateGlobals();
+    void generateFunction(u32_t f);
+    void generateLocalEdges(u32_t f, NodeID i);
+    void generateCall(u32_t caller, NodeID callee);
+};
+
+void PAGGenerator::generate() {
+    generateNodes();
+    generateGlobals();
+    for (u32_t f = 0; f < layout.numOfFunctions; ++f) {
+        generateFunction(f);
+    }
+}
+
+void PAGGenerator::generateNodes() {
+    auto nodes = [this](NodeID begin, NodeID num, const char *kind) {
+        for (NodeID id = begin; id < begin + num; ++id) {
+            out << id << " " << kind << "\n";
+        }
+    };
+
+    nodes(layout.globalPtrs, layout.numOfGlobalPtrs, "v");
+    nodes(layout.globalObjs, layout.numOfGlobalObjs, "o");
+    for (u32_t c = 0; c < layout.numOfClasses; ++c) {
+        NodeID base = layout.dispatch + 4 * c;
+        nodes(base, 1, "v");
+        nodes(base + 1, 1, "o");
+        nodes(base + 2, 1, "v");
+        nodes(base + 3, 1, "o");
+    }
+    for (u32_t f = 0; f < layout.numOfFunctions; ++f) {
+        nodes(layout.funBase(f), GenParams + 1 + layout.numOfLocalPtrs, "v");
+        nodes(layout.localObj(f, 0), layout.numOfLocalObjs, "o");
+    }
+}
+
+void PAGGenerator::generateGlobals() {
+    for (NodeID i = 0; i < layout.numOfGlobalObjs; ++i) {
+        edge(layout.globalObjs + i, Addr, globalPtr());
+    }
+    for (u32_t c = 0; c < layout.numOfClasses; ++c) {
+        NodeID base = layout.dispatch + 4 * c;
+        edge(base + 1, Addr, base);
+        edge(base + 3, Addr, base + 2);
+    }
+    // Globals initialised from each other
+    for (NodeID i = 0; i < layout.numOfGlobalPtrs; ++i) {
+        if (chance(GenDensity / 4)) {
+            edge(globalPtr(), Copy, layout.globalPtrs + i);
+        }
+    }
+}
+
+NodeID PAGGenerator::earlierPtr(u32_t f, NodeID i) {
+    if (chance(GenGlobalRatio)) {
+        return globalPtr();
+    }
+
+    NodeID k = below(GenParams + i + (GenParams + i == 0 ? 1 : 0));
+    if (k < GenParams) {
+        return layout.param(f, k);
+    }
+    return layout.localPtr(f, k - GenParams);
+}
+
+void PAGGenerator::generateFunction(u32_t f) {
+    depth.assign(layout.numOfLocalPtrs, 0);
+
+    for (NodeID i = 0; i < layout.numOfLocalObjs; ++i) {
+        NodeID ptr = layout.localPtr(f, below(layout.numOfLocalPtrs));
+        edge(layout.localObj(f, i), Addr, ptr);
+    }
+    for (NodeID i = 0; i < layout.numOfLocalPtrs; ++i) {
+        generateLocalEdges(f, i);
+    }
+    // Results flow from the last locals
+    edge(layout.localPtr(f, layout.numOfLocalPtrs - 1), Copy,
+         layout.ret(f));
+
+    for (u32_t c = 0; c < GenFanout; ++c) {
+        // Squaring skews callees towards the first functions.
+        double u = uniform();
+        NodeID callee = u * u * layout.numOfFunctions;
+        if (chance(GenIndirectRatio)) {
+            // Call through the class of the callee
+            NodeID base = layout.dispatch + 4 * (callee % layout.numOfClasses);
+            edge(earlierPtr(f, layout.numOfLocalPtrs), Store, base);
+            edge(base + 2, Load, layout.localPtr(f, below(
+                                       layout.numOfLocalPtrs)));
+        } else {
+            generateCall(f, callee);
+        }
+    }
+
+    // Every fourth function of a class is address-taken (the first always),
+    // and reads its arguments from and writes its result to the class's
+    // objects.
+    if ((f / layout.numOfClasses) % 4 == 0) {
+        NodeID base = layout.dispatch + 4 * (f % layout.numOfClasses);
+        for (u32_t i = 0; i < GenParams; ++i) {
+            edge(base, Load, layout.param(f, i));
+        }
+        edge(layout.ret(f), Store, base + 2);
+    }
+}
+
+void PAGGenerator::generateLocalEdges(u32_t f, NodeID i) {
+    NodeID ptr = layout.localPtr(f, i);
+    u32_t numOfEdges = GenDensity;
+    if (chance(GenDensity - numOfEdges)) {
+        numOfEdges++;
+    }
+
+    for (u32_t e = 0; e < numOfEdges; ++e) {
+        double kind = uniform();
+        if (kind < 0.5) {
+            NodeID src;
+            if (i + 1 < layout.numOfLocalPtrs && chance(GenCycleRatio)) {
+                src = layout.localPtr(
+                    f, i + 1 + below(layout.numOfLocalPtrs - i - 1));
+            } else {
+                src = earlierPtr(f, i);
+            }
+            edge(src, Copy, ptr);
+        } else if (kind < 0.7) {
+            edge(earlierPtr(f, i), Load, ptr);
+        } else if (kind < 0.9) {
+            edge(ptr, Store, earlierPtr(f, i));
+        } else {
+            // Only chains of locals have a known depth.
+            NodeID k = i == 0 ? 0 : below(i);
+            if (i > 0 && depth[k] < GenFieldDepth && GenMaxOffset > 0) {
+                depth[i] = depth[k] + 1;
+                edge(layout.localPtr(f, k), Gep, ptr, below(GenMaxOffset));
+            } else {
+                edge(earlierPtr(f, i), Copy, ptr);
+            }
+        }
+    }
+}
+
+void PAGGenerator::generateCall(u32_t caller, NodeID callee) {
+    for (u32_t i = 0; i < GenParams; ++i) {
+        NodeID actual = earlierPtr(caller, layout.numOfLocalPtrs);
+        edge(actual, Call, layout.param(callee, i));
+    }
+    NodeID result = layout.localPtr(caller, below(layout.numOfLocalPtrs));
+    edge(layout.ret(callee), Ret, result);
+}
+
+} // End anonymous namespace
+
+int main(int argc, char **argv) {
+
+    int arg_num = 0;
+    char **arg_value = new char *[argc];
+    std::vector<std::string> moduleNameVec;
+    SVFUtil::processArguments(argc, argv, arg_num, arg_value, moduleNameVec);
+    cl::ParseCommandLineOptions(arg_num, arg_value,
+                                "Synthetic PAG Generator\n");
+
+    delete[] arg_value;
+
+    u32_t numOfFunctions = GenFunctions;
+    if (numOfFunctions == 0) {
+        numOfFunctions = std::max<u64_t>(1, GenNodes / 50);
+    }
+    u32_t numOfClasses = GenIndirectClasses;
+    if (numOfClasses == 0) {
+        numOfClasses = std::max<u32_t>(1, numOfFunctions / 100);
+    }
+
+    Layout layout;
+    u64_t numOfGlobals = GenNodes * GenGlobalRatio;
+    layout.globalPtrs = firstNodeId;
+    layout.numOfGlobalPtrs =
+        std::max<u64_t>(1, numOfGlobals - numOfGlobals * GenObjRatio);
+    layout.globalObjs = layout.globalPtrs + layout.numOfGlobalPtrs;
+    layout.numOfGlobalObjs = numOfGlobals * GenObjRatio;
+    layout.dispatch = layout.globalObjs + layout.numOfGlobalObjs;
+    layout.numOfClasses = numOfClasses;
+    layout.functions = layout.dispatch + 4 * numOfClasses;
+    layout.numOfFunctions = numOfFunctions;
+
+    // Each function needs its parameters, return and a local pointer.
+    u64_t numOfLocals = GenNodes > layout.functions
+                            ? (GenNodes - layout.functions) / numOfFunctions
+                            : 0;
+    numOfLocals = std::max<u64_t>(numOfLocals, GenParams + 2) - GenParams - 1;
+    layout.numOfLocalObjs =
+        std::min<u64_t>(numOfLocals - 1, numOfLocals * GenObjRatio);
+    layout.numOfLocalPtrs = numOfLocals - layout.numOfLocalObjs;
+    layout.funSize = GenParams + 1 + numOfLocals;
+    if ((u64_t)layout.funSize * numOfFunctions + layout.functions >=
+        UINT_MAX) {
+        SVFUtil::errs() << "too many nodes\n";
+        exit(-1);
+    }
+
+    std::ofstream out(OutputFilename);
+    if (!out.is_open()) {
+        SVFUtil::errs() << "cannot write " << OutputFilename << "\n";
+        exit(-1);
+    }
+
+    PAGGenerator generator(out, layout);
+    generator.generate();
+    out.close();
+
+    outs() << "nodes: " << layout.end() - firstNodeId
+           << ", functions: " << numOfFunctions << ", edges:";
+    for (u32_t kind = 0; kind < NumOfEdgeKinds; ++kind) {
+        outs() << " " << edgeKindNames[kind] << " "
+               << generator.getNumOfEdges((EdgeKind)kind);
+    }
+    outs() << "\n";
+
+    return 0;
+}
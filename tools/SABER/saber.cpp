@@ -27,11 +27,16 @@
  // Author: Yulei Sui,
  */
 
+#include "Graphs/SVFGOPT.h"
 #include "SABER/DoubleFreeChecker.h"
 #include "SABER/FileChecker.h"
 #include "SABER/LeakChecker.h"
 #include "SVF-FE/LLVMUtil.h"
 #include "SVF-FE/PAGBuilder.h"
+#include "Util/Serialization.h"
+
+// Registers the graph classes of the SVFG cache (-svfg-cache-dir)
+#include "Util/boost_classes_export.h"
 
 using namespace llvm;
 using namespace SVF;
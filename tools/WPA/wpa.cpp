@@ -26,9 +26,14 @@
  // Author: Yulei Sui,
  */
 
+#include "Graphs/SVFGOPT.h"
 #include "SVF-FE/LLVMUtil.h"
+#include "Util/Serialization.h"
 #include "WPA/WPAPass.h"
 
+// Registers the graph classes of the SVFG cache (-svfg-cache-dir)
+#include "Util/boost_classes_export.h"
+
 using namespace llvm;
 using namespace std;
 using namespace SVF;
@@ -0,0 +1,71 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#include "Util/FlatSet.h"
+#include "Util/SVFBasicTypes.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace std;
+using namespace SVF;
+
+TEST(FlatSetTest, SetOperations_0) {
+    FlatSet<u32_t> set;
+    ASSERT_TRUE(set.empty());
+
+    ASSERT_TRUE(set.insert(5).second);
+    ASSERT_TRUE(set.insert(1).second);
+    ASSERT_TRUE(set.insert(3).second);
+    ASSERT_FALSE(set.insert(3).second);
+    ASSERT_EQ(*set.insert(1).first, 1u);
+    ASSERT_EQ(set.size(), 3u);
+
+    ASSERT_EQ(set.count(3), 1u);
+    ASSERT_EQ(set.count(4), 0u);
+    ASSERT_EQ(set.find(4), set.end());
+    ASSERT_EQ(*set.find(5), 5u);
+
+    ASSERT_EQ(set.erase(4), 0u);
+    ASSERT_EQ(set.erase(1), 1u);
+    ASSERT_EQ(set.erase(1), 0u);
+    ASSERT_EQ(vector<u32_t>(set.begin(), set.end()), vector<u32_t>({3, 5}));
+
+    set.clear();
+    ASSERT_TRUE(set.empty());
+}
+
+TEST(FlatSetTest, OrderedSetOrder_0) {
+    // Iterates in the same order as an OrderedSet with the same comparator.
+    FlatSet<u32_t, greater<u32_t>> set;
+    OrderedSet<u32_t, greater<u32_t>> orderedSet;
+    for (u32_t i = 0; i < 1000; ++i) {
+        u32_t key = (i * 7919) % 257;
+        ASSERT_EQ(set.insert(key).second, orderedSet.insert(key).second);
+        if (i % 3 == 0) {
+            ASSERT_EQ(set.erase(i % 100), orderedSet.erase(i % 100));
+        }
+    }
+
+    ASSERT_EQ(vector<u32_t>(set.begin(), set.end()),
+              vector<u32_t>(orderedSet.begin(), orderedSet.end()));
+}
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,99 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#include "Util/WorkList.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace std;
+using namespace SVF;
+
+static vector<NodeID> popAll(NodeWorkList &worklist) {
+    vector<NodeID> popped;
+    while (!worklist.empty()) {
+        popped.push_back(worklist.pop());
+    }
+    return popped;
+}
+
+TEST(NodeWorkListTest, FIFO_0) {
+    // Grows the ring buffer while it wraps around.
+    NodeWorkList worklist;
+    FIFOWorkList<NodeID> expected;
+    for (NodeID i = 0; i < 1000; ++i) {
+        NodeID id = (i * 7919) % 301;
+        ASSERT_EQ(worklist.push(id), expected.push(id));
+        ASSERT_TRUE(worklist.find(id));
+        if (i % 3 == 0) {
+            ASSERT_EQ(worklist.pop(), expected.pop());
+        }
+    }
+    while (!expected.empty()) {
+        ASSERT_EQ(worklist.pop(), expected.pop());
+    }
+    ASSERT_TRUE(worklist.empty());
+    ASSERT_FALSE(worklist.find(0));
+}
+
+TEST(NodeWorkListTest, LRF_0) {
+    NodeWorkList worklist(NodeWorkList::Order::LRF);
+    for (NodeID id : {3, 1, 2}) {
+        worklist.push(id);
+    }
+    // Nodes which never fired come first, by ID.
+    ASSERT_EQ(worklist.pop(), 1u);
+    ASSERT_EQ(worklist.pop(), 2u);
+    worklist.push(1);
+    worklist.push(4);
+    ASSERT_EQ(popAll(worklist), vector<NodeID>({3, 4, 1}));
+}
+
+TEST(NodeWorkListTest, TwoPhaseTopo_0) {
+    NodeWorkList worklist(NodeWorkList::Order::TOPO);
+    for (NodeID id = 0; id < 5; ++id) {
+        worklist.setRank(id, 4 - id);
+    }
+    worklist.push(1);
+    worklist.push(3);
+    ASSERT_EQ(worklist.pop(), 3u);
+    // Later in topological order: this phase; earlier: the next one.
+    worklist.push(0);
+    worklist.push(4);
+    ASSERT_EQ(popAll(worklist), vector<NodeID>({1, 0, 4}));
+}
+
+TEST(NodeWorkListTest, Priority_0) {
+    NodeWorkList worklist(NodeWorkList::Order::PRIO);
+    worklist.setRank(5, 1);
+    worklist.setRank(6, 0);
+    worklist.push(7); // unranked
+    worklist.push(5);
+    worklist.push(6);
+    ASSERT_FALSE(worklist.push(5));
+    ASSERT_EQ(popAll(worklist), vector<NodeID>({6, 5, 7}));
+
+    worklist.push(5);
+    worklist.clear();
+    ASSERT_TRUE(worklist.empty());
+    ASSERT_FALSE(worklist.find(5));
+}
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,92 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#include "DDA/DDAPass.h"
+#include "SVF-FE/LLVMModule.h"
+#include "SVF-FE/SVFProject.h"
+
+#include "Tests/Options.hpp"
+#include "config.h"
+#include "gtest/gtest.h"
+
+#include <llvm/IR/InstIterator.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace SVF;
+
+/// Up to max pointer values of proj with a PAG node, in program order
+static vector<const Value *> collectPointers(SVFProject &proj, size_t max) {
+    PAG *pag = proj.getPAG();
+    vector<const Value *> ptrs;
+    for (const Function &fun : *proj.getLLVMModSet()->getModule(0)) {
+        for (const Instruction &inst : llvm::instructions(fun)) {
+            if (ptrs.size() < max && inst.getType()->isPointerTy() &&
+                pag->hasValueNode(&inst)) {
+                ptrs.push_back(&inst);
+            }
+        }
+    }
+    return ptrs;
+}
+
+TEST(DDAPassTest, BatchAliasTest_0) {
+    string ll_file = SVF_BUILD_DIR "tests/ICFG/virt_call_test_cpp.ll";
+    Options::DDASelected.addValue(PointerAnalysis::Cxt_DDA);
+    // Node 0 is not a valid pointer, so no query is answered up front.
+    OptionGuard guard(Options::UserInputQuery, "0");
+
+    SVFProject proj(ll_file);
+    vector<const Value *> ptrs = collectPointers(proj, 8);
+    ASSERT_GE(ptrs.size(), 3u);
+
+    // Every pair in both orders, including a pointer with itself.
+    vector<DDAPass::ValuePair> queries;
+    for (const Value *p : ptrs) {
+        for (const Value *q : ptrs) {
+            queries.push_back(make_pair(p, q));
+        }
+    }
+    // Duplicates of earlier queries, and a value without a PAG node.
+    queries.push_back(queries[1]);
+    queries.push_back(queries.front());
+    const Value *notPtr = llvm::ConstantInt::get(
+        llvm::Type::getInt32Ty(proj.getLLVMModSet()->getContext()), 7);
+    queries.push_back(make_pair(ptrs[0], notPtr));
+    queries.push_back(queries[2]);
+
+    vector<AliasResult> batch;
+    {
+        DDAPass pass;
+        pass.runOnModule(&proj);
+        pass.alias(queries, batch);
+    }
+    ASSERT_EQ(batch.size(), queries.size());
+
+    DDAPass pass;
+    pass.runOnModule(&proj);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        ASSERT_EQ(batch[i], pass.alias(queries[i].first, queries[i].second))
+            << "query " << i;
+    }
+    ASSERT_EQ(batch[queries.size() - 2], llvm::MayAlias);
+}
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,70 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#include "DDA/DDAQueryCache.h"
+
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace SVF;
+
+using Cache = DDAQueryCache<NodeID>;
+
+TEST(DDAQueryCacheTest, LRUTest_0) {
+    Cache cache(3);
+    cache.add(1);
+    cache.add(2);
+    cache.add(3);
+    ASSERT_EQ(cache.lookup(4), Cache::Miss);
+    // 1 becomes the most recently used entry.
+    ASSERT_EQ(cache.lookup(1), Cache::Hit);
+
+    cache.add(4);
+    cache.add(5);
+    Cache::DPImList evicted;
+    cache.shrink(evicted);
+    ASSERT_EQ(evicted, Cache::DPImList({2, 3}));
+    ASSERT_EQ(cache.size(), 3u);
+    ASSERT_EQ(cache.lookup(2), Cache::Miss);
+    ASSERT_EQ(cache.lookup(1), Cache::Hit);
+
+    cache.erase(1);
+    ASSERT_EQ(cache.lookup(1), Cache::Miss);
+    ASSERT_EQ(cache.size(), 2u);
+}
+
+TEST(DDAQueryCacheTest, InvalidateTest_0) {
+    Cache cache;
+    for (NodeID i = 0; i < 100; ++i) {
+        cache.add(i);
+    }
+    Cache::DPImList evicted;
+    cache.shrink(evicted);
+    ASSERT_TRUE(evicted.empty());
+
+    cache.invalidate();
+    ASSERT_EQ(cache.lookup(7), Cache::Stale);
+    // Adding a stale entry again refreshes it.
+    cache.add(7);
+    ASSERT_EQ(cache.lookup(7), Cache::Hit);
+    ASSERT_EQ(cache.lookup(8), Cache::Stale);
+    ASSERT_EQ(cache.size(), 100u);
+}
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,116 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#include "Tests/Graphs/TestGraph.hpp"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace std;
+using namespace SVF;
+
+/// The frozen edges of every node must be its edge sets, in order.
+static void checkFrozenEdges(TestGraph *g) {
+    for (const auto &it : *g) {
+        const TestGraphNode *node = it.second;
+        ASSERT_EQ(g->getGNode(it.first), node);
+
+        vector<TestGraphEdge *> outEdges(node->OutEdgeBegin(),
+                                         node->OutEdgeEnd());
+        vector<TestGraphEdge *> frozenOutEdges;
+        for (TestGraphEdge *edge : g->getFrozenOutEdges(it.first)) {
+            frozenOutEdges.push_back(edge);
+        }
+        ASSERT_EQ(frozenOutEdges, outEdges);
+
+        vector<TestGraphEdge *> inEdges(node->InEdgeBegin(),
+                                        node->InEdgeEnd());
+        vector<TestGraphEdge *> frozenInEdges;
+        for (TestGraphEdge *edge : g->getFrozenInEdges(it.first)) {
+            frozenInEdges.push_back(edge);
+        }
+        ASSERT_EQ(frozenInEdges, inEdges);
+    }
+}
+
+TEST(FrozenGraphTestSuite, Freeze_0) {
+    MapGraph _graph = {{1, {2, 3}}, {2, {3, 5}}, {3, {1}}, {5, {}}};
+    TestGraphSPtr g = buildTestGraph(_graph);
+
+    g->freeze();
+    ASSERT_TRUE(g->isFrozen());
+    checkFrozenEdges(g.get());
+
+    ASSERT_TRUE(g->hasGNode(5));
+    ASSERT_FALSE(g->hasGNode(4));
+    ASSERT_FALSE(g->hasGNode(100));
+    ASSERT_EQ(g->getFrozenOutEdges(4).begin(), g->getFrozenOutEdges(4).end());
+}
+
+TEST(FrozenGraphTestSuite, Mutation_0) {
+    MapGraph _graph = {{1, {2}}, {2, {3}}};
+    TestGraphSPtr g = buildTestGraph(_graph);
+    g->freeze();
+
+    // New nodes are indexed, new edges unfreeze the graph.
+    auto *node = new TestGraphNode(7);
+    g->addGNode(node);
+    ASSERT_FALSE(g->isFrozen());
+    ASSERT_TRUE(g->hasGNode(7));
+    ASSERT_EQ(g->getGNode(7), node);
+
+    g->freeze();
+    auto *edge = new TestGraphEdge(g->getGNode(3), node, g->getNextEdgeId());
+    g->addGEdge(edge);
+    ASSERT_FALSE(g->isFrozen());
+
+    g->freeze();
+    checkFrozenEdges(g.get());
+
+    g->removeGEdgeAndDelete(edge);
+    ASSERT_FALSE(g->isFrozen());
+    g->removeGNodeAndDelete(7);
+    ASSERT_FALSE(g->hasGNode(7));
+
+    g->freeze();
+    checkFrozenEdges(g.get());
+}
+
+TEST(FrozenGraphTestSuite, RemoveAllEdges_0) {
+    MapGraph _graph = {{1, {2}}, {2, {2, 3, 4}}, {3, {2}}, {4, {}}};
+    TestGraphSPtr g = buildTestGraph(_graph);
+    g->freeze();
+
+    // Edges of node 2 go, including its self cycle; others are kept.
+    g->removeAllGEdgesAndDelete(g->getGNode(2));
+    ASSERT_FALSE(g->isFrozen());
+    ASSERT_FALSE(g->getGNode(2)->hasIncomingEdge());
+    ASSERT_FALSE(g->getGNode(2)->hasOutgoingEdge());
+    ASSERT_FALSE(g->getGNode(1)->hasOutgoingEdge());
+    ASSERT_FALSE(g->getGNode(3)->hasOutgoingEdge());
+    ASSERT_FALSE(g->getGNode(4)->hasIncomingEdge());
+    ASSERT_EQ(g->getTotalEdgeNum(), 0u);
+
+    g->removeGNodeAndDelete(2);
+    g->freeze();
+    checkFrozenEdges(g.get());
+}
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
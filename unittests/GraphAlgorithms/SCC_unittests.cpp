@@ -103,6 +103,145 @@ TEST(SCCTestSuite, Simple_0) {
     }
 }
 
+/// The SCCs found by scc must be the ones of _graph, and the topological
+/// stack must pop the rep of an edge's source before the one of its target.
+static void check_sccs(TestGraph *g, TestGraphSCC &scc) {
+    // Reference partition: u and v are in one SCC iff each reaches the other
+    map<NodeID, set<NodeID>> reach;
+    for (const auto &it : *g) {
+        vector<NodeID> worklist = {it.first};
+        set<NodeID> &r = reach[it.first];
+        while (!worklist.empty()) {
+            NodeID n = worklist.back();
+            worklist.pop_back();
+            for (auto e = g->getGNode(n)->OutEdgeBegin(),
+                      ee = g->getGNode(n)->OutEdgeEnd();
+                 e != ee; ++e) {
+                if (r.insert((*e)->getDstID()).second) {
+                    worklist.push_back((*e)->getDstID());
+                }
+            }
+        }
+    }
+
+    u32_t numOfSCCs = 0;
+    for (const auto &u : *g) {
+        NodeID rep = scc.repNode(u.first);
+        ASSERT_TRUE(scc.getRepNodes().test(rep));
+        ASSERT_TRUE(scc.subNodes(rep).test(u.first));
+        numOfSCCs += rep == u.first;
+        for (const auto &v : *g) {
+            bool same = u.first == v.first ||
+                        (reach[u.first].count(v.first) &&
+                         reach[v.first].count(u.first));
+            ASSERT_EQ(same, rep == scc.repNode(v.first));
+        }
+    }
+    ASSERT_EQ(scc.getRepNodes().count(), numOfSCCs);
+
+    map<NodeID, u32_t> popped;
+    auto &nodeStack = scc.topoNodeStack();
+    while (!nodeStack.empty()) {
+        ASSERT_EQ(popped.count(nodeStack.top()), 0u);
+        popped[nodeStack.top()] = popped.size();
+        nodeStack.pop();
+    }
+    ASSERT_EQ(popped.size(), numOfSCCs);
+    for (const auto &it : *g) {
+        for (auto e = it.second->OutEdgeBegin(); e != it.second->OutEdgeEnd();
+             ++e) {
+            NodeID src = scc.repNode(it.first);
+            NodeID dst = scc.repNode((*e)->getDstID());
+            ASSERT_TRUE(src == dst || popped[src] < popped[dst]);
+        }
+    }
+}
+
+/// A graph of n nodes with pseudo-random edges
+static MapGraph random_graph(NodeID n, u32_t numOfEdges, u32_t seed) {
+    MapGraph _graph;
+    for (NodeID i = 1; i <= n; ++i) {
+        _graph[i];
+    }
+    for (u32_t i = 0; i < numOfEdges; ++i) {
+        seed = seed * 1103515245 + 12345;
+        NodeID src = (seed >> 8) % n + 1;
+        seed = seed * 1103515245 + 12345;
+        NodeID dst = (seed >> 8) % n + 1;
+        _graph[src].insert(dst);
+    }
+    return _graph;
+}
+
+TEST(SCCTestSuite, Parallel_0) {
+    for (u32_t seed = 0; seed < 20; ++seed) {
+        TestGraphSPtr g = buildTestGraph(random_graph(60, 80 + seed * 4, seed));
+        TestGraphSCC scc(g.get());
+        scc.setNumOfThreads(4);
+        scc.find();
+        check_sccs(g.get(), scc);
+    }
+}
+
+TEST(SCCTestSuite, DeepGraph_0) {
+    // A chain far deeper than a recursive visit could handle, closed into
+    // a cycle from node 100000 on
+    const NodeID n = 200000;
+    MapGraph chain;
+    for (NodeID i = 1; i < n; ++i) {
+        chain[i] = {i + 1};
+    }
+    chain[n] = {100000};
+    TestGraphSPtr g = buildTestGraph(chain);
+
+    for (unsigned threads : {1, 4}) {
+        TestGraphSCC scc(g.get());
+        scc.setNumOfThreads(threads);
+        scc.find();
+        ASSERT_EQ(scc.getRepNodes().count(), 100000u);
+        ASSERT_TRUE(scc.isInCycle(n));
+        ASSERT_FALSE(scc.isInCycle(99999));
+        ASSERT_EQ(scc.topoNodeStack().top(), 1u);
+    }
+}
+
+TEST(SCCTestSuite, Incremental_0) {
+    for (u32_t seed = 0; seed < 20; ++seed) {
+        MapGraph _graph = random_graph(60, 50, seed);
+        TestGraphSPtr g = buildTestGraph(_graph);
+        TestGraphSCC scc(g.get());
+        scc.findIncremental(NodeBS());
+        check_sccs(g.get(), scc);
+
+        // Add edges and nodes, one batch at a time
+        MapGraph more = random_graph(70, 30, seed + 100);
+        for (u32_t batch = 0; batch < 3; ++batch) {
+            NodeBS srcs;
+            for (const auto &it : more) {
+                if (it.first % 3 != batch) {
+                    continue;
+                }
+                for (NodeID dst : it.second) {
+                    if (!_graph[it.first].insert(dst).second) {
+                        continue;
+                    }
+                    for (NodeID n : {it.first, dst}) {
+                        if (!g->hasGNode(n)) {
+                            g->addGNode(new TestGraphNode(n));
+                        }
+                    }
+                    g->addGEdge(new TestGraphEdge(g->getGNode(it.first),
+                                                  g->getGNode(dst),
+                                                  g->getNextEdgeId()));
+                    srcs.set(it.first);
+                }
+            }
+            scc.findIncremental(srcs);
+            check_sccs(g.get(), scc);
+        }
+    }
+}
+
 int main(int argc, char *argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -122,6 +122,34 @@ TEST_F(ICFGTestSuite, VirtTest_1) {
     // icfg->view();
 }
 
+TEST_F(ICFGTestSuite, RemoveEdgeTest_0) {
+    string test_bc = SVF_BUILD_DIR "tests/ICFG/static_call_test_cpp.ll";
+    init(test_bc);
+
+    unique_ptr<ICFG> icfg = make_unique<ICFG>(p_proj->getPAG());
+    icfg->freeze();
+    ASSERT_TRUE(icfg->isFrozen());
+
+    ICFGEdge *edge = nullptr;
+    for (auto &it : *icfg) {
+        if (it.second->hasOutgoingEdge()) {
+            edge = *it.second->OutEdgeBegin();
+            break;
+        }
+    }
+    ASSERT_NE(edge, nullptr);
+    ICFGNode *src = edge->getSrcNode();
+    EdgeID id = edge->getId();
+    u32_t numOfOutEdges = src->getOutEdges().size();
+
+    // Removing an edge unfreezes the ICFG, so that traversals do not see
+    // it anymore.
+    icfg->removeICFGEdge(edge);
+    ASSERT_FALSE(icfg->isFrozen());
+    ASSERT_EQ(icfg->getGEdge(id), nullptr);
+    ASSERT_EQ(src->getOutEdges().size(), numOfOutEdges - 1);
+}
+
 #if 0
 TEST_F(ICFGTestSuite, WebGL_TEST_0) {
     string test_bc = SVF_SRC_DIR
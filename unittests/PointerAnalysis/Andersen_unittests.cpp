@@ -19,8 +19,14 @@
  *     2021-05-12
  *****************************************************************************/
 
+#include "SVF-FE/LLVMModule.h"
 #include "SVF-FE/SVFProject.h"
+#include "Util/Options.h"
 #include "WPA/Andersen.h"
+#include "WPA/AndersenSFR.h"
+#include "WPA/Steensgaard.h"
+
+#include "Tests/Options.hpp"
 
 #include "config.h"
 #include "gtest/gtest.h"
@@ -45,6 +51,267 @@ TEST_F(AndersenTestSuite, StaticCallTest_0) {
     delete anderWD;
 }
 
+TEST_F(AndersenTestSuite, SteensgaardBoundTest_0) {
+    // Steensgaard's classes bound Andersen's points-to sets, so it never
+    // finds no-alias where Andersen finds may-alias.
+    string test_bc = SVF_BUILD_DIR "tests/ICFG/static_call_test_cpp.ll";
+    unique_ptr<SVFProject> proj = make_unique<SVFProject>(test_bc);
+    unique_ptr<Steensgaard> steens = make_unique<Steensgaard>(proj.get());
+    steens->analyze();
+    AndersenWaveDiff *anderWD =
+        AndersenWaveDiff::createAndersenWaveDiff(proj.get());
+
+    SteensgaardSolver solver(steens->getConstraintGraph(),
+                             proj->getSVFModule());
+    solver.solve();
+    for (NodeID p : anderWD->getAllValidPtrs()) {
+        if (!anderWD->getPts(p).empty()) {
+            ASSERT_TRUE(solver.mayPointToObjs(p));
+        }
+        for (NodeID q : anderWD->getAllValidPtrs()) {
+            if (anderWD->alias(p, q) == llvm::MayAlias) {
+                ASSERT_EQ(steens->alias(p, q), llvm::MayAlias);
+                ASSERT_TRUE(solver.mayAlias(p, q));
+            }
+        }
+    }
+
+    delete anderWD;
+}
+
+TEST_F(AndersenTestSuite, SteensgaardFileTest_0) {
+    // Results read back from a binary file are loaded as they are looked up
+    // rather than all at once, and are those written.
+    string test_bc = SVF_BUILD_DIR "tests/ICFG/fptr_test_cpp.ll";
+    string filename = ::testing::TempDir() + "svf_steens_pts.bin";
+    OptionGuard format(Options::PtsFileFormat, BVDataPTAImpl::Binary);
+
+    Map<NodeID, PointsTo> written;
+    {
+        OptionGuard guard(Options::WriteAnder, filename);
+        unique_ptr<SVFProject> proj = make_unique<SVFProject>(test_bc);
+        unique_ptr<Steensgaard> steens = make_unique<Steensgaard>(proj.get());
+        steens->analyze();
+        for (auto &it : *proj->getPAG()) {
+            if (!steens->getPts(it.first).empty())
+                written[it.first] = steens->getPts(it.first);
+        }
+    }
+    ASSERT_FALSE(written.empty());
+
+    OptionGuard guard(Options::ReadAnder, filename);
+    unique_ptr<SVFProject> proj = make_unique<SVFProject>(test_bc);
+    unique_ptr<Steensgaard> steens = make_unique<Steensgaard>(proj.get());
+    steens->analyze();
+    for (auto &it : *proj->getPAG()) {
+        auto w = written.find(it.first);
+        ASSERT_EQ(steens->getPts(it.first),
+                  w == written.end() ? PointsTo() : w->second)
+            << it.first;
+    }
+
+    // A union loads both sets before merging them.
+    auto p = written.begin();
+    auto q = std::next(p);
+    ASSERT_NE(q, written.end());
+    unique_ptr<SVFProject> unionProj = make_unique<SVFProject>(test_bc);
+    unique_ptr<Steensgaard> unionSteens =
+        make_unique<Steensgaard>(unionProj.get());
+    unionSteens->analyze();
+    unionSteens->unionPts(p->first, q->first);
+    ASSERT_EQ(unionSteens->getPts(p->first), p->second | q->second);
+    ASSERT_EQ(unionSteens->getPts(q->first), q->second);
+}
+
+TEST_F(AndersenTestSuite, OfflineVarSubstTest_0) {
+    // Nodes offline substitution merges get the same points-to sets, and
+    // those it finds empty get empty ones.
+    string test_bc = SVF_BUILD_DIR "tests/ICFG/static_call_test_cpp.ll";
+    unique_ptr<SVFProject> proj = make_unique<SVFProject>(test_bc);
+    AndersenWaveDiff *anderWD =
+        AndersenWaveDiff::createAndersenWaveDiff(proj.get());
+
+    ConstraintGraph consCG(proj->getPAG());
+    OfflineVarSubst ovs(&consCG, proj->getSVFModule());
+    ovs.solve();
+    for (NodeID id : ovs.getEmptyNodes()) {
+        ASSERT_TRUE(anderWD->getPts(id).empty());
+    }
+    for (const NodePair &merge : ovs.getMerges()) {
+        ASSERT_EQ(ovs.getLabel(merge.first), ovs.getLabel(merge.second));
+        ASSERT_EQ(anderWD->getPts(merge.first), anderWD->getPts(merge.second));
+    }
+
+    delete anderWD;
+}
+
+/// Points-to set of every PAG node of the wave propagation results of
+/// ll_file solved with the given number of threads, followed by the edges of
+/// the call graph: caller, callee and the ICFG nodes of the calls
+static vector<string> solveWithThreads(string ll_file, unsigned threads) {
+    OptionGuard guard(Options::AnderThreads, threads);
+    unique_ptr<SVFProject> proj = make_unique<SVFProject>(ll_file);
+    AndersenWaveDiff *anderWD =
+        AndersenWaveDiff::createAndersenWaveDiff(proj.get());
+
+    vector<string> results;
+    for (auto &it : *proj->getPAG()) {
+        string row = to_string(it.first) + " {";
+        for (NodeID o : anderWD->getPts(it.first))
+            row += " " + to_string(o);
+        results.push_back(row + " }");
+    }
+    sort(results.begin(), results.end());
+
+    vector<string> edges;
+    for (auto &it : *anderWD->getPTACallGraph()) {
+        for (const PTACallGraphEdge *edge : it.second->getOutEdges()) {
+            string row = edge->getSrcNode()->getFunction()->getName().str() +
+                         " -> " +
+                         edge->getDstNode()->getFunction()->getName().str() +
+                         " " + to_string(edge->getEdgeKind()) + " direct";
+            vector<NodeID> calls;
+            for (const CallBlockNode *cs : edge->getDirectCalls())
+                calls.push_back(cs->getId());
+            sort(calls.begin(), calls.end());
+            for (NodeID cs : calls)
+                row += " " + to_string(cs);
+            row += " indirect";
+            calls.clear();
+            for (const CallBlockNode *cs : edge->getIndirectCalls())
+                calls.push_back(cs->getId());
+            sort(calls.begin(), calls.end());
+            for (NodeID cs : calls)
+                row += " " + to_string(cs);
+            edges.push_back(row);
+        }
+    }
+    sort(edges.begin(), edges.end());
+    results.insert(results.end(), edges.begin(), edges.end());
+
+    delete anderWD;
+    return results;
+}
+
+TEST_F(AndersenTestSuite, ParallelWaveTest_0) {
+    // Wave propagation solves the same points-to sets and call graph
+    // whatever the number of threads.
+    for (string ll_file : {SVF_BUILD_DIR "tests/ICFG/fptr_test_cpp.ll",
+                           SVF_BUILD_DIR "tests/ICFG/virt_call_test_cpp.ll",
+                           SVF_BUILD_DIR "tests/SABER/leak_cpp.ll",
+                           SVF_BUILD_DIR "tests/simple/struct_cpp.ll",
+                           SVF_BUILD_DIR "tests/simple/global_cpp.ll"}) {
+        SCOPED_TRACE(ll_file);
+        vector<string> sequential = solveWithThreads(ll_file, 1);
+        ASSERT_FALSE(sequential.empty());
+        for (unsigned threads : {2u, 4u})
+            EXPECT_EQ(sequential, solveWithThreads(ll_file, threads))
+                << threads;
+    }
+}
+
+/// Offsets of the field objects in fields, sorted
+static vector<Size_t> getFieldOffsets(PAG *pag, const PointsTo &fields) {
+    vector<Size_t> offsets;
+    for (NodeID field : fields) {
+        const auto *gepObj = llvm::dyn_cast<GepObjPN>(pag->getGNode(field));
+        offsets.push_back(gepObj ? gepObj->getLocationSet().getOffset() : 0);
+    }
+    sort(offsets.begin(), offsets.end());
+    return offsets;
+}
+
+/// Object node of the global s of tests/simple/struct.cpp (8 int fields)
+static NodeID getStructObj(SVFProject *proj) {
+    const Value *s =
+        proj->getLLVMModSet()->getModule(0)->getGlobalVariable("s");
+    return proj->getPAG()->getObjectNode(s);
+}
+
+TEST_F(AndersenTestSuite, StrideCacheTest_0) {
+    string test_bc = SVF_BUILD_DIR "tests/simple/struct_cpp.ll";
+    unique_ptr<SVFProject> proj = make_unique<SVFProject>(test_bc);
+    PAG *pag = proj->getPAG();
+    ConstraintGraph consCG(pag);
+    NodeID obj = getStructObj(proj.get());
+    ASSERT_EQ(pag->getBaseObj(obj)->getMaxFieldOffsetLimit(), 8u);
+
+    StrideCache cache(&consCG);
+    NodeBS strides;
+    strides.set(3);
+    const PointsTo *fields = cache.getFields(obj, 1, strides, 0);
+    ASSERT_NE(fields, nullptr);
+    ASSERT_EQ(getFieldOffsets(pag, *fields), vector<Size_t>({1, 4, 7}));
+    ASSERT_EQ(cache.getFields(obj, 1, strides, 0), fields);
+    ASSERT_EQ(cache.getNumOfHits(), 1u);
+
+    // Expanding a field starts from the field's own offset, and stays below
+    // the object's field limit.
+    NodeID field4 = consCG.getGepObjNode(obj, LocationSet(4));
+    fields = cache.getFields(field4, 1, strides, 0);
+    ASSERT_NE(fields, nullptr);
+    ASSERT_EQ(getFieldOffsets(pag, *fields), vector<Size_t>({5}));
+    NodeID field2 = consCG.getGepObjNode(obj, LocationSet(2));
+    fields = cache.getFields(field2, 0, strides, 0);
+    ASSERT_EQ(getFieldOffsets(pag, *fields), vector<Size_t>({2, 5}));
+
+    // An expansion over the limit creates no field.
+    strides.set(1);
+    u32_t numOfNodes = pag->getTotalNodeNum();
+    ASSERT_EQ(cache.getFields(obj, 0, strides, 7), nullptr);
+    ASSERT_EQ(pag->getTotalNodeNum(), numOfNodes);
+    fields = cache.getFields(obj, 0, strides, 8);
+    ASSERT_NE(fields, nullptr);
+    ASSERT_EQ(fields->count(), 8u);
+}
+
+/// Exposes AndersenSFR's field expansion
+class FieldExpandAndersenSFR : public AndersenSFR {
+  public:
+    explicit FieldExpandAndersenSFR(SVFProject *proj) : AndersenSFR(proj) {}
+
+    using AndersenSFR::fieldExpand;
+    using AndersenSFR::initialize;
+
+    inline ConstraintGraph *getConstraintGraph() const { return consCG; }
+};
+
+TEST_F(AndersenTestSuite, SFRFieldExpandTest_0) {
+    string test_bc = SVF_BUILD_DIR "tests/simple/struct_cpp.ll";
+    unique_ptr<SVFProject> proj = make_unique<SVFProject>(test_bc);
+    NodeID obj = getStructObj(proj.get());
+
+    FieldExpandAndersenSFR sfr(proj.get());
+    sfr.initialize();
+    ConstraintGraph *consCG = sfr.getConstraintGraph();
+    ASSERT_FALSE(consCG->hasNodesToBeCollapsed());
+
+    NodeBS strides;
+    strides.set(2);
+    NodeSet initials = {obj};
+    PointsTo expandPts;
+    {
+        OptionGuard guard(Options::SFRMaxFieldExpand, 4u);
+        sfr.fieldExpand(initials, 0, strides, expandPts);
+    }
+    ASSERT_EQ(getFieldOffsets(proj->getPAG(), expandPts),
+              vector<Size_t>({0, 2, 4, 6}));
+    ASSERT_FALSE(consCG->hasNodesToBeCollapsed());
+
+    // The same expansion is one field over a limit of 3, so the object is
+    // collapsed instead.
+    initials = {obj};
+    expandPts.clear();
+    {
+        OptionGuard guard(Options::SFRMaxFieldExpand, 3u);
+        sfr.fieldExpand(initials, 0, strides, expandPts);
+    }
+    ASSERT_EQ(expandPts.count(), 1u);
+    ASSERT_TRUE(expandPts.test(consCG->getFIObjNode(obj)));
+    ASSERT_TRUE(consCG->hasNodesToBeCollapsed());
+    ASSERT_EQ(consCG->getNextCollapseNode(), obj);
+}
+
 int main(int argc, char *argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,90 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#include "SVF-FE/SVFProject.h"
+#include "WPA/FlowSensitive.h"
+#include "WPA/VersionedFlowSensitive.h"
+
+#include "Tests/Graphs/SVFG.hpp"
+#include "Tests/Options.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace SVF;
+
+/// Points-to set of every PAG node of the results of pta on proj
+static vector<string> getResults(SVFProject &proj, PointerAnalysis *pta) {
+    vector<string> results;
+    for (auto &it : *proj.getPAG()) {
+        string row = to_string(it.first) + " {";
+        for (NodeID o : pta->getPts(it.first))
+            row += " " + to_string(o);
+        results.push_back(row + " }");
+    }
+    sort(results.begin(), results.end());
+    return results;
+}
+
+/// Flow-sensitive results of ll_file solved with the given number of threads
+static vector<string> solveFS(string ll_file, unsigned threads) {
+    OptionGuard guard(Options::FSThreads, threads);
+    SVFProject proj(ll_file);
+    auto fs = make_unique<FlowSensitive>(&proj);
+    fs->analyze();
+    return getResults(proj, fs.get());
+}
+
+TEST(FlowSensitiveTest, ThreadsTest_0) {
+    for (string ll_file : ThreadTestPrograms) {
+        SCOPED_TRACE(ll_file);
+        vector<string> sequential = solveFS(ll_file, 1);
+        ASSERT_FALSE(sequential.empty());
+        for (unsigned threads : {2u, 4u})
+            EXPECT_EQ(sequential, solveFS(ll_file, threads)) << threads;
+    }
+}
+
+/// Versioned flow-sensitive results of ll_file, labelled with the given
+/// number of threads
+static vector<string> solveVFS(string ll_file, unsigned threads) {
+    OptionGuard guard(Options::VFSLabelThreads, threads);
+    SVFProject proj(ll_file);
+    auto vfs = make_unique<VersionedFlowSensitive>(&proj);
+    vfs->analyze();
+    return getResults(proj, vfs.get());
+}
+
+TEST(FlowSensitiveTest, VersionedThreadsTest_0) {
+    // Versioning only shares points-to sets between the nodes which would
+    // have had the same ones, however the objects are labelled.
+    for (string ll_file : ThreadTestPrograms) {
+        SCOPED_TRACE(ll_file);
+        vector<string> fs = solveFS(ll_file, 1);
+        ASSERT_FALSE(fs.empty());
+        for (unsigned threads : {1u, 2u, 4u})
+            EXPECT_EQ(fs, solveVFS(ll_file, threads)) << threads;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
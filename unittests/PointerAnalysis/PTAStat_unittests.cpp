@@ -0,0 +1,118 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#include "MemoryModel/PTAStat.h"
+#include "SVF-FE/SVFProject.h"
+#include "WPA/Andersen.h"
+
+#include "Tests/Options.hpp"
+#include "config.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <fstream>
+#include <llvm/Support/JSON.h>
+#include <sstream>
+#include <string>
+
+using namespace std;
+using namespace SVF;
+
+/// Contents of the file -stat-export=filename writes for an Andersen
+/// analysis of ll_file
+static string exportAndersenStat(const string &filename) {
+    OptionGuard statGuard(Options::PStat, true);
+    OptionGuard exportGuard(Options::StatExport, filename);
+    string ll_file = SVF_BUILD_DIR "tests/ICFG/fptr_test_cpp.ll";
+    SVFProject proj(ll_file);
+    delete AndersenWaveDiff::createAndersenWaveDiff(&proj);
+
+    ifstream in(filename);
+    stringstream content;
+    content << in.rdbuf();
+    return content.str();
+}
+
+TEST(PTAStatTest, ExportJSONTest_0) {
+    string content =
+        exportAndersenStat(::testing::TempDir() + "svf_stat_export.json");
+    llvm::Expected<llvm::json::Value> parsed = llvm::json::parse(content);
+    ASSERT_TRUE(static_cast<bool>(parsed))
+        << llvm::toString(parsed.takeError());
+    const llvm::json::Object *root = parsed->getAsObject();
+    ASSERT_NE(root, nullptr);
+    EXPECT_TRUE(root->getString("module").hasValue());
+    EXPECT_TRUE(root->getInteger("peakRSSKB").hasValue());
+
+    const llvm::json::Array *sections = root->getArray("sections");
+    ASSERT_NE(sections, nullptr);
+    bool hasAndersen = false;
+    for (const llvm::json::Value &section : *sections) {
+        const llvm::json::Object *obj = section.getAsObject();
+        ASSERT_NE(obj, nullptr);
+        const llvm::json::Object *stats = obj->getObject("stats");
+        ASSERT_NE(stats, nullptr);
+        if (obj->getString("analysis") == llvm::StringRef("AndersenWPA") &&
+            obj->getString("name") ==
+                llvm::StringRef("Andersen Pointer Analysis Stats")) {
+            hasAndersen = true;
+            EXPECT_NE(stats->begin(), stats->end());
+        }
+    }
+    EXPECT_TRUE(hasAndersen);
+
+    const llvm::json::Array *phases = root->getArray("phases");
+    ASSERT_NE(phases, nullptr);
+    bool hasSolve = false;
+    for (const llvm::json::Value &phase : *phases) {
+        const llvm::json::Object *obj = phase.getAsObject();
+        ASSERT_NE(obj, nullptr);
+        ASSERT_TRUE(obj->getNumber("wallMs").hasValue());
+        if (obj->getString("path") == llvm::StringRef("Andersen/Solve")) {
+            hasSolve = true;
+            EXPECT_GE(obj->getInteger("count").getValueOr(0), 1);
+        }
+    }
+    EXPECT_TRUE(hasSolve);
+}
+
+TEST(PTAStatTest, ExportCSVTest_0) {
+    string content =
+        exportAndersenStat(::testing::TempDir() + "svf_stat_export.csv");
+    istringstream lines(content);
+    string line;
+    ASSERT_TRUE(static_cast<bool>(getline(lines, line)));
+    ASSERT_EQ(line, "kind,section,name,value");
+
+    // No name here needs quoting, so every row has four fields.
+    bool hasAndersen = false;
+    bool hasSolve = false;
+    while (getline(lines, line)) {
+        EXPECT_EQ(count(line.begin(), line.end(), ','), 3) << line;
+        if (line.rfind("stat,AndersenWPA/Andersen Pointer Analysis Stats,",
+                       0) == 0)
+            hasAndersen = true;
+        if (line.rfind("phase,Andersen/Solve,WallMs,", 0) == 0)
+            hasSolve = true;
+    }
+    EXPECT_TRUE(hasAndersen);
+    EXPECT_TRUE(hasSolve);
+}
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,76 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#include "MemoryModel/MutablePointsToDS.h"
+#include "Util/Parallel.h"
+
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace SVF;
+
+using MutDFPTD = MutableDFPTData<NodeID, NodeBS, NodeID, PointsTo>;
+using IncMutDFPTD = IncMutableDFPTData<NodeID, NodeBS, NodeID, PointsTo>;
+
+TEST(DFPTDataTest, NoSourceSetTest_0) {
+    MutDFPTD mut(false);
+    IncMutDFPTD inc(false);
+
+    // Propagating from a location without a set creates nothing.
+    ASSERT_FALSE(mut.updateDFInFromIn(1, 10, 2, 10));
+    ASSERT_FALSE(mut.updateDFInFromOut(1, 10, 2, 10));
+    ASSERT_FALSE(mut.hasDFInSet(1));
+    ASSERT_FALSE(mut.hasDFOutSet(1));
+    ASSERT_FALSE(inc.updateDFInFromIn(1, 10, 2, 10));
+    ASSERT_FALSE(inc.hasDFInSet(1));
+
+    mut.initDFInSet(1);
+    inc.initDFOutSet(1);
+    ASSERT_TRUE(mut.hasDFInSet(1));
+    ASSERT_FALSE(mut.hasDFInSet(1, 10));
+    ASSERT_TRUE(inc.hasDFOutSet(1));
+    ASSERT_FALSE(inc.hasDFOutSet(1, 10));
+}
+
+TEST(DFPTDataTest, ConcurrentUpdateTest_0) {
+    const NodeID numOfLocs = 256;
+    IncMutDFPTD inc(false);
+
+    // Location 0 stores var 7 -> {o}, every other location reads it.
+    inc.addPts(1, 100);
+    inc.initDFOutSet(0);
+    ASSERT_TRUE(inc.updateATVPts(1, 0, 7));
+    for (NodeID loc = 1; loc < numOfLocs; ++loc) {
+        inc.initDFInSet(loc);
+    }
+
+    vector<char> changed(numOfLocs, false);
+    parallelFor(numOfLocs - 1, 4, [&](size_t i) {
+        changed[i + 1] = inc.updateDFInFromOut(0, 7, i + 1, 7);
+    });
+
+    for (NodeID loc = 1; loc < numOfLocs; ++loc) {
+        ASSERT_TRUE(changed[loc]);
+        ASSERT_TRUE(inc.getDFInPtsSet(loc, 7).test(100));
+    }
+    // The source location was only read.
+    ASSERT_FALSE(inc.hasDFInSet(0));
+}
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,107 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#include "MemoryModel/MutablePointsToDS.h"
+#include "MemoryModel/PersistentPointsToDS.h"
+
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace SVF;
+
+using PtCache = PersistentPointsToCache<PointsTo>;
+using MutDiffPTD = MutableDiffPTData<NodeID, NodeBS, NodeID, PointsTo>;
+using PersDiffPTD = PersistentDiffPTData<NodeID, NodeBS, NodeID, PointsTo>;
+
+static PointsTo makePts(std::initializer_list<NodeID> elems) {
+    PointsTo pts;
+    for (NodeID e : elems) {
+        pts.set(e);
+    }
+    return pts;
+}
+
+TEST(PersistentPointsToCacheTest, InterningTest_0) {
+    PtCache cache;
+
+    ASSERT_EQ(cache.emplacePts(PointsTo()), PtCache::emptyPointsToId());
+
+    PointsToID a = cache.emplacePts(makePts({1, 2, 3}));
+    PointsToID b = cache.emplacePts(makePts({1, 2, 3}));
+    PointsToID c = cache.emplacePts(makePts({4}));
+
+    ASSERT_EQ(a, b);
+    ASSERT_NE(a, c);
+    ASSERT_EQ(cache.getNumberOfPointsToSets(), 3u);
+    ASSERT_EQ(cache.getActualPts(a), makePts({1, 2, 3}));
+}
+
+TEST(PersistentPointsToCacheTest, OperationsTest_0) {
+    PtCache cache;
+
+    PointsToID a = cache.emplacePts(makePts({1, 2, 3}));
+    PointsToID b = cache.emplacePts(makePts({3, 4}));
+
+    PointsToID u = cache.unionPts(a, b);
+    ASSERT_EQ(cache.getActualPts(u), makePts({1, 2, 3, 4}));
+    // Commutative and memoised.
+    ASSERT_EQ(cache.unionPts(b, a), u);
+    ASSERT_EQ(cache.unionPts(u, a), u);
+
+    PointsToID i = cache.intersectPts(a, b);
+    ASSERT_EQ(cache.getActualPts(i), makePts({3}));
+    ASSERT_EQ(cache.intersectPts(u, b), b);
+
+    PointsToID c = cache.complementPts(a, b);
+    ASSERT_EQ(cache.getActualPts(c), makePts({1, 2}));
+    ASSERT_EQ(cache.complementPts(b, a), cache.emplacePts(makePts({4})));
+    ASSERT_EQ(cache.complementPts(a, a), PtCache::emptyPointsToId());
+}
+
+TEST(PersistentPointsToCacheTest, DiffPTDataEquivalenceTest_0) {
+    PtCache cache;
+    MutDiffPTD mut;
+    PersDiffPTD pers(cache);
+
+    for (NodeID n = 0; n < 64; ++n) {
+        ASSERT_EQ(mut.addPts(n, n % 7), pers.addPts(n, n % 7));
+        ASSERT_EQ(mut.addPts(n, 100 + n % 3), pers.addPts(n, 100 + n % 3));
+    }
+
+    for (NodeID n = 1; n < 64; ++n) {
+        ASSERT_EQ(mut.unionPts(n, n - 1), pers.unionPts(n, n - 1));
+    }
+
+    for (NodeID n = 0; n < 64; ++n) {
+        ASSERT_EQ(mut.getPts(n), pers.getPts(n));
+        ASSERT_EQ(mut.computeDiffPts(n, mut.getPts(n)),
+                  pers.computeDiffPts(n, pers.getPts(n)));
+        ASSERT_EQ(mut.getDiffPts(n), pers.getDiffPts(n));
+        ASSERT_EQ(mut.getRevPts(n % 7), pers.getRevPts(n % 7));
+    }
+
+    mut.clearPts(5, 5);
+    pers.clearPts(5, 5);
+    ASSERT_EQ(mut.getPts(5), pers.getPts(5));
+
+    // Many keys, few distinct sets.
+    ASSERT_LT(cache.getNumberOfPointsToSets(), 64u * 3);
+}
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,192 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#include "MemoryModel/PointsToFile.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <fstream>
+
+using namespace std;
+using namespace SVF;
+
+static PointsTo makePts(std::initializer_list<NodeID> elems) {
+    PointsTo pts;
+    for (NodeID e : elems) {
+        pts.set(e);
+    }
+    return pts;
+}
+
+static std::string getTmpFileName(const std::string &name) {
+    return ::testing::TempDir() + name;
+}
+
+static std::string readFile(const std::string &filename) {
+    std::ifstream F(filename.c_str(), std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(F),
+                       std::istreambuf_iterator<char>());
+}
+
+static void writeFile(const std::string &filename, const std::string &content) {
+    std::ofstream F(filename.c_str(), std::ios::binary);
+    F.write(content.data(), content.size());
+}
+
+/// Offset of the index entry i in a file (after the 32 bytes header, each
+/// entry being node, size and offset in 16 bytes).
+static size_t getIndexEntryOffset(u32_t i) { return 32 + i * 16; }
+
+TEST(PointsToFileTest, RoundTripTest_0) {
+    std::string filename = getTmpFileName("svf_pts_roundtrip.bin");
+
+    Map<NodeID, PointsTo> expected;
+    expected[7] = makePts({1, 2, 3});
+    expected[3] = makePts({100000, 4});
+    expected[12] = makePts({1, 2, 3});
+    expected[5] = makePts({0, 127, 128, 16384, 1u << 30});
+
+    PointsToFileWriter writer;
+    for (const auto &it : expected) {
+        writer.addPts(it.first, it.second);
+    }
+    // Empty sets are not stored.
+    writer.addPts(9, PointsTo());
+    writer.addGepObj(20, 2, 4);
+    writer.addGepObj(21, 2, 8);
+    ASSERT_TRUE(writer.write(filename));
+
+    ASSERT_TRUE(PointsToFile::isPointsToFile(filename));
+    std::unique_ptr<PointsToFile> file = PointsToFile::open(filename);
+    ASSERT_NE(file, nullptr);
+
+    ASSERT_EQ(file->getNumOfPts(), expected.size());
+    for (u32_t i = 1; i < file->getNumOfPts(); ++i) {
+        ASSERT_LT(file->getPtsNode(i - 1), file->getPtsNode(i));
+    }
+
+    for (const auto &it : expected) {
+        PointsTo pts;
+        ASSERT_TRUE(file->readPts(it.first, pts));
+        ASSERT_EQ(pts, it.second);
+    }
+
+    PointsTo pts;
+    ASSERT_FALSE(file->readPts(9, pts));
+    ASSERT_FALSE(file->readPts(4, pts));
+    ASSERT_FALSE(file->readPts(100, pts));
+    ASSERT_TRUE(pts.empty());
+
+    ASSERT_EQ(file->getNumOfGepObjs(), 2u);
+    NodeID id;
+    NodeID base;
+    Size_t offset;
+    file->getGepObj(1, id, base, offset);
+    ASSERT_EQ(id, 21u);
+    ASSERT_EQ(base, 2u);
+    ASSERT_EQ(offset, 8);
+}
+
+TEST(PointsToFileTest, RejectTest_0) {
+    std::string textFile = getTmpFileName("svf_pts_text.txt");
+    {
+        std::ofstream F(textFile.c_str());
+        F << "1 -> { 2 3 }\n";
+    }
+    ASSERT_FALSE(PointsToFile::isPointsToFile(textFile));
+    ASSERT_EQ(PointsToFile::open(textFile), nullptr);
+
+    // A truncated file is rejected.
+    std::string binFile = getTmpFileName("svf_pts_truncated.bin");
+    PointsToFileWriter writer;
+    writer.addPts(1, makePts({2, 3, 4}));
+    ASSERT_TRUE(writer.write(binFile));
+    std::string content = readFile(binFile);
+    writeFile(binFile, content.substr(0, content.size() - 1));
+    ASSERT_TRUE(PointsToFile::isPointsToFile(binFile));
+    ASSERT_EQ(PointsToFile::open(binFile), nullptr);
+}
+
+TEST(PointsToFileTest, RejectTest_1) {
+    std::string binFile = getTmpFileName("svf_pts_index.bin");
+    PointsToFileWriter writer;
+    writer.addPts(1, makePts({2, 3, 4}));
+    writer.addPts(2, makePts({5}));
+    ASSERT_TRUE(writer.write(binFile));
+    std::string content = readFile(binFile);
+    ASSERT_NE(PointsToFile::open(binFile), nullptr);
+
+    // An index which is not sorted by node is rejected.
+    std::string unsorted = content;
+    unsorted[getIndexEntryOffset(0)] = 3;
+    writeFile(binFile, unsorted);
+    ASSERT_EQ(PointsToFile::open(binFile), nullptr);
+
+    // So is an entry whose set does not fit in the payload.
+    std::string outOfPayload = content;
+    outOfPayload[getIndexEntryOffset(1) + 8] = 100;
+    writeFile(binFile, outOfPayload);
+    ASSERT_EQ(PointsToFile::open(binFile), nullptr);
+
+    std::string tooLarge = content;
+    tooLarge[getIndexEntryOffset(0) + 4] = 10;
+    writeFile(binFile, tooLarge);
+    ASSERT_EQ(PointsToFile::open(binFile), nullptr);
+}
+
+TEST(PointsToFileTest, RejectTest_2) {
+    std::string binFile = getTmpFileName("svf_pts_wrap.bin");
+    PointsToFileWriter writer;
+    writer.addPts(1, makePts({2, 3, 4}));
+    ASSERT_TRUE(writer.write(binFile));
+    std::string content = readFile(binFile);
+
+    // Offset objects running past the end of the file, with a payload size
+    // which brings the end of the payload back to the end of the file once
+    // it wraps around, are rejected.
+    u32_t numOfGepObjs = 1000;
+    u64_t payloadSize =
+        content.size() - getIndexEntryOffset(1) - numOfGepObjs * 16;
+    std::memcpy(&content[16], &numOfGepObjs, sizeof(numOfGepObjs));
+    std::memcpy(&content[24], &payloadSize, sizeof(payloadSize));
+    writeFile(binFile, content);
+    ASSERT_EQ(PointsToFile::open(binFile), nullptr);
+}
+
+TEST(PointsToFileTest, CorruptPayloadTest_0) {
+    // 200 is encoded in two bytes, the last of which is the end of the file.
+    std::string binFile = getTmpFileName("svf_pts_payload.bin");
+    PointsToFileWriter writer;
+    writer.addPts(1, makePts({200}));
+    ASSERT_TRUE(writer.write(binFile));
+    std::string content = readFile(binFile);
+
+    // Make the encoding run past the end of the payload.
+    content.back() = static_cast<char>(0x80);
+    writeFile(binFile, content);
+    std::unique_ptr<PointsToFile> file = PointsToFile::open(binFile);
+    ASSERT_NE(file, nullptr);
+
+    PointsTo pts = makePts({7});
+    ASSERT_FALSE(file->readPts(1, pts));
+    ASSERT_EQ(pts, makePts({7}));
+}
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,94 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#include "MSSA/MemPartition.h"
+
+#include "gtest/gtest.h"
+
+#include <set>
+
+using namespace std;
+using namespace SVF;
+
+static PointsTo makePts(std::initializer_list<NodeID> elems) {
+    PointsTo pts;
+    for (NodeID e : elems) {
+        pts.set(e);
+    }
+    return pts;
+}
+
+static set<set<NodeID>> getClasses(const PointsToPartition &partition) {
+    set<set<NodeID>> classes;
+    for (u32_t c = 0; c < partition.getNumOfClasses(); ++c) {
+        set<NodeID> objs;
+        for (NodeID obj : partition.getClass(c)) {
+            objs.insert(obj);
+        }
+        classes.insert(objs);
+    }
+    return classes;
+}
+
+TEST(PointsToPartitionTest, Refine_0) {
+    PointsToPartition partition;
+    partition.refine(makePts({1, 2, 3, 4}));
+    partition.refine(makePts({3, 4, 5}));
+    partition.refine(makePts({4, 6}));
+    partition.refine(makePts({1, 2, 3, 4}));
+
+    // Objects are together iff they are in the same sets.
+    ASSERT_EQ(getClasses(partition),
+              set<set<NodeID>>({{1, 2}, {3}, {4}, {5}, {6}}));
+    ASSERT_FALSE(partition.hasClass(7));
+}
+
+TEST(PointsToPartitionTest, Refine_1) {
+    // A set refined after one of its supersets splits it, and the classes
+    // do not depend on the order of refinement. (computeIntersections used
+    // to leave {1, 2} and {1} overlapping when {1} came second.)
+    PointsToPartition supersetFirst;
+    supersetFirst.refine(makePts({1, 2}));
+    supersetFirst.refine(makePts({1}));
+    ASSERT_EQ(getClasses(supersetFirst), set<set<NodeID>>({{1}, {2}}));
+
+    PointsToPartition subsetFirst;
+    subsetFirst.refine(makePts({1}));
+    subsetFirst.refine(makePts({1, 2}));
+    ASSERT_EQ(getClasses(subsetFirst), getClasses(supersetFirst));
+}
+
+TEST(PointsToPartitionTest, Classes_0) {
+    PointsToPartition partition;
+    partition.refine(makePts({1, 2, 3}));
+    partition.refine(makePts({3, 4}));
+
+    PointsToPartition::ClassList of, within;
+    partition.getClassesOf(makePts({2, 4, 9}), of);
+    partition.getClassesWithin(makePts({2, 4, 9}), within);
+    ASSERT_EQ(of.size(), 2u);
+    ASSERT_EQ(within.size(), 1u);
+    ASSERT_EQ(partition.getClass(within[0]), makePts({4}));
+
+    within.clear();
+    partition.getClassesWithin(makePts({1, 2, 3, 4}), within);
+    ASSERT_EQ(within.size(), 3u);
+}
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
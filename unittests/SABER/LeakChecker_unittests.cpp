@@ -0,0 +1,46 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#include "Tests/Options.hpp"
+#include "Tests/SABER/LeakChecker.hpp"
+#include "config.h"
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace SVF;
+
+static vector<string> checkLeaks(string ll_file, unsigned threads) {
+    OptionGuard guard(Options::SaberThreads, threads);
+    return checkLeaks(ll_file);
+}
+
+TEST(LeakCheckerTest, ParallelSlicingTest_0) {
+    string ll_file = SVF_BUILD_DIR "tests/SABER/leak_cpp.ll";
+
+    vector<string> sequential = checkLeaks(ll_file, 1);
+    ASSERT_GT(sequential.size(), 1u);
+
+    vector<string> parallel = checkLeaks(ll_file, 4);
+    ASSERT_EQ(parallel, sequential);
+}
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -19,8 +19,10 @@
  *     2021-03-21
  *****************************************************************************/
 
+#include "SVF-FE/ProjectSnapshot.h"
 #include "SVF-FE/SVFProject.h"
 #include "Util/SVFModule.h"
+#include <fstream>
 #include <memory>
 #include <string>
 
@@ -166,6 +168,89 @@ TEST(SVFProjectTests, WebGL_0) {
     SVFMod_eq_test(proj1->getSVFModule(), proj2->getSVFModule());
 }
 
+TEST(SVFProjectTests, SnapshotTest_0) {
+    string ll_file = SVF_BUILD_DIR "tests/ICFG/fptr_test_cpp.ll";
+    string snapshot_file = ::testing::TempDir() + "svf_snapshot.txt";
+
+    {
+        SVFProject proj(ll_file);
+        ProjectSnapshot snapshot(&proj);
+        ASSERT_FALSE(snapshot.getFunHashes().empty());
+        ASSERT_TRUE(snapshot.writeToFile(snapshot_file));
+    }
+
+    SVFProject proj(ll_file);
+    ProjectSnapshot newSnapshot(&proj);
+    ProjectSnapshot oldSnapshot;
+    ASSERT_TRUE(oldSnapshot.readFromFile(snapshot_file));
+    ASSERT_EQ(oldSnapshot.getFunHashes(), newSnapshot.getFunHashes());
+    ASSERT_EQ(oldSnapshot.getNodeKeys(), newSnapshot.getNodeKeys());
+
+    // Nothing changed, so every keyed node maps to itself.
+    Set<string> changed = newSnapshot.getChangedFunctions(oldSnapshot);
+    ASSERT_TRUE(changed.empty());
+    Map<NodeID, NodeID> oldToNew;
+    newSnapshot.mapNodes(oldSnapshot, changed, oldToNew);
+    ASSERT_EQ(oldToNew.size(), newSnapshot.getNodeKeys().size());
+    for (const auto &it : oldToNew) {
+        ASSERT_EQ(it.first, it.second);
+    }
+
+    // The nodes of a changed function are not mapped.
+    string fun;
+    for (const auto &it : newSnapshot.getFunHashes()) {
+        if (it.first[0] != '@') {
+            fun = it.first;
+            break;
+        }
+    }
+    oldToNew.clear();
+    newSnapshot.mapNodes(oldSnapshot, {fun}, oldToNew);
+    ASSERT_LT(oldToNew.size(), newSnapshot.getNodeKeys().size());
+}
+
+TEST(SVFProjectTests, SnapshotTest_1) {
+    string ll_file = SVF_BUILD_DIR "tests/simple/global_cpp.ll";
+    string snapshot_file = ::testing::TempDir() + "svf_snapshot_cons.txt";
+
+    SVFProject proj(ll_file);
+    ProjectSnapshot oldSnapshot(&proj);
+    ASSERT_FALSE(oldSnapshot.getConsCounts().empty());
+    ASSERT_FALSE(oldSnapshot.hasRemovedConstraints(oldSnapshot, {}));
+
+    // Global initializers are fingerprinted.
+    GlobalVariable *gp =
+        proj.getLLVMModSet()->getModule(0)->getGlobalVariable("gp");
+    ASSERT_NE(gp, nullptr);
+    gp->setInitializer(Constant::getNullValue(gp->getValueType()));
+    ProjectSnapshot newSnapshot(&proj);
+    ASSERT_EQ(newSnapshot.getChangedFunctions(oldSnapshot),
+              Set<string>({"@gp"}));
+
+    // A snapshot with a constraint which is not in this program had
+    // constraints removed since, while one missing a constraint had not.
+    ASSERT_TRUE(oldSnapshot.writeToFile(snapshot_file));
+    {
+        ofstream F(snapshot_file.c_str(), ios::app);
+        F << "C 1 1\n";
+    }
+    ProjectSnapshot moreCons;
+    ASSERT_TRUE(moreCons.readFromFile(snapshot_file));
+    ASSERT_TRUE(oldSnapshot.hasRemovedConstraints(moreCons, {}));
+    ASSERT_FALSE(moreCons.hasRemovedConstraints(oldSnapshot, {}));
+
+    // Edges without keys are only compared through the functions owning
+    // them.
+    {
+        ofstream F(snapshot_file.c_str(), ios::app);
+        F << "U main\n";
+    }
+    ProjectSnapshot unkeyedCons;
+    ASSERT_TRUE(unkeyedCons.readFromFile(snapshot_file));
+    ASSERT_TRUE(moreCons.hasRemovedConstraints(unkeyedCons, {"main"}));
+    ASSERT_FALSE(moreCons.hasRemovedConstraints(unkeyedCons, {"foo"}));
+}
+
 int main(int argc, char *argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -12,7 +12,10 @@ using namespace SVF;
 
 using namespace boost::archive;
 
-TEST(SerializationTestSuite, BS_Test) {
+class BSSerializationTestSuite
+    : public ::testing::TestWithParam<SVFProject::ArchiveKind> {};
+
+TEST_P(BSSerializationTestSuite, BS_Test) {
 
 #if 1
     vector<unsigned> sets{1, 3, 4, 7, 100};
@@ -20,18 +23,16 @@ TEST(SerializationTestSuite, BS_Test) {
 
     // save the object
     {
-        text_oarchive oa{ss};
         NodeBS bs;
         for (auto pos : sets) {
             bs.set(pos);
         }
-        oa << bs;
+        saveToArchive(ss, bs, GetParam());
     }
 
     {
-        text_iarchive ia{ss};
         NodeBS bs;
-        ia >> bs;
+        loadFromArchive(ss, bs, GetParam());
 
         for (auto pos : sets) {
             ASSERT_TRUE(bs.test(pos));
@@ -96,6 +97,11 @@ TEST(SerializationTestSuite, BS_Test) {
 #endif
 }
 
+INSTANTIATE_TEST_SUITE_P(AllArchives, BSSerializationTestSuite,
+                         ::testing::Values(SVFProject::TextArchive,
+                                           SVFProject::BinaryArchive,
+                                           SVFProject::CompressedBinaryArchive));
+
 int main(int argc, char *argv[]) {
     ::testing::InitGoogleTest();
     return RUN_ALL_TESTS();
@@ -45,40 +45,40 @@ class TestClass {
     int getX() const { return x; }
 };
 
-TEST(SerializationTestSuite, rawptr_test) {
+class PointerSerializationTestSuite
+    : public ::testing::TestWithParam<SVFProject::ArchiveKind> {};
+
+TEST_P(PointerSerializationTestSuite, rawptr_test) {
     stringstream ss;
 
     // save the object
     {
-        text_oarchive oa{ss};
         TestClass t(0xdeadbeef);
         TestClass *pt = &t;
 
-        oa << pt;
+        saveToArchive(ss, pt, GetParam());
     }
 
     // load
     {
-        text_iarchive ia{ss};
         TestClass *pt;
-        ia >> pt;
+        loadFromArchive(ss, pt, GetParam());
         cout << std::hex << pt->getX() << endl;
+        ASSERT_EQ(pt->getX(), static_cast<int>(0xdeadbeef));
         delete pt;
     }
 }
 
-TEST(SerializationTestSuite, null_test) {
+TEST_P(PointerSerializationTestSuite, null_test) {
     stringstream ss;
     {
-        text_oarchive oa{ss};
         TestClass *pt = nullptr;
-        oa << pt;
+        saveToArchive(ss, pt, GetParam());
     }
 
     {
-        text_iarchive ia(ss);
         TestClass *pt;
-        ia >> pt;
+        loadFromArchive(ss, pt, GetParam());
 
         ASSERT_EQ(pt, nullptr);
     }
@@ -110,27 +110,30 @@ class PtrToSelf {
     }
 };
 
-TEST(SerializationTestSuite, PtrToSelfTest) {
+TEST_P(PointerSerializationTestSuite, PtrToSelfTest) {
     stringstream ss;
     // save
     {
         PtrToSelf p(1234);
         p.setPtr(&p);
 
-        text_oarchive oa{ss};
-        oa << p;
+        saveToArchive(ss, p, GetParam());
     }
 
     {
-        text_iarchive ia{ss};
         PtrToSelf p;
-        ia >> p;
+        loadFromArchive(ss, p, GetParam());
 
         ASSERT_EQ(p.getX(), 1234);
         ASSERT_EQ(p.getPtr(), &p);
     }
 }
 
+INSTANTIATE_TEST_SUITE_P(AllArchives, PointerSerializationTestSuite,
+                         ::testing::Values(SVFProject::TextArchive,
+                                           SVFProject::BinaryArchive,
+                                           SVFProject::CompressedBinaryArchive));
+
 int main(int argc, char *argv[]) {
     ::testing::InitGoogleTest();
     return RUN_ALL_TESTS();
@@ -41,7 +41,8 @@ using namespace std;
 
 using namespace boost::archive;
 
-class VFGSerializationTestSuite : public ::testing::Test {
+class VFGSerializationTestSuite
+    : public ::testing::TestWithParam<SVFProject::ArchiveKind> {
 
   protected:
     void SetUp() {
@@ -60,10 +61,7 @@ class VFGSerializationTestSuite : public ::testing::Test {
             SVFProject::setCurrentProject(&currProj);
 
             // SAVE to ss
-            {
-                text_oarchive oa{ss};
-                oa << node;
-            }
+            saveToArchive(ss, node, GetParam());
             /// LOAD and test
             {
                 VFGNode *n = nullptr;
@@ -72,8 +70,7 @@ class VFGSerializationTestSuite : public ::testing::Test {
                     _proj = make_shared<SVFProject>(test_bc);
                 }
 
-                text_iarchive ia{ss};
-                ia >> n;
+                loadFromArchive(ss, n, GetParam());
                 ASSERT_NE(n, nullptr);
                 node_eq_test(n, node);
                 boost::serialization::access::destroy(n);
@@ -91,10 +88,7 @@ class VFGSerializationTestSuite : public ::testing::Test {
 
             SVFProject::setCurrentProject(&currProj);
             // SAVE to ss
-            {
-                text_oarchive oa{ss};
-                oa << edge;
-            }
+            saveToArchive(ss, edge, GetParam());
             /// LOAD and test
             {
                 VFGEdge *e = nullptr;
@@ -103,8 +97,7 @@ class VFGSerializationTestSuite : public ::testing::Test {
                 if (new_proj) {
                     _proj = make_unique<SVFProject>(test_bc);
                 }
-                text_iarchive ia{ss};
-                ia >> e;
+                loadFromArchive(ss, e, GetParam());
 
                 ASSERT_NE(e, nullptr);
                 edge_eq_test(e, edge);
@@ -120,10 +113,7 @@ class VFGSerializationTestSuite : public ::testing::Test {
 
         SVFProject::setCurrentProject(&currProj);
         /// SAVE the graph to ss
-        {
-            text_oarchive oa{ss};
-            oa << g.get();
-        }
+        saveToArchive(ss, g.get(), GetParam());
 
         {
             VFG *vfg = nullptr;
@@ -132,8 +122,7 @@ class VFGSerializationTestSuite : public ::testing::Test {
                 _proj = make_shared<SVFProject>(test_bc);
             }
 
-            text_iarchive ia{ss};
-            ia >> vfg;
+            loadFromArchive(ss, vfg, GetParam());
             ASSERT_NE(vfg, nullptr);
             node_and_edge_id_test(g.get());
             node_and_edge_id_test(vfg);
@@ -185,25 +174,25 @@ class VFGSerializationTestSuite : public ::testing::Test {
     }
 };
 
-TEST_F(VFGSerializationTestSuite, StaticCallTest_0) {
+TEST_P(VFGSerializationTestSuite, StaticCallTest_0) {
     string test_bc = SVF_BUILD_DIR "tests/ICFG/static_call_test_cpp.ll";
     vfg_node_and_edge_serialization_test(test_bc);
     svfg_node_and_edge_serialization_test(test_bc);
 }
 
-TEST_F(VFGSerializationTestSuite, FPtrTest_0) {
+TEST_P(VFGSerializationTestSuite, FPtrTest_0) {
     string test_bc = SVF_BUILD_DIR "tests/ICFG/fptr_test_cpp.ll";
     vfg_node_and_edge_serialization_test(test_bc);
     svfg_node_and_edge_serialization_test(test_bc);
 }
 
-TEST_F(VFGSerializationTestSuite, VirtTest_0) {
+TEST_P(VFGSerializationTestSuite, VirtTest_0) {
     string test_bc = SVF_BUILD_DIR "tests/ICFG/virt_call_test_cpp.ll";
     vfg_node_and_edge_serialization_test(test_bc);
     svfg_node_and_edge_serialization_test(test_bc);
 }
 
-TEST_F(VFGSerializationTestSuite, VirtTest_1) {
+TEST_P(VFGSerializationTestSuite, VirtTest_1) {
     string test_bc = SVF_BUILD_DIR "/tests/CHG/callsite_cpp.ll";
     vfg_node_and_edge_serialization_test(test_bc);
     svfg_node_and_edge_serialization_test(test_bc);
@@ -214,7 +203,7 @@ TEST_F(VFGSerializationTestSuite, VirtTest_1) {
 // comment then out for the mement
 
 // 1. this test runs stack overflow.
-TEST_F(VFGSerializationTestSuite, WebGL_VFG_0) {
+TEST_P(VFGSerializationTestSuite, WebGL_VFG_0) {
     string test_bc = SVF_SRC_DIR
         "tools/chrome-gl-analysis/chrome_webgl_ir/webgl_all_rendering_code.bc";
     vfg_node_and_edge_serialization_test(test_bc);
@@ -222,13 +211,13 @@ TEST_F(VFGSerializationTestSuite, WebGL_VFG_0) {
 
 
 // this is due to a bug in SVFG construction
-TEST_F(VFGSerializationTestSuite, WebGL_SVFG_all) {
+TEST_P(VFGSerializationTestSuite, WebGL_SVFG_all) {
     string test_bc = SVF_SRC_DIR
         "tools/chrome-gl-analysis/chrome_webgl_ir/webgl_all_rendering_code.bc";
     svfg_node_and_edge_serialization_test(test_bc);
 }
 
-TEST_F(VFGSerializationTestSuite, WebGL_SVFG_graph_only) {
+TEST_P(VFGSerializationTestSuite, WebGL_SVFG_graph_only) {
     string test_bc = SVF_SRC_DIR
         "tools/chrome-gl-analysis/chrome_webgl_ir/webgl_all_rendering_code.bc";
     svfg_node_and_edge_serialization_test(test_bc, true);
@@ -236,6 +225,11 @@ TEST_F(VFGSerializationTestSuite, WebGL_SVFG_graph_only) {
 
 #endif
 
+INSTANTIATE_TEST_SUITE_P(AllArchives, VFGSerializationTestSuite,
+                         ::testing::Values(SVFProject::TextArchive,
+                                           SVFProject::BinaryArchive,
+                                           SVFProject::CompressedBinaryArchive));
+
 int main(int argc, char *argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,135 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#include "Graphs/LazySVFG.h"
+#include "MSSA/SVFGBuilder.h"
+#include "SVF-FE/SVFProject.h"
+#include "WPA/Andersen.h"
+
+#include "Tests/DDA/DDAPass.hpp"
+#include "Tests/Graphs/SVFG.hpp"
+#include "Tests/Options.hpp"
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace SVF;
+
+/// Memory region and SSA version of ver
+static string getVerStr(const MRVerSPtr &ver) {
+    return ver->getMR()->dumpStr() + "V" + to_string(ver->getSSAVersion());
+}
+
+/// Key of a node which does not depend on the order nodes are created in.
+/// Top-level nodes are all created upfront, so keep their IDs.
+static string getNodeKey(const SVFGNode *node) {
+    if (const auto *fi = llvm::dyn_cast<FormalINSVFGNode>(node))
+        return "FI " + fi->getFun()->getName().str() + " " +
+               getVerStr(fi->getEntryChi()->getResVer());
+    if (const auto *fo = llvm::dyn_cast<FormalOUTSVFGNode>(node))
+        return "FO " + fo->getFun()->getName().str() + " " +
+               getVerStr(fo->getRetMU()->getVer());
+    if (const auto *ai = llvm::dyn_cast<ActualINSVFGNode>(node))
+        return "AI " + to_string(ai->getCallSite()->getId()) + " " +
+               getVerStr(ai->getCallMU()->getVer());
+    if (const auto *ao = llvm::dyn_cast<ActualOUTSVFGNode>(node))
+        return "AO " + to_string(ao->getCallSite()->getId()) + " " +
+               getVerStr(ao->getCallCHI()->getResVer());
+    if (const auto *phi = llvm::dyn_cast<MSSAPHISVFGNode>(node))
+        return "PHI " + to_string(phi->getNodeKind()) + " " +
+               phi->getFun()->getName().str() + " " +
+               getVerStr(phi->getRes()->getResVer());
+    return "N " + to_string(node->getId());
+}
+
+/// A lazy SVFG of ll_file, with cacheSize connected functions kept, reached
+/// node by node as a client would before connecting everything, has the
+/// nodes and edges of the eager SVFG
+static void checkEdges(string ll_file, unsigned cacheSize) {
+    SVFProject proj(ll_file);
+    Andersen *ander = AndersenWaveDiff::createAndersenWaveDiff(&proj);
+
+    SVFGBuilder eagerBuilder;
+    SVFG *eagerSVFG = eagerBuilder.buildPTROnlySVFGWithoutOPT(ander);
+    SVFGSets eager(eagerSVFG, getNodeKey);
+    delete eagerSVFG;
+
+    OptionGuard guard(Options::LazySVFGCacheSize, cacheSize);
+    SVFGBuilder builder;
+    auto *lazy = static_cast<LazySVFG *>(builder.buildLazyPTROnlySVFG(ander));
+
+    vector<NodeID> topLevel;
+    for (auto &it : *lazy)
+        topLevel.push_back(it.first);
+    for (NodeID id : topLevel) {
+        lazy->buildIndirectVFOn(lazy->getGNode(id));
+        lazy->finishQuery();
+        if (cacheSize != 0)
+            ASSERT_LE(lazy->getNumOfConnectedFuns(), cacheSize);
+    }
+
+    lazy->buildAllIndirectVF();
+    SVFGSets connected(lazy, getNodeKey);
+    EXPECT_FALSE(eager.edges.empty());
+    EXPECT_EQ(eager.nodes, connected.nodes);
+    EXPECT_EQ(eager.edges, connected.edges);
+
+    delete lazy;
+    delete ander;
+}
+
+/// Alias results of a context-sensitive DDA of ll_file on pairs of its
+/// pointers, on an eager or lazy SVFG
+static vector<AliasResult> runDDA(string ll_file, bool lazy,
+                                  unsigned cacheSize) {
+    OptionGuard lazyGuard(Options::LazySVFG, lazy);
+    OptionGuard cacheGuard(Options::LazySVFGCacheSize, cacheSize);
+
+    return getDDAAliasResults(ll_file);
+}
+
+static void checkDDA(string ll_file) {
+    Options::DDASelected.addValue(PointerAnalysis::Cxt_DDA);
+    // Node 0 is not a valid pointer, so no query is answered up front.
+    OptionGuard guard(Options::UserInputQuery, "0");
+
+    vector<AliasResult> eager = runDDA(ll_file, false, 0);
+    ASSERT_FALSE(eager.empty());
+    EXPECT_EQ(eager, runDDA(ll_file, true, 0));
+    EXPECT_EQ(eager, runDDA(ll_file, true, 1));
+}
+
+TEST(LazySVFGTest, EdgeTest_0) {
+    for (string ll_file : ThreadTestPrograms) {
+        SCOPED_TRACE(ll_file);
+        checkEdges(ll_file, 0);
+        checkEdges(ll_file, 1);
+    }
+}
+
+TEST(LazySVFGTest, DDATest_0) {
+    for (string ll_file : ThreadTestPrograms) {
+        SCOPED_TRACE(ll_file);
+        checkDDA(ll_file);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,146 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#include "MSSA/SVFGBuilder.h"
+#include "SVF-FE/SVFProject.h"
+#include "WPA/Andersen.h"
+
+#include "Tests/Graphs/SVFG.hpp"
+#include "Tests/Options.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace SVF;
+
+/// Mu, chi and phi tables of a Memory SSA, one sorted list of rows per table.
+/// Version IDs are relative to the first ID given out by the build, as the
+/// counter is shared by all the Memory SSAs of the process.
+class MSSATables {
+  public:
+    vector<string> loadMus, storeChis, callMus, callChis, retMus, entryChis,
+        phis;
+
+    MSSATables(MemSSA *mssa, MRVERID base) : base(base) {
+        for (auto &it : mssa->getLoadToMUSetMap())
+            addMus(loadMus, to_string(it.first->getId()), it.second);
+        for (auto &it : mssa->getStoreToChiSetMap())
+            addChis(storeChis, to_string(it.first->getId()), it.second);
+        for (auto &it : mssa->getCallSiteToMuSetMap())
+            addMus(callMus, to_string(it.first->getId()), it.second);
+        for (auto &it : mssa->getCallSiteToChiSetMap())
+            addChis(callChis, to_string(it.first->getId()), it.second);
+        for (auto &it : mssa->getFunToRetMuSetMap())
+            addMus(retMus, it.first->getName().str(), it.second);
+        for (auto &it : mssa->getFunToEntryChiSetMap())
+            addChis(entryChis, it.first->getName().str(), it.second);
+        for (auto &it : mssa->getBBToPhiSetMap()) {
+            string key = getBBKey(it.first);
+            for (const auto *phi : it.second) {
+                string row = key + " " + getVerStr(phi->getResVer()) + " =";
+                for (auto op = phi->opVerBegin(); op != phi->opVerEnd(); ++op)
+                    row += " " + to_string(op->first) + ":" +
+                           getVerStr(op->second);
+                phis.push_back(row);
+            }
+        }
+
+        for (auto *table : {&loadMus, &storeChis, &callMus, &callChis,
+                            &retMus, &entryChis, &phis})
+            sort(table->begin(), table->end());
+    }
+
+  private:
+    MRVERID base;
+
+    string getVerStr(const MRVerSPtr &ver) const {
+        return ver->getMR()->dumpStr() + "V" +
+               to_string(ver->getSSAVersion()) + "#" +
+               to_string(ver->getID() - base);
+    }
+
+    /// Function name and position of bb in it
+    static string getBBKey(const BasicBlock *bb) {
+        const llvm::Function *fun = bb->getParent();
+        u32_t pos = 0;
+        for (const BasicBlock &b : *fun) {
+            if (&b == bb)
+                break;
+            ++pos;
+        }
+        return fun->getName().str() + ":" + to_string(pos);
+    }
+
+    void addMus(vector<string> &table, const string &key,
+                const MemSSA::MUSet &mus) {
+        for (const auto *mu : mus)
+            table.push_back(key + " " + getVerStr(mu->getVer()));
+    }
+
+    void addChis(vector<string> &table, const string &key,
+                 const MemSSA::CHISet &chis) {
+        for (const auto *chi : chis)
+            table.push_back(key + " " + getVerStr(chi->getResVer()) + " = " +
+                            getVerStr(chi->getOpVer()));
+    }
+};
+
+/// Build the Memory SSA of ll_file's Andersen result with the given number
+/// of threads and return its tables
+static unique_ptr<MSSATables> buildMSSA(string ll_file, unsigned threads,
+                                        bool ptrOnlyMSSA) {
+    OptionGuard guard(Options::MSSAThreads, threads);
+    SVFProject proj(ll_file);
+    Andersen *ander = AndersenWaveDiff::createAndersenWaveDiff(&proj);
+
+    // The next version built gets the ID after the probe's
+    MRVer probe(nullptr, 0, nullptr);
+    SVFGBuilder builder;
+    unique_ptr<MemSSA> mssa(builder.buildMSSA(ander, ptrOnlyMSSA));
+    auto tables = make_unique<MSSATables>(mssa.get(), probe.getID() + 1);
+
+    mssa.reset();
+    delete ander;
+    return tables;
+}
+
+TEST(MemSSATest, ThreadsTest_0) {
+    for (string ll_file : ThreadTestPrograms) {
+        SCOPED_TRACE(ll_file);
+        for (bool ptrOnlyMSSA : {false, true}) {
+            auto sequential = buildMSSA(ll_file, 1, ptrOnlyMSSA);
+            auto parallel = buildMSSA(ll_file, 4, ptrOnlyMSSA);
+
+            EXPECT_FALSE(sequential->loadMus.empty());
+            EXPECT_EQ(sequential->loadMus, parallel->loadMus);
+            EXPECT_EQ(sequential->storeChis, parallel->storeChis);
+            EXPECT_EQ(sequential->callMus, parallel->callMus);
+            EXPECT_EQ(sequential->callChis, parallel->callChis);
+            EXPECT_EQ(sequential->retMus, parallel->retMus);
+            EXPECT_EQ(sequential->entryChis, parallel->entryChis);
+            EXPECT_EQ(sequential->phis, parallel->phis);
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
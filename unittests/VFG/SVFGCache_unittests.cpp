@@ -0,0 +1,202 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#include "MSSA/SVFGCache.h"
+#include "SVF-FE/SVFProject.h"
+#include "WPA/Andersen.h"
+
+#include "Tests/DDA/DDAPass.hpp"
+#include "Tests/Options.hpp"
+#include "Tests/SABER/LeakChecker.hpp"
+#include "config.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Path.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace SVF;
+
+class SVFGCacheTest : public ::testing::Test {
+  protected:
+    llvm::SmallString<128> dir;
+    unique_ptr<OptionGuard<string>> dirGuard;
+
+    void SetUp() override {
+        ASSERT_FALSE(llvm::sys::fs::createUniqueDirectory("svfg-cache", dir));
+        dirGuard = make_unique<OptionGuard<string>>(Options::SVFGCacheDir,
+                                                    dir.str().str());
+    }
+
+    void TearDown() override {
+        dirGuard.reset();
+        llvm::sys::fs::remove_directories(dir);
+    }
+
+    /// Points-to file of the Andersen results of proj
+    static string getPtsFile(SVFProject &proj) {
+        return SVFGCache(&proj, PointerAnalysis::AndersenWaveDiff_WPA)
+            .getPtsFile();
+    }
+
+    /// Changing opt to value, and only that, makes the Andersen results of
+    /// proj miss the cache
+    template <typename T, typename V>
+    static void checkMiss(SVFProject &proj, const llvm::cl::opt<T> &opt,
+                          V value) {
+        string ptsFile = getPtsFile(proj);
+        ASSERT_TRUE(llvm::sys::fs::exists(ptsFile));
+
+        string changed;
+        {
+            OptionGuard<T> guard(opt, value);
+            changed = getPtsFile(proj);
+        }
+
+        EXPECT_NE(ptsFile, changed) << opt.ArgStr.str();
+        EXPECT_FALSE(llvm::sys::fs::exists(changed)) << opt.ArgStr.str();
+        EXPECT_EQ(ptsFile, getPtsFile(proj)) << opt.ArgStr.str();
+    }
+
+    /// Points-to set of every PAG node of the Andersen results of ll_file,
+    /// and which objects are field-insensitive
+    static vector<string> getResults(string ll_file) {
+        SVFProject proj(ll_file);
+        Andersen *ander = AndersenWaveDiff::createAndersenWaveDiff(&proj);
+        vector<string> results;
+        for (auto &it : *proj.getPAG()) {
+            string row = to_string(it.first) + " {";
+            for (NodeID o : ander->getPts(it.first))
+                row += " " + to_string(o);
+            row += " }";
+            if (llvm::isa<FIObjPN>(it.second) &&
+                ander->isFieldInsensitive(it.first))
+                row += " fi";
+            results.push_back(row);
+        }
+        sort(results.begin(), results.end());
+        delete ander;
+        return results;
+    }
+
+    /// Number of SVFGs in the cache directory
+    size_t getNumOfSVFGFiles() const {
+        size_t num = 0;
+        std::error_code ec;
+        for (llvm::sys::fs::directory_iterator it(dir, ec), end;
+             !ec && it != end; it.increment(ec)) {
+            if (llvm::sys::path::extension(it->path()) == ".svfg")
+                ++num;
+        }
+        return num;
+    }
+
+    static size_t getNumOfFieldInsensitiveObjs(const vector<string> &r) {
+        return count_if(r.begin(), r.end(), [](const string &row) {
+            return row.size() > 3 && row.compare(row.size() - 3, 3, " fi") == 0;
+        });
+    }
+};
+
+TEST_F(SVFGCacheTest, OptionKeyTest_0) {
+    string ll_file = SVF_BUILD_DIR "tests/ICFG/fptr_test_cpp.ll";
+    SVFProject proj(ll_file);
+    delete AndersenWaveDiff::createAndersenWaveDiff(&proj);
+
+    checkMiss(proj, Options::MergePWC, !Options::MergePWC);
+    checkMiss(proj, Options::SFRMaxFieldExpand,
+              Options::SFRMaxFieldExpand + 1);
+    checkMiss(proj, Options::IndirectCallLimit,
+              Options::IndirectCallLimit + 1);
+    checkMiss(proj, Options::EnableThreadCallGraph,
+              !Options::EnableThreadCallGraph);
+    checkMiss(proj, Options::UsePreCompFieldSensitive,
+              !Options::UsePreCompFieldSensitive);
+    checkMiss(proj, Options::SingleStride, !Options::SingleStride);
+    checkMiss(proj, Options::PtsDiff, !Options::PtsDiff);
+    checkMiss(proj, Options::IncrementalSCC, !Options::IncrementalSCC);
+    checkMiss(proj, Options::SteensPrePass, !Options::SteensPrePass);
+    checkMiss(proj, Options::OfflineSubst, !Options::OfflineSubst);
+    checkMiss(proj, Options::AnderWorkList, NodeWorkList::Order::LRF);
+    checkMiss(proj, Options::MaxFieldLimit, Options::MaxFieldLimit + 1);
+    checkMiss(proj, Options::FirstFieldEqBase, !Options::FirstFieldEqBase);
+    checkMiss(proj, Options::ConnectVCallOnCHA, !Options::ConnectVCallOnCHA);
+}
+
+TEST_F(SVFGCacheTest, HitTest_0) {
+    string ll_file = SVF_BUILD_DIR "tests/ICFG/fptr_test_cpp.ll";
+    vector<string> solved = getResults(ll_file);
+    {
+        SVFProject proj(ll_file);
+        ASSERT_TRUE(llvm::sys::fs::exists(getPtsFile(proj)));
+    }
+    EXPECT_EQ(solved, getResults(ll_file));
+
+    // The results read from the cache are finalized, which freezes the call
+    // graph under -freeze-graphs.
+    {
+        OptionGuard guard(Options::FreezeGraphs, true);
+        SVFProject proj(ll_file);
+        Andersen *ander = AndersenWaveDiff::createAndersenWaveDiff(&proj);
+        EXPECT_TRUE(ander->getPTACallGraph()->isFrozen());
+        delete ander;
+    }
+}
+
+/// Objects collapsed by a variant gep are not in the points-to file, so
+/// such results are solved again rather than read without the collapse
+TEST_F(SVFGCacheTest, CollapseTest_0) {
+    string ll_file = SVF_BUILD_DIR "tests/simple/collapse_cpp.ll";
+    vector<string> solved = getResults(ll_file);
+    EXPECT_GT(getNumOfFieldInsensitiveObjs(solved), 0u);
+    {
+        SVFProject proj(ll_file);
+        EXPECT_FALSE(llvm::sys::fs::exists(getPtsFile(proj)));
+    }
+    EXPECT_EQ(solved, getResults(ll_file));
+}
+
+/// Clients of an SVFG loaded from the cache find the same definitions of
+/// top-level pointers as on the SVFG it was built as
+TEST_F(SVFGCacheTest, ClientTest_0) {
+    string ll_file = SVF_BUILD_DIR "tests/SABER/leak_cpp.ll";
+
+    vector<string> leaks = checkLeaks(ll_file);
+    ASSERT_GT(leaks.size(), 1u);
+    size_t numOfSVFGs = getNumOfSVFGFiles();
+    ASSERT_GT(numOfSVFGs, 0u);
+    EXPECT_EQ(leaks, checkLeaks(ll_file));
+    EXPECT_EQ(numOfSVFGs, getNumOfSVFGFiles());
+
+    Options::DDASelected.addValue(PointerAnalysis::Cxt_DDA);
+    // Node 0 is not a valid pointer, so no query is answered up front.
+    OptionGuard guard(Options::UserInputQuery, "0");
+    vector<AliasResult> aliases = getDDAAliasResults(ll_file);
+    ASSERT_FALSE(aliases.empty());
+    ASSERT_GT(getNumOfSVFGFiles(), numOfSVFGs);
+    numOfSVFGs = getNumOfSVFGFiles();
+    EXPECT_EQ(aliases, getDDAAliasResults(ll_file));
+    EXPECT_EQ(numOfSVFGs, getNumOfSVFGFiles());
+}
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
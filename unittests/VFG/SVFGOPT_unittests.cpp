@@ -0,0 +1,68 @@
+/******************************************************************************
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+#include "MSSA/SVFGBuilder.h"
+#include "SVF-FE/SVFProject.h"
+#include "WPA/Andersen.h"
+
+#include "Tests/Graphs/SVFG.hpp"
+#include "Tests/Options.hpp"
+#include "gtest/gtest.h"
+
+#include <string>
+
+using namespace std;
+using namespace SVF;
+
+/// Build the optimised SVFG of ander with the given number of threads and
+/// return its nodes and edges
+static SVFGSets buildSVFGOPT(Andersen *ander, bool ptrOnly, unsigned threads) {
+    OptionGuard guard(Options::SVFGOPTThreads, threads);
+
+    SVFGBuilder builder;
+    SVFG *svfg = ptrOnly ? builder.buildPTROnlySVFG(ander)
+                         : builder.buildFullSVFG(ander);
+    SVFGSets sets(svfg);
+    delete svfg;
+    return sets;
+}
+
+/// With one thread, the parameter nodes are bypassed one by one as they
+/// have always been; with more, most of them are bypassed at once
+TEST(SVFGOPTTest, ThreadsTest_0) {
+    for (string ll_file : ThreadTestPrograms) {
+        SCOPED_TRACE(ll_file);
+        SVFProject proj(ll_file);
+        Andersen *ander = AndersenWaveDiff::createAndersenWaveDiff(&proj);
+
+        for (bool ptrOnly : {false, true}) {
+            SVFGSets sequential = buildSVFGOPT(ander, ptrOnly, 1);
+            EXPECT_FALSE(sequential.edges.empty());
+            for (unsigned threads : {2u, 4u}) {
+                SVFGSets parallel = buildSVFGOPT(ander, ptrOnly, threads);
+                EXPECT_EQ(sequential.nodes, parallel.nodes) << threads;
+                EXPECT_EQ(sequential.edges, parallel.edges) << threads;
+            }
+        }
+
+        delete ander;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}